@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AdaptiveConditionOrderer.cpp
+///  \brief         See AdaptiveConditionOrderer.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:45:01
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "AdaptiveConditionOrderer.h"
+#include "Condition.h"
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  AdaptiveConditionOrderer::Statistics
+// |
+// ----------------------------------------------------------------------
+AdaptiveConditionOrderer::Statistics::Statistics(size_t numSamples, size_t numFailures, std::chrono::nanoseconds sampledDuration) :
+    NumSamples(std::move(numSamples)),
+    NumFailures(std::move(numFailures)),
+    SampledDuration(std::move(sampledDuration))
+{}
+
+std::chrono::nanoseconds AdaptiveConditionOrderer::Statistics::AverageCost(void) const {
+    if(NumSamples == 0)
+        return std::chrono::nanoseconds(0);
+
+    return SampledDuration / NumSamples;
+}
+
+float AdaptiveConditionOrderer::Statistics::FailureRate(void) const {
+    // Laplace smoothing
+    return static_cast<float>(static_cast<double>(NumFailures + 1) / static_cast<double>(NumSamples + 2));
+}
+
+double AdaptiveConditionOrderer::Statistics::Rank(void) const {
+    return static_cast<double>(AverageCost().count()) / static_cast<double>(FailureRate());
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  AdaptiveConditionOrderer
+// |
+// ----------------------------------------------------------------------
+AdaptiveConditionOrderer::AdaptiveConditionOrderer(size_t samplingInterval/*=16*/, size_t minNumSamples/*=4*/, size_t numShards/*=16*/) :
+    SamplingInterval(
+        std::move(
+            [&samplingInterval](void) -> size_t & {
+                ENSURE_ARGUMENT(samplingInterval);
+                return samplingInterval;
+            }()
+        )
+    ),
+    MinNumSamples(std::move(minNumSamples)),
+    _shards(
+        [&numShards](void) {
+            ENSURE_ARGUMENT(numShards);
+
+            ShardUniquePtrs                 results;
+
+            results.reserve(numShards);
+
+            while(results.size() < numShards)
+                results.emplace_back(std::make_unique<Shard>());
+
+            return results;
+        }()
+    )
+{}
+
+AdaptiveConditionOrderer::~AdaptiveConditionOrderer(void) = default;
+
+AdaptiveConditionOrderer::Indexes AdaptiveConditionOrderer::GetOrder(Conditions const &conditions) const {
+    // ----------------------------------------------------------------------
+    using RankInfo                          = std::tuple<bool, double>;
+    using RankInfos                         = std::vector<RankInfo>;
+    // ----------------------------------------------------------------------
+
+    RankInfos                               rankInfos;
+
+    rankInfos.reserve(conditions.size());
+
+    for(Condition const *pCondition : conditions) {
+        assert(pCondition);
+
+        Shard &                             shard(GetShard(*pCondition));
+        std::shared_lock<decltype(shard.Mutex)>         lock(shard.Mutex); UNUSED(lock);
+        auto const                                      iter(shard.Entries.find(pCondition));
+
+        // Conditions that haven't been sampled enough are ordered first so that
+        // their statistics can be learned.
+        if(iter == shard.Entries.end() || iter->second.NumSamples < MinNumSamples)
+            rankInfos.emplace_back(false, 0.0);
+        else
+            rankInfos.emplace_back(true, iter->second.Rank());
+    }
+
+    Indexes                                 results(conditions.size());
+
+    std::iota(results.begin(), results.end(), 0);
+    std::stable_sort(
+        results.begin(),
+        results.end(),
+        [&rankInfos](size_t a, size_t b) { return rankInfos[a] < rankInfos[b]; }
+    );
+
+    return results;
+}
+
+AdaptiveConditionOrderer::ConditionStatistics AdaptiveConditionOrderer::GetStatistics(void) const {
+    ConditionStatistics                     results;
+
+    for(auto const &pShard : _shards) {
+        std::shared_lock<decltype(pShard->Mutex)>       lock(pShard->Mutex); UNUSED(lock);
+
+        for(auto const &kvp : pShard->Entries)
+            results.emplace_back(kvp.first, kvp.second);
+    }
+
+    // Sort in the order in which the Conditions would be applied
+    Conditions                              conditions;
+
+    conditions.reserve(results.size());
+
+    for(auto const &result : results)
+        conditions.emplace_back(std::get<0>(result));
+
+    Indexes const                           order(GetOrder(conditions));
+    ConditionStatistics                     sortedResults;
+
+    sortedResults.reserve(results.size());
+
+    for(size_t index : order)
+        sortedResults.emplace_back(std::move(results[index]));
+
+    return sortedResults;
+}
+
+void AdaptiveConditionOrderer::Clear(void) {
+    // References to entries never escape the shard lock, so they can be
+    // removed while `Apply` is running on other threads.
+    for(auto const &pShard : _shards) {
+        std::scoped_lock<decltype(pShard->Mutex)>       lock(pShard->Mutex); UNUSED(lock);
+
+        pShard->Entries.clear();
+    }
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+AdaptiveConditionOrderer::Shard & AdaptiveConditionOrderer::GetShard(Condition const &condition) const {
+    // Fibonacci hashing; the low bits of the address are always 0 due to
+    // alignment, so the high bits of the product are used instead.
+    std::uint64_t const                     hash(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&condition)) * 11400714819323198485ull);
+
+    return *_shards[static_cast<size_t>(hash >> 32) % _shards.size()];
+}
+
+bool AdaptiveConditionOrderer::IsSampled(void) const {
+    if(SamplingInterval == 1)
+        return true;
+
+    // Samples are chosen randomly rather than by counting so that Conditions
+    // applied in a fixed rotation are sampled evenly.
+    thread_local std::minstd_rand           generator(std::random_device{}());
+
+    return generator() % SamplingInterval == 0;
+}
+
+void AdaptiveConditionOrderer::Record(Condition const &condition, bool isSuccessful, std::chrono::nanoseconds duration) {
+    Shard &                                 shard(GetShard(condition));
+    std::scoped_lock<decltype(shard.Mutex)>             lock(shard.Mutex); UNUSED(lock);
+    Statistics &                                        statistics(shard.Entries.try_emplace(&condition, 0, 0, std::chrono::nanoseconds(0)).first->second);
+
+    ++statistics.NumSamples;
+    statistics.SampledDuration += duration;
+
+    if(isSuccessful == false)
+        ++statistics.NumFailures;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
@@ -0,0 +1,208 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AdaptiveConditionOrderer.h
+///  \brief         Contains the AdaptiveConditionOrderer object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:45:01
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+
+#include <DecisionEngine/Core/Components/Condition.h>
+
+#include <chrono>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |  Forward Declarations
+class Condition;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         AdaptiveConditionOrderer
+///  \brief         Learns the cost and failure rate of Conditions as they are
+///                 applied and orders Conditions so that those most likely to
+///                 fail cheaply are applied first. This reduces the work done
+///                 when evaluation stops at the first failed requirement (see
+///                 `Resource::CalculateResult`).
+///
+///                 On average, one in `SamplingInterval` applications is
+///                 sampled (timed and recorded); the others are applied
+///                 without any bookkeeping. Conditions with fewer than
+///                 `MinNumSamples` samples are ordered first (in their
+///                 original order) so that their statistics can be learned.
+///
+///                 Statistics are keyed by the identity of the Condition, so
+///                 the object must be cleared if Conditions are destroyed
+///                 while it is still in use.
+///
+class AdaptiveConditionOrderer {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Result                            = Core::Components::Condition::Result;
+    using Conditions                        = std::vector<Condition const *>;
+
+    /// Indexes into a collection of Conditions
+    using Indexes                           = std::vector<size_t>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         Statistics
+    ///  \brief         Information learned about a Condition from its sampled
+    ///                 applications.
+    ///
+    class Statistics {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        size_t                              NumSamples;
+        size_t                              NumFailures;
+        std::chrono::nanoseconds            SampledDuration;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        Statistics(size_t numSamples, size_t numFailures, std::chrono::nanoseconds sampledDuration);
+
+#define ARGS                                MEMBERS(NumSamples, NumFailures, SampledDuration)
+
+        COPY(Statistics, ARGS);
+        MOVE(Statistics, ARGS);
+        COMPARE(Statistics, ARGS);
+
+#undef ARGS
+
+        /// Returns the average duration of the sampled applications, or 0 if
+        /// there weren't any samples.
+        std::chrono::nanoseconds AverageCost(void) const;
+
+        /// Returns the smoothed ratio of samples that failed; the value is never
+        /// 0 or 1, so Conditions that haven't failed yet are still ranked.
+        float FailureRate(void) const;
+
+        /// Returns the expected cost of finding a failure with this Condition;
+        /// Conditions with lower ranks are applied first.
+        double Rank(void) const;
+    };
+
+    using ConditionStatistics               = std::vector<std::tuple<Condition const *, Statistics>>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            SamplingInterval;
+    size_t const                            MinNumSamples;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    AdaptiveConditionOrderer(size_t samplingInterval=16, size_t minNumSamples=4, size_t numShards=16);
+    ~AdaptiveConditionOrderer(void);
+
+    NON_COPYABLE(AdaptiveConditionOrderer);
+    NON_MOVABLE(AdaptiveConditionOrderer);
+
+    /// Applies the Condition via `func`, recording its statistics if the
+    /// application is sampled.
+    template <typename ApplyFuncT>
+    Result Apply(Condition const &condition, ApplyFuncT const &func);
+
+    /// Returns the order in which the Conditions should be applied.
+    Indexes GetOrder(Conditions const &conditions) const;
+
+    /// Returns the statistics of every Condition that has been sampled, in the
+    /// order in which they would be applied.
+    ConditionStatistics GetStatistics(void) const;
+
+    /// Removes all statistics.
+    void Clear(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    class Shard {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        /// Held exclusively when recording samples, shared when ordering
+        std::shared_mutex                   Mutex;
+        std::unordered_map<Condition const *, Statistics>   Entries;
+    };
+
+    using ShardUniquePtr                    = std::unique_ptr<Shard>;
+    using ShardUniquePtrs                   = std::vector<ShardUniquePtr>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    ShardUniquePtrs const                   _shards;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    Shard & GetShard(Condition const &condition) const;
+
+    bool IsSampled(void) const;
+    void Record(Condition const &condition, bool isSuccessful, std::chrono::nanoseconds duration);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  AdaptiveConditionOrderer
+// |
+// ----------------------------------------------------------------------
+template <typename ApplyFuncT>
+AdaptiveConditionOrderer::Result AdaptiveConditionOrderer::Apply(Condition const &condition, ApplyFuncT const &func) {
+    if(IsSampled() == false)
+        return func(condition);
+
+    std::chrono::steady_clock::time_point const         start(std::chrono::steady_clock::now());
+    Result                                              result(func(condition));
+
+    Record(condition, result.IsSuccessful, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+    return result;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
@@ -0,0 +1,838 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ConstrainedResource_Benchmark.cpp
+///  \brief         End-to-end benchmark for ConstrainedResource using
+///                 generated scheduling workloads
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:48:08
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "../Condition.h"
+#include "../Request.h"
+#include "../Resource.h"
+#include "../ResultSystem.h"
+#include "../StandardPermutationGenerator.h"
+#include "../WorkingSystem.h"
+
+#include <DecisionEngine/Core/Components/Benchmarks/BenchmarkHelpers.h>
+#include <DecisionEngine/Core/LocalExecution/AnytimeObserver.h>
+#include <DecisionEngine/Core/LocalExecution/Engine.h>
+
+#include <iostream>
+#include <mutex>
+#include <random>
+
+namespace Benchmarks                        = DecisionEngine::Core::Components::Benchmarks;
+namespace Components                        = DecisionEngine::Core::Components;
+namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         WorkloadRequest
+///  \brief         A job that consumes `Demand` units of capacity on the
+///                 slot that it is assigned to.
+///
+class WorkloadRequest : public NS::Request {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::uint32_t const                     Id;
+    std::uint32_t const                     Demand;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    WorkloadRequest(std::uint32_t id, std::uint32_t demand, NS::ConditionPtrsPtr optionalRequirementConditions, NS::ConditionPtrsPtr optionalPreferenceConditions) :
+        NS::Request("Request" + std::to_string(id), NS::ConditionPtrsPtr(), std::move(optionalRequirementConditions), std::move(optionalPreferenceConditions)),
+        Id(std::move(id)),
+        Demand(
+            std::move(
+                [&demand](void) -> std::uint32_t & {
+                    ENSURE_ARGUMENT(demand);
+                    return demand;
+                }()
+            )
+        )
+    {}
+
+    ~WorkloadRequest(void) override = default;
+
+#define ARGS                                MEMBERS(Id, Demand), BASES(NS::Request)
+
+    NON_COPYABLE(WorkloadRequest);
+    MOVE(WorkloadRequest, ARGS);
+    COMPARE(WorkloadRequest, ARGS);
+    SERIALIZATION(WorkloadRequest, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(NS::Request)));
+
+#undef ARGS
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(WorkloadRequest);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         WorkloadResource
+///  \brief         A collection of slots, each with a limited capacity.
+///                 Evaluating a Request creates one candidate Resource for
+///                 each slot, where the Request has been assigned to that
+///                 slot; the conditions are applied to the candidate.
+///
+class WorkloadResource : public NS::Resource {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using Capacities                        = std::vector<std::int64_t>;
+    using CapacitiesPtr                     = std::shared_ptr<Capacities const>;
+
+    class ApplyState : public NS::Resource::State {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        ResourcePtr const                   Candidate;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ApplyState(Resource const &resource, ResourcePtr pCandidate) :
+            NS::Resource::State(resource),
+            Candidate(std::move(pCandidate))
+        {}
+
+        ~ApplyState(void) override = default;
+
+#define ARGS                                MEMBERS(Candidate), BASES(NS::Resource::State)
+
+        NON_COPYABLE(ApplyState);
+        MOVE(ApplyState, ARGS);
+        COMPARE(ApplyState, ARGS);
+        SERIALIZATION(ApplyState, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(NS::Resource::State)));
+
+#undef ARGS
+    };
+
+    class ContinuationState : public NS::Resource::State {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        size_t const                        NextSlot;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ContinuationState(Resource const &resource, size_t nextSlot) :
+            NS::Resource::State(resource),
+            NextSlot(std::move(nextSlot))
+        {}
+
+        ~ContinuationState(void) override = default;
+
+#define ARGS                                MEMBERS(NextSlot), BASES(NS::Resource::State)
+
+        NON_COPYABLE(ContinuationState);
+        MOVE(ContinuationState, ARGS);
+        COMPARE(ContinuationState, ARGS);
+        SERIALIZATION(ContinuationState, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(NS::Resource::State)));
+
+#undef ARGS
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    CapacitiesPtr const                     InitialCapacities;
+    Capacities const                        RemainingCapacities;
+    size_t const                            LastSlot;       /// std::numeric_limits<size_t>::max() if no Requests have been applied
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(WorkloadResource);
+
+    template <typename PrivateConstructorTagT>
+    WorkloadResource(PrivateConstructorTagT tag, CapacitiesPtr pCapacities, ConditionPtrsPtr optionalRequirementConditions, ConditionPtrsPtr optionalPreferenceConditions) :
+        NS::Resource(tag, "WorkloadResource", ConditionPtrsPtr(), std::move(optionalRequirementConditions), std::move(optionalPreferenceConditions)),
+        InitialCapacities(
+            std::move(
+                [&pCapacities](void) -> CapacitiesPtr & {
+                    ENSURE_ARGUMENT(pCapacities, pCapacities && pCapacities->empty() == false);
+                    return pCapacities;
+                }()
+            )
+        ),
+        RemainingCapacities(*InitialCapacities),
+        LastSlot(std::numeric_limits<size_t>::max())
+    {}
+
+    template <typename PrivateConstructorTagT>
+    WorkloadResource(PrivateConstructorTagT tag, WorkloadResource const &other, size_t slot, std::uint32_t demand) :
+        NS::Resource(tag, other),
+        InitialCapacities(other.InitialCapacities),
+        RemainingCapacities(
+            [&other, slot, demand](void) {
+                Capacities                  result(other.RemainingCapacities);
+
+                result[slot] -= static_cast<std::int64_t>(demand);
+                return result;
+            }()
+        ),
+        LastSlot(slot)
+    {}
+
+    ~WorkloadResource(void) override = default;
+
+#define ARGS                                MEMBERS(InitialCapacities, RemainingCapacities, LastSlot), BASES(NS::Resource)
+
+    NON_COPYABLE(WorkloadResource);
+    MOVE(WorkloadResource, ARGS);
+    COMPARE(WorkloadResource, ARGS);
+    SERIALIZATION(WorkloadResource, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(NS::Resource)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, bool isFailFast) const override {
+        return EvaluateSlots(request, maxNumEvaluations, 0, isFailFast);
+    }
+
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &continuationState, bool isFailFast) const override {
+        return EvaluateSlots(request, maxNumEvaluations, static_cast<ContinuationState &>(continuationState).NextSlot, isFailFast);
+    }
+
+    ResourcePtr ApplyImpl(State const &applyState) const override {
+        return static_cast<ApplyState const &>(applyState).Candidate;
+    }
+
+    EvaluateResult EvaluateSlots(Request const &request, size_t maxNumEvaluations, size_t slot, bool isFailFast) const {
+        std::uint32_t const                 demand(static_cast<WorkloadRequest const &>(request).Demand);
+        size_t const                        numSlots(RemainingCapacities.size());
+        size_t const                        endSlot(std::min(numSlots, slot + maxNumEvaluations));
+        Evaluations                         evaluations;
+
+        evaluations.reserve(endSlot - slot);
+
+        while(slot != endSlot) {
+            std::shared_ptr<WorkloadResource>           pCandidate(WorkloadResource::Create(*this, slot, demand));
+            Components::Score::Result                   result(CalculateResult(request, *pCandidate, isFailFast));
+
+            if(result.IsSuccessful)
+                evaluations.emplace_back(std::move(result), std::make_shared<ApplyState>(*this, std::move(pCandidate)));
+            else
+                evaluations.emplace_back(std::move(result));
+
+            ++slot;
+        }
+
+        if(slot == numSlots)
+            return EvaluateResult(std::move(evaluations), ContinuationStatePtr());
+
+        return EvaluateResult(std::move(evaluations), std::make_shared<ContinuationState>(*this, slot));
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(WorkloadResource);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(WorkloadResource::ApplyState);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(WorkloadResource::ContinuationState);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CapacityCondition
+///  \brief         Requirement that the slot assigned to the most recent
+///                 Request is not over capacity.
+///
+class CapacityCondition : public NS::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(CapacityCondition);
+
+    template <typename PrivateConstructorTagT>
+    CapacityCondition(PrivateConstructorTagT tag) :
+        NS::Condition(tag, "Capacity", 100)
+    {}
+
+    ~CapacityCondition(void) override = default;
+
+#define ARGS                                BASES(NS::Condition)
+
+    NON_COPYABLE(CapacityCondition);
+    MOVE(CapacityCondition, ARGS);
+    COMPARE(CapacityCondition, ARGS);
+    SERIALIZATION(CapacityCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(CapacityCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &, Resource const &resourceParam) const override {
+        WorkloadResource const &            resource(static_cast<WorkloadResource const &>(resourceParam));
+
+        return Result(
+            SharedFromThis(),
+            resource.RemainingCapacities[resource.LastSlot] >= 0,
+            [](void) { return std::string("The slot does not have enough capacity"); }
+        );
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(CapacityCondition);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         BalanceCondition
+///  \brief         Preference for slots that have more capacity remaining.
+///
+class BalanceCondition : public NS::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(BalanceCondition);
+
+    template <typename PrivateConstructorTagT>
+    BalanceCondition(PrivateConstructorTagT tag) :
+        NS::Condition(tag, "Balance", 100)
+    {}
+
+    ~BalanceCondition(void) override = default;
+
+#define ARGS                                BASES(NS::Condition)
+
+    NON_COPYABLE(BalanceCondition);
+    MOVE(BalanceCondition, ARGS);
+    COMPARE(BalanceCondition, ARGS);
+    SERIALIZATION(BalanceCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(BalanceCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &, Resource const &resourceParam) const override {
+        WorkloadResource const &            resource(static_cast<WorkloadResource const &>(resourceParam));
+        std::int64_t const                  initial((*resource.InitialCapacities)[resource.LastSlot]);
+        std::int64_t const                  remaining(std::max(resource.RemainingCapacities[resource.LastSlot], static_cast<std::int64_t>(0)));
+
+        return Result(SharedFromThis(), static_cast<float>(remaining) / static_cast<float>(initial));
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(BalanceCondition);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         WorkloadCondition
+///  \brief         Request condition with a configurable cost (the amount
+///                 of work performed for each evaluation) and selectivity
+///                 (the ratio of slots that satisfy a requirement). Results
+///                 are a deterministic function of the seed, Request, and
+///                 slot.
+///
+class WorkloadCondition : public NS::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::uint64_t const                     Seed;
+    std::uint32_t const                     Cost;
+    float const                             Selectivity;    /// Only used by requirements
+    bool const                              IsRequirement;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(WorkloadCondition);
+
+    template <typename PrivateConstructorTagT>
+    WorkloadCondition(PrivateConstructorTagT tag, std::string name, std::uint64_t seed, std::uint32_t cost, float selectivity, bool isRequirement) :
+        NS::Condition(tag, std::move(name), 100),
+        Seed(std::move(seed)),
+        Cost(std::move(cost)),
+        Selectivity(
+            std::move(
+                [&selectivity](void) -> float & {
+                    ENSURE_ARGUMENT(selectivity, selectivity >= 0.0f && selectivity <= 1.0f);
+                    return selectivity;
+                }()
+            )
+        ),
+        IsRequirement(std::move(isRequirement))
+    {}
+
+    ~WorkloadCondition(void) override = default;
+
+#define ARGS                                MEMBERS(Seed, Cost, Selectivity, IsRequirement), BASES(NS::Condition)
+
+    NON_COPYABLE(WorkloadCondition);
+    MOVE(WorkloadCondition, ARGS);
+    COMPARE(WorkloadCondition, ARGS);
+    SERIALIZATION(WorkloadCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(WorkloadCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &requestParam, Resource const &resourceParam) const override {
+        WorkloadRequest const &             request(static_cast<WorkloadRequest const &>(requestParam));
+        WorkloadResource const &            resource(static_cast<WorkloadResource const &>(resourceParam));
+
+        std::uint64_t                       hash(Mix(Seed ^ (static_cast<std::uint64_t>(request.Id) << 32) ^ resource.LastSlot));
+
+        for(std::uint32_t iteration = 0; iteration < Cost; ++iteration)
+            hash = Mix(hash);
+
+        float const                         value(static_cast<float>(hash & 0xFFFF) / 65535.0f);
+
+        if(IsRequirement)
+            return Result(SharedFromThis(), value <= Selectivity);
+
+        return Result(SharedFromThis(), value);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static std::uint64_t Mix(std::uint64_t value) {
+        // splitmix64
+        value += 0x9E3779B97F4A7C15ULL;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(WorkloadCondition);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Workload
+///  \brief         Requests and the initial Resource generated from a seed.
+///
+struct Workload {
+    NS::RequestPtrsContainerPtr             Requests;
+    NS::ResourcePtr                         Resource;
+};
+
+Workload CreateWorkload(
+    std::uint64_t seed,
+    size_t numRequests,
+    size_t numGroups,
+    size_t numSlots,
+    size_t numConditions,
+    size_t numConditionsPerRequest,
+    std::uint32_t maxConditionCost,
+    float minSelectivity,
+    double capacitySlack
+) {
+    std::mt19937_64                         generator(seed);
+
+    // Create the conditions; even conditions are requirements and odd conditions are preferences
+    std::uniform_int_distribution<std::uint32_t>                costDistribution(0, maxConditionCost);
+    std::uniform_real_distribution<float>   selectivityDistribution(minSelectivity, 1.0f);
+    NS::ConditionPtrs                       conditions;
+
+    conditions.reserve(numConditions);
+
+    for(size_t index = 0; index < numConditions; ++index) {
+        conditions.emplace_back(
+            WorkloadCondition::Create(
+                "Condition" + std::to_string(index),
+                generator(),
+                costDistribution(generator),
+                selectivityDistribution(generator),
+                index % 2 == 0
+            )
+        );
+    }
+
+    // Create the requests
+    std::uniform_int_distribution<std::uint32_t>                demandDistribution(1, 10);
+    std::uniform_int_distribution<size_t>   conditionDistribution(0, numConditions ? numConditions - 1 : 0);
+    NS::RequestPtrsContainerPtr             pRequests(std::make_shared<NS::RequestPtrsContainer>(numGroups));
+    std::uint64_t                           totalDemand(0);
+
+    for(size_t index = 0; index < numRequests; ++index) {
+        NS::ConditionPtrs                   requirements;
+        NS::ConditionPtrs                   preferences;
+
+        for(size_t conditionIndex = 0; numConditions && conditionIndex < numConditionsPerRequest; ++conditionIndex) {
+            NS::ConditionPtr const &        pCondition(conditions[conditionDistribution(generator)]);
+
+            if(static_cast<WorkloadCondition const &>(*pCondition).IsRequirement)
+                requirements.emplace_back(pCondition);
+            else
+                preferences.emplace_back(pCondition);
+        }
+
+        std::uint32_t const                 demand(demandDistribution(generator));
+
+        totalDemand += demand;
+
+        (*pRequests)[index % numGroups].emplace_back(
+            std::make_shared<WorkloadRequest>(
+                static_cast<std::uint32_t>(index),
+                demand,
+                requirements.empty() ? NS::ConditionPtrsPtr() : std::make_shared<NS::ConditionPtrs>(std::move(requirements)),
+                preferences.empty() ? NS::ConditionPtrsPtr() : std::make_shared<NS::ConditionPtrs>(std::move(preferences))
+            )
+        );
+    }
+
+    // Create the resource
+    std::int64_t const                      capacity(static_cast<std::int64_t>(std::ceil(static_cast<double>(totalDemand) * capacitySlack / static_cast<double>(numSlots))));
+
+    return Workload{
+        std::move(pRequests),
+        WorkloadResource::Create(
+            std::make_shared<WorkloadResource::Capacities const>(numSlots, std::max(capacity, static_cast<std::int64_t>(1))),
+            std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ CapacityCondition::Create() }),
+            std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ BalanceCondition::Create() })
+        )
+    };
+}
+
+class BenchmarkConfiguration : public LocalExecution::Configuration {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            MaxNumPendingSystems;
+    size_t const                            MaxNumChildrenPerGeneration;
+    size_t const                            MaxNumIterationsPerRound;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    BenchmarkConfiguration(size_t numThreads, size_t maxNumPendingSystems, size_t maxNumChildrenPerGeneration, size_t maxNumIterationsPerRound) :
+        LocalExecution::Configuration(false, true, std::move(numThreads)),
+        MaxNumPendingSystems(std::move(maxNumPendingSystems)),
+        MaxNumChildrenPerGeneration(std::move(maxNumChildrenPerGeneration)),
+        MaxNumIterationsPerRound(std::move(maxNumIterationsPerRound))
+    {}
+
+#define ARGS                                MEMBERS(MaxNumPendingSystems, MaxNumChildrenPerGeneration, MaxNumIterationsPerRound), BASES(LocalExecution::Configuration)
+
+    NON_COPYABLE(BenchmarkConfiguration);
+    MOVE(BenchmarkConfiguration, ARGS);
+    COMPARE(BenchmarkConfiguration, ARGS);
+    SERIALIZATION(BenchmarkConfiguration, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(LocalExecution::Configuration)));
+
+#undef ARGS
+
+    size_t GetMaxNumPendingSystems(void) const override { return MaxNumPendingSystems; }
+    size_t GetMaxNumPendingSystems(WorkingSystem const &) const override { return MaxNumPendingSystems; }
+    size_t GetMaxNumChildrenPerGeneration(WorkingSystem const &) const override { return MaxNumChildrenPerGeneration; }
+    size_t GetMaxNumIterationsPerRound(WorkingSystem const &) const override { return MaxNumIterationsPerRound; }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         BenchmarkObserver
+///  \brief         Stops the engine once the requested number of results
+///                 have been found; improvements over time are recorded by
+///                 the `AnytimeObserver` that wraps this object.
+///
+class BenchmarkObserver : public LocalExecution::Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            MaxNumResults;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    BenchmarkObserver(size_t maxNumResults) :
+        MaxNumResults(maxNumResults),
+        _numResults(0)
+    {}
+
+    ~BenchmarkObserver(void) override = default;
+
+    NON_COPYABLE(BenchmarkObserver);
+    NON_MOVABLE(BenchmarkObserver);
+
+    size_t GetNumResults(void) const { return _numResults; }
+
+    EventFlagValue GetEventFlags(void) const override { return EventFlagValue::None; }
+
+    bool OnRoundBegin(size_t, SystemPtrs const &) override { return true; }
+    void OnRoundEnd(size_t, SystemPtrs const &) override {}
+    bool OnRoundMergingWork(size_t, SystemPtrsContainer const &) override { return true; }
+    void OnRoundMergedWork(size_t, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnTaskBegin(size_t, size_t, size_t) override { return true; }
+    void OnTaskEnd(size_t, size_t, size_t) override {}
+    void OnTaskError(size_t, size_t, size_t, std::exception const &ex) override { throw std::runtime_error(ex.what()); }
+    bool OnIterationBegin(size_t, size_t, size_t, size_t, size_t) override { return true; }
+    void OnIterationEnd(size_t, size_t, size_t, size_t, size_t) override {}
+    bool OnIterationGeneratingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &) override { return true; }
+    void OnIterationGeneratedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &) override {}
+    bool OnIterationMergingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { return true; }
+    void OnIterationMergedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnIterationFailedSystems(size_t, size_t, size_t, size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { return true; }
+
+    bool OnIterationResultSystems(size_t, size_t, size_t, size_t, size_t, ResultSystemUniquePtrs results) override {
+        std::scoped_lock<std::mutex> const  lock(_mutex);
+
+        _numResults += results.size();
+        return _numResults < MaxNumResults;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::mutex                              _mutex;
+    size_t                                  _numResults;
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+void Usage(void) {
+    std::cerr
+        << "Runs generated scheduling workloads through ConstrainedResource::WorkingSystem\n"
+        << "and LocalExecution::Engine and writes the results as JSON.\n"
+        << "\n"
+        << "Values may be comma-delimited to define a parameter sweep.\n"
+        << "\n"
+        << "    --requests=<n>                  Number of Requests [200]\n"
+        << "    --groups=<n>                    Number of Request groups; Requests are permuted within a group [20]\n"
+        << "    --slots=<n>                     Number of slots in the Resource [8]\n"
+        << "    --conditions=<n>                Number of conditions that can be associated with Requests [16]\n"
+        << "    --condition-cost=<n>            Maximum amount of work performed by each condition evaluation [64]\n"
+        << "    --selectivity=<0.0-1.0>         Minimum ratio of slots that satisfy a requirement condition [0.8]\n"
+        << "    --threads=<n>                   Number of concurrent tasks [1]\n"
+        << "    --pending-cap=<n>               Maximum number of pending systems [10000]\n"
+        << "    --permute=<0|1>                 Permute the Requests within each group [0]\n"
+        << "    --children-per-generation=<n>   Maximum children generated per iteration; 0 for the number of slots [0]\n"
+        << "\n"
+        << "    --conditions-per-request=<n>    Number of conditions associated with each Request [2]\n"
+        << "    --capacity-slack=<n>            Total capacity as a multiple of total demand [1.25]\n"
+        << "    --iterations-per-round=<n>      Maximum iterations per round [10]\n"
+        << "    --max-results=<n>               Stop after this many results [100]\n"
+        << "    --timeout=<seconds>             Stop after this many seconds; 0 for no timeout [10]\n"
+        << "    --checkpoints=<seconds,...>     Times at which the best quality is reported [0.01,0.1,1,10]\n"
+        << "    --repetitions=<n>               Number of times to run each configuration [3]\n"
+        << "    --seed=<n>                      Seed used to create the workload [1]\n"
+        << "    --output=<filename>             Write JSON to a file rather than stdout\n"
+        << "    --csv-dir=<directory>           Write the quality-over-time and per-round CSV files for each run to this directory\n"
+        << "\n"
+        << "A summary of the normalized area under the quality-over-time curve (higher is\n"
+        << "better) is written to stderr for each configuration.\n"
+        << "\n";
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Entry Point
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    try {
+        Benchmarks::Arguments               args(argc, argv);
+
+        if(args.Has("help")) {
+            Usage();
+            return 0;
+        }
+
+        std::vector<std::vector<double>> const          sweep{
+            args.GetValues<double>("requests", { 200 }),
+            args.GetValues<double>("groups", { 20 }),
+            args.GetValues<double>("slots", { 8 }),
+            args.GetValues<double>("conditions", { 16 }),
+            args.GetValues<double>("condition-cost", { 64 }),
+            args.GetValues<double>("selectivity", { 0.8 }),
+            args.GetValues<double>("threads", { 1 }),
+            args.GetValues<double>("pending-cap", { 10000 }),
+            args.GetValues<double>("permute", { 0 }),
+            args.GetValues<double>("children-per-generation", { 0 })
+        };
+
+        size_t const                        conditionsPerRequest(args.GetValue<size_t>("conditions-per-request", 2));
+        double const                        capacitySlack(args.GetValue<double>("capacity-slack", 1.25));
+        size_t const                        iterationsPerRound(args.GetValue<size_t>("iterations-per-round", 10));
+        size_t const                        maxNumResults(args.GetValue<size_t>("max-results", 100));
+        double const                        timeoutSeconds(args.GetValue<double>("timeout", 10));
+        std::vector<double> const           checkpoints(args.GetValues<double>("checkpoints", { 0.01, 0.1, 1, 10 }));
+        size_t const                        repetitions(args.GetValue<size_t>("repetitions", 3));
+        std::uint64_t const                 seed(args.GetValue<std::uint64_t>("seed", 1));
+        std::string const                   output(args.GetValue<std::string>("output", std::string()));
+        std::string const                   csvDir(args.GetValue<std::string>("csv-dir", std::string()));
+
+        args.EnsureAllUsed();
+
+        if(repetitions == 0 || maxNumResults == 0 || iterationsPerRound == 0)
+            throw std::invalid_argument("'--repetitions', '--max-results', and '--iterations-per-round' must be greater than 0");
+
+        if(capacitySlack <= 0.0)
+            throw std::invalid_argument("'--capacity-slack' must be greater than 0");
+
+        std::optional<std::chrono::steady_clock::duration> const            timeout(
+            [&timeoutSeconds](void) -> std::optional<std::chrono::steady_clock::duration> {
+                if(timeoutSeconds <= 0)
+                    return std::nullopt;
+
+                return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeoutSeconds));
+            }()
+        );
+
+        if(csvDir.empty() == false)
+            std::filesystem::create_directories(csvDir);
+
+        Benchmarks::Report                  report("ConstrainedResource");
+        size_t                              configurationIndex(0);
+
+        std::cerr << boost::format("%-6s %-60s %10s %10s %10s\n") % "config" % "parameters" % "auc_min" % "auc_median" % "auc_max";
+
+        Benchmarks::ForEachCombination(
+            sweep,
+            [&](std::vector<double> const &values) {
+                size_t const                numRequests(static_cast<size_t>(values[0]));
+                size_t const                numGroups(static_cast<size_t>(values[1]));
+                size_t const                numSlots(static_cast<size_t>(values[2]));
+                size_t const                numConditions(static_cast<size_t>(values[3]));
+                std::uint32_t const         conditionCost(static_cast<std::uint32_t>(values[4]));
+                float const                 selectivity(static_cast<float>(values[5]));
+                size_t const                threads(static_cast<size_t>(values[6]));
+                size_t const                pendingCap(static_cast<size_t>(values[7]));
+                bool const                  permute(values[8] != 0.0);
+                size_t const                childrenPerGeneration(values[9] != 0.0 ? static_cast<size_t>(values[9]) : numSlots);
+
+                if(numRequests == 0 || numGroups == 0 || numGroups > numRequests || numSlots == 0)
+                    throw std::invalid_argument("'--requests', '--groups', and '--slots' must be greater than 0 and '--groups' must not be greater than '--requests'");
+
+                Benchmarks::Metric          firstResult{ "latency_to_first_result", "s", false, {} };
+                Benchmarks::Metric          bestResult{ "latency_to_best_result", "s", false, {} };
+                Benchmarks::Metric          bestQuality{ "best_quality", "ratio", true, {} };
+                Benchmarks::Metric          qualityAuc{ "quality_auc", "ratio", true, {} };
+                Benchmarks::Metric          numImprovements{ "improvements", "results", true, {} };
+                Benchmarks::Metric          numResults{ "results", "systems", true, {} };
+                Benchmarks::Metric          elapsed{ "elapsed", "s", false, {} };
+                Benchmarks::Metric          peakRss{ "peak_rss", "bytes", false, {} };
+                Benchmarks::Metrics         checkpointQualities;
+
+                for(double checkpoint : checkpoints)
+                    checkpointQualities.emplace_back(Benchmarks::Metric{ boost::str(boost::format("best_quality_at_%1%s") % checkpoint), "ratio", true, {} });
+
+                for(size_t repetition = 0; repetition < repetitions; ++repetition) {
+                    Workload                workload(CreateWorkload(seed, numRequests, numGroups, numSlots, numConditions, conditionsPerRequest, conditionCost, selectivity, capacitySlack));
+
+                    Benchmarks::ResetPeakRss();
+
+                    NS::WorkingSystem const                     initial(
+                        [&workload, permute](void) {
+                            if(permute)
+                                return NS::WorkingSystem(workload.Requests, workload.Resource, std::make_shared<NS::StandardPermutationGeneratorFactory>(std::numeric_limits<size_t>::max()));
+
+                            return NS::WorkingSystem(workload.Requests, workload.Resource);
+                        }()
+                    );
+
+                    BenchmarkConfiguration  config(threads, pendingCap, childrenPerGeneration, iterationsPerRound);
+                    BenchmarkObserver       observer(maxNumResults);
+                    LocalExecution::AnytimeObserver             anytimeObserver(observer);
+                    auto const              start(std::chrono::steady_clock::now());
+
+                    LocalExecution::Engine::Execute(config, anytimeObserver, initial, timeout);
+
+                    double const            seconds(Benchmarks::ToSeconds(std::chrono::steady_clock::now() - start));
+                    LocalExecution::AnytimeObserver::Improvements const &   improvements(anytimeObserver.GetImprovements());
+
+                    firstResult.Values.emplace_back(improvements.empty() ? std::numeric_limits<double>::quiet_NaN() : improvements.front().Seconds);
+                    bestResult.Values.emplace_back(improvements.empty() ? std::numeric_limits<double>::quiet_NaN() : improvements.back().Seconds);
+                    bestQuality.Values.emplace_back(improvements.empty() ? std::numeric_limits<double>::quiet_NaN() : improvements.back().Quality);
+                    numImprovements.Values.emplace_back(static_cast<double>(improvements.size()));
+
+                    // Use the timeout as the end of the curve when there is one so that runs
+                    // that stop early are not penalized for the time that they didn't use.
+                    qualityAuc.Values.emplace_back(anytimeObserver.GetAreaUnderCurve(timeoutSeconds > 0 ? timeoutSeconds : std::max(seconds, 1e-9)));
+                    numResults.Values.emplace_back(static_cast<double>(observer.GetNumResults()));
+                    elapsed.Values.emplace_back(seconds);
+                    peakRss.Values.emplace_back(static_cast<double>(Benchmarks::GetPeakRssBytes()));
+
+                    for(size_t index = 0; index < checkpoints.size(); ++index) {
+                        double              quality(std::numeric_limits<double>::quiet_NaN());
+
+                        for(auto const &improvement : improvements) {
+                            if(improvement.Seconds > checkpoints[index])
+                                break;
+
+                            quality = improvement.Quality;
+                        }
+
+                        checkpointQualities[index].Values.emplace_back(quality);
+                    }
+
+                    if(csvDir.empty() == false) {
+                        std::string const   prefix(boost::str(boost::format("ConstrainedResource.%1%.%2%") % configurationIndex % repetition));
+
+                        anytimeObserver.WriteImprovements(std::filesystem::path(csvDir) / (prefix + ".improvements.csv"));
+                        anytimeObserver.WriteRounds(std::filesystem::path(csvDir) / (prefix + ".rounds.csv"));
+                    }
+                }
+
+                {
+                    std::vector<double>     aucs(qualityAuc.Values);
+
+                    std::sort(aucs.begin(), aucs.end());
+
+                    std::cerr
+                        << boost::format("%-6d %-60s %10.4f %10.4f %10.4f\n")
+                            % configurationIndex
+                            % boost::str(
+                                boost::format("requests=%1% groups=%2% slots=%3% threads=%4% children=%5% permute=%6%")
+                                    % numRequests
+                                    % numGroups
+                                    % numSlots
+                                    % threads
+                                    % childrenPerGeneration
+                                    % (permute ? 1 : 0)
+                            )
+                            % aucs.front()
+                            % aucs[aucs.size() / 2]
+                            % aucs.back();
+                }
+
+                Benchmarks::Metrics         metrics{
+                    std::move(firstResult),
+                    std::move(bestResult),
+                    std::move(bestQuality),
+                    std::move(qualityAuc),
+                    std::move(numImprovements),
+                    std::move(numResults),
+                    std::move(elapsed),
+                    std::move(peakRss)
+                };
+
+                std::move(checkpointQualities.begin(), checkpointQualities.end(), std::back_inserter(metrics));
+
+                report.Add(
+                    Benchmarks::Parameters{
+                        { "requests", std::to_string(numRequests) },
+                        { "groups", std::to_string(numGroups) },
+                        { "slots", std::to_string(numSlots) },
+                        { "conditions", std::to_string(numConditions) },
+                        { "condition_cost", std::to_string(conditionCost) },
+                        { "selectivity", boost::str(boost::format("%1%") % selectivity) },
+                        { "threads", std::to_string(threads) },
+                        { "pending_cap", std::to_string(pendingCap) },
+                        { "permute", permute ? "1" : "0" },
+                        { "children_per_generation", std::to_string(childrenPerGeneration) }
+                    },
+                    std::move(metrics)
+                );
+
+                ++configurationIndex;
+            }
+        );
+
+        report.Write(output);
+        return 0;
+    }
+    catch(std::exception const &ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n\n";
+        Usage();
+        return -1;
+    }
+}
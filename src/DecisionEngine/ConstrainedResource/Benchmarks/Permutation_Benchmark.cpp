@@ -0,0 +1,215 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          Permutation_Benchmark.cpp
+///  \brief         Benchmark for the PermutationGenerators
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 12:10:44
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "../DistinctPermutationGenerator.h"
+#include "../HeuristicPermutationGenerator.h"
+#include "../RandomPermutationGenerator.h"
+#include "../RankedPermutationGenerator.h"
+#include "../Request.h"
+#include "../StandardPermutationGenerator.h"
+#include "../StridedPermutationGenerator.h"
+
+#include <DecisionEngine/Core/Components/Benchmarks/AllocationHooks.h>
+#include <DecisionEngine/Core/Components/Benchmarks/BenchmarkHelpers.h>
+
+#include <iostream>
+
+namespace Benchmarks                        = DecisionEngine::Core::Components::Benchmarks;
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PermutationRequest
+///  \brief         A Request without Conditions whose equivalence class and
+///                 priority are provided by the benchmark.
+///
+class PermutationRequest : public NS::Request {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            EquivalenceClass;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    PermutationRequest(size_t id, size_t equivalenceClass) :
+        NS::Request("Request" + std::to_string(id)),
+        EquivalenceClass(std::move(equivalenceClass))
+    {}
+
+    ~PermutationRequest(void) override = default;
+
+#define ARGS                                MEMBERS(EquivalenceClass), BASES(NS::Request)
+
+    NON_COPYABLE(PermutationRequest);
+    MOVE(PermutationRequest, ARGS);
+    COMPARE(PermutationRequest, ARGS);
+
+#undef ARGS
+
+    std::optional<std::string> GetEquivalenceKey(void) const override {
+        return std::to_string(EquivalenceClass);
+    }
+
+    float GetPriority(void) const override {
+        return static_cast<float>(EquivalenceClass);
+    }
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+void Usage(void) {
+    std::cerr
+        << "Generates permutations of a Request group with each PermutationGenerator and\n"
+        << "writes the results as JSON.\n"
+        << "\n"
+        << "Values may be comma-delimited to define a parameter sweep.\n"
+        << "\n"
+        << "    --generators=<name,...>         Generators to run: standard, distinct, heuristic, random, ranked, strided [all]\n"
+        << "    --requests=<n>                  Number of Requests in the group [8,12]\n"
+        << "    --classes=<n>                   Number of equivalence classes; 0 for the number of Requests [0]\n"
+        << "\n"
+        << "    --max-permutations=<n>          Maximum number of permutations generated [100000]\n"
+        << "    --batch=<n>                     Maximum number of permutations requested by each call to Generate [100]\n"
+        << "    --repetitions=<n>               Number of times to run each configuration [5]\n"
+        << "    --output=<filename>             Write JSON to a file rather than stdout\n"
+        << "\n";
+}
+
+NS::PermutationGeneratorFactory::PermutationGeneratorUniquePtr CreateGenerator(std::string const &name, size_t maxNumPermutations) {
+    if(name == "standard")
+        return NS::StandardPermutationGeneratorFactory(maxNumPermutations).Create();
+    if(name == "distinct")
+        return NS::DistinctPermutationGeneratorFactory(maxNumPermutations).Create();
+    if(name == "heuristic")
+        return NS::HeuristicPermutationGeneratorFactory(maxNumPermutations).Create();
+    if(name == "random")
+        return NS::RandomPermutationGeneratorFactory(maxNumPermutations).Create();
+    if(name == "ranked")
+        return NS::RankedPermutationGeneratorFactory(maxNumPermutations).Create();
+    if(name == "strided")
+        return NS::StridedPermutationGeneratorFactory(maxNumPermutations).Create();
+
+    throw std::invalid_argument(boost::str(boost::format("Invalid generator '%1%'") % name));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Entry Point
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    try {
+        Benchmarks::Arguments               args(argc, argv);
+
+        if(args.Has("help")) {
+            Usage();
+            return 0;
+        }
+
+        std::vector<std::string> const      generators(args.GetValues<std::string>("generators", { "standard", "distinct", "heuristic", "random", "ranked", "strided" }));
+        std::vector<std::vector<double>> const          sweep{
+            args.GetValues<double>("requests", { 8, 12 }),
+            args.GetValues<double>("classes", { 0 })
+        };
+
+        size_t const                        maxNumPermutations(args.GetValue<size_t>("max-permutations", 100000));
+        size_t const                        batchSize(args.GetValue<size_t>("batch", 100));
+        size_t const                        repetitions(args.GetValue<size_t>("repetitions", 5));
+        std::string const                   output(args.GetValue<std::string>("output", std::string()));
+
+        args.EnsureAllUsed();
+
+        if(maxNumPermutations == 0 || batchSize == 0 || repetitions == 0)
+            throw std::invalid_argument("'--max-permutations', '--batch', and '--repetitions' must be greater than 0");
+
+        Benchmarks::Report                  report("Permutation");
+
+        for(std::string const &generatorName : generators) {
+            Benchmarks::ForEachCombination(
+                sweep,
+                [&](std::vector<double> const &values) {
+                    size_t const            numRequests(static_cast<size_t>(values[0]));
+                    size_t const            numClasses(values[1] != 0.0 ? static_cast<size_t>(values[1]) : numRequests);
+
+                    if(numRequests == 0 || numClasses > numRequests)
+                        throw std::invalid_argument("'--requests' must be greater than 0 and '--classes' must not be greater than '--requests'");
+
+                    NS::PermutationGenerator::RequestPtrs               requests;
+
+                    for(size_t index = 0; index < numRequests; ++index)
+                        requests.emplace_back(std::make_shared<PermutationRequest>(index, index % numClasses));
+
+                    Benchmarks::Metric      throughput{ "throughput", "permutations/s", true, {} };
+                    Benchmarks::Metric      numPermutations{ "permutations", "permutations", true, {} };
+                    Benchmarks::Metric      elapsed{ "elapsed", "s", false, {} };
+                    Benchmarks::Metric      allocations{ "allocations", "allocations", false, {} };
+
+                    for(size_t repetition = 0; repetition < repetitions; ++repetition) {
+                        NS::PermutationGeneratorFactory::PermutationGeneratorUniquePtr  pGenerator(CreateGenerator(generatorName, maxNumPermutations));
+                        size_t              numGenerated(0);
+                        Benchmarks::AllocationCounts const          allocationsStart(Benchmarks::GetAllocationCounts());
+                        auto const          start(std::chrono::steady_clock::now());
+
+                        while(pGenerator->IsComplete() == false)
+                            numGenerated += pGenerator->Generate(requests, batchSize).size();
+
+                        double const        seconds(Benchmarks::ToSeconds(std::chrono::steady_clock::now() - start));
+
+                        throughput.Values.emplace_back(seconds > 0.0 ? static_cast<double>(numGenerated) / seconds : std::numeric_limits<double>::quiet_NaN());
+                        numPermutations.Values.emplace_back(static_cast<double>(numGenerated));
+                        elapsed.Values.emplace_back(seconds);
+                        allocations.Values.emplace_back(static_cast<double>((Benchmarks::GetAllocationCounts() - allocationsStart).NumAllocations));
+                    }
+
+                    report.Add(
+                        Benchmarks::Parameters{
+                            { "generator", generatorName },
+                            { "requests", std::to_string(numRequests) },
+                            { "classes", std::to_string(numClasses) }
+                        },
+                        Benchmarks::Metrics{
+                            std::move(throughput),
+                            std::move(numPermutations),
+                            std::move(elapsed),
+                            std::move(allocations)
+                        }
+                    );
+                }
+            );
+        }
+
+        report.Write(output);
+        return 0;
+    }
+    catch(std::exception const &ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n\n";
+        Usage();
+        return -1;
+    }
+}
@@ -50,6 +50,23 @@ std::string CalculatedWorkingSystem::ToString(void) const /*override*/ {
     );
 }
 
+size_t CalculatedWorkingSystem::GetApproximateSize(void) const /*override*/ {
+    size_t                                  numBytes(
+        Core::Components::CalculatedWorkingSystem::GetApproximateSize()
+        + sizeof(CalculatedWorkingSystem) - sizeof(Core::Components::CalculatedWorkingSystem)
+    );
+
+    // The state is moved into the WorkingSystem during Commit
+    if(!_pImmutableState)
+        return numBytes;
+
+    // _transitionState is stored inline, so its own size is already included
+    // in sizeof(CalculatedWorkingSystem).
+    return numBytes
+        + _pImmutableState->GetApproximateSize() / static_cast<size_t>(_pImmutableState.use_count())
+        + _transitionState.GetApproximateSize() - sizeof(WorkingSystem::TransitionState);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
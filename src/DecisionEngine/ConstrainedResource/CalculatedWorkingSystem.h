@@ -63,6 +63,8 @@ public:
 
     std::string ToString(void) const override;
 
+    size_t GetApproximateSize(void) const override;
+
 private:
     // ----------------------------------------------------------------------
     // |
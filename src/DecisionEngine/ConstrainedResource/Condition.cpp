@@ -29,6 +29,10 @@ namespace ConstrainedResource {
 // |  Condition
 // |
 // ----------------------------------------------------------------------
+// virtual
+bool Condition::IsPure(void) const {
+    return false;
+}
 
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
@@ -68,6 +68,12 @@ public:
 #undef ARGS
 
     virtual Result Apply(Request const &request, Resource const &resource) const = 0;
+
+    /// Returns true if the Result of `Apply` depends only on the Request and the
+    /// state of the Resource (as identified by `Resource::GetStateHash`), in which
+    /// case Results may be cached by a `ConditionCache`. The default
+    /// implementation returns false.
+    virtual bool IsPure(void) const;
 };
 
 } // namespace ConstrainedResource
@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ConditionCache.cpp
+///  \brief         See ConditionCache.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:33:10
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "ConditionCache.h"
+#include "Condition.h"
+#include "Resource.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  ConditionCache::Statistics
+// |
+// ----------------------------------------------------------------------
+ConditionCache::Statistics::Statistics(size_t numHits, size_t numMisses, size_t numEvictions, size_t numUncacheable) :
+    NumHits(std::move(numHits)),
+    NumMisses(std::move(numMisses)),
+    NumEvictions(std::move(numEvictions)),
+    NumUncacheable(std::move(numUncacheable))
+{}
+
+float ConditionCache::Statistics::HitRate(void) const {
+    if(NumHits == 0)
+        return 0.0f;
+
+    return static_cast<float>(static_cast<double>(NumHits) / static_cast<double>(NumHits + NumMisses));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ConditionCache::Key
+// |
+// ----------------------------------------------------------------------
+bool ConditionCache::Key::operator==(Key const &other) const {
+    return pCondition == other.pCondition
+        && pRequest == other.pRequest
+        && StateHash == other.StateHash;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ConditionCache::KeyHasher
+// |
+// ----------------------------------------------------------------------
+size_t ConditionCache::KeyHasher::operator()(Key const &key) const {
+    size_t                                  result(std::hash<Condition const *>()(key.pCondition));
+
+    // Combine the values (see boost::hash_combine)
+    for(size_t value : { std::hash<Request const *>()(key.pRequest), key.StateHash })
+        result ^= value + 0x9e3779b9 + (result << 6) + (result >> 2);
+
+    // Pointer hashes are typically the addresses themselves, so the low bits
+    // (which select the shard) are mostly determined by alignment; mix the
+    // high bits into the low bits (see the MurmurHash3 finalizer).
+    std::uint64_t                           mixed(static_cast<std::uint64_t>(result));
+
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+    mixed *= 0xc4ceb9fe1a85ec53ULL;
+    mixed ^= mixed >> 33;
+
+    return static_cast<size_t>(mixed);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ConditionCache
+// |
+// ----------------------------------------------------------------------
+ConditionCache::ConditionCache(size_t maxNumEntries, size_t numShards/*=16*/) :
+    MaxNumEntries(
+        std::move(
+            [&maxNumEntries](void) -> size_t & {
+                ENSURE_ARGUMENT(maxNumEntries);
+                return maxNumEntries;
+            }()
+        )
+    ),
+    _maxNumShardEntries(
+        [this, &numShards](void) {
+            ENSURE_ARGUMENT(numShards, numShards && numShards <= MaxNumEntries);
+            return (MaxNumEntries + numShards - 1) / numShards;
+        }()
+    ),
+    _shards(
+        [&numShards](void) {
+            ShardUniquePtrs                 results;
+
+            results.reserve(numShards);
+
+            while(results.size() < numShards)
+                results.emplace_back(std::make_unique<Shard>());
+
+            return results;
+        }()
+    ),
+    _numHits(0),
+    _numMisses(0),
+    _numEvictions(0),
+    _numUncacheable(0)
+{}
+
+ConditionCache::~ConditionCache(void) = default;
+
+ConditionCache::Result ConditionCache::Apply(Condition const &condition, Request const &request, Resource const &resource) {
+    std::optional<size_t> const             stateHash(condition.IsPure() ? resource.GetStateHash() : std::nullopt);
+
+    if(!stateHash) {
+        ++_numUncacheable;
+        return condition.Apply(request, resource);
+    }
+
+    Key const                               key{ &condition, &request, *stateHash };
+    Shard &                                 shard(*_shards[KeyHasher()(key) % _shards.size()]);
+
+    {
+        std::scoped_lock<decltype(shard.Mutex)>         lock(shard.Mutex); UNUSED(lock);
+        auto const                                      iter(shard.Lookup.find(key));
+
+        if(iter != shard.Lookup.end()) {
+            shard.Entries.splice(shard.Entries.begin(), shard.Entries, iter->second);
+            ++_numHits;
+
+            return CreateResult(std::get<1>(*iter->second));
+        }
+    }
+
+    ++_numMisses;
+
+    // Apply the Condition without holding the lock, as Conditions may be
+    // expensive to evaluate. Multiple threads may evaluate the same key
+    // concurrently; the first result is cached.
+    Result                                  result(condition.Apply(request, resource));
+    Value                                   value{ result.Condition, result.IsSuccessful, result.Ratio, result.Reason };
+
+    std::scoped_lock<decltype(shard.Mutex)>             lock(shard.Mutex); UNUSED(lock);
+
+    if(shard.Lookup.find(key) != shard.Lookup.end())
+        return result;
+
+    shard.Entries.emplace_front(key, std::move(value));
+    shard.Lookup.emplace(key, shard.Entries.begin());
+
+    while(shard.Entries.size() > _maxNumShardEntries) {
+        shard.Lookup.erase(std::get<0>(shard.Entries.back()));
+        shard.Entries.pop_back();
+
+        ++_numEvictions;
+    }
+
+    return result;
+}
+
+ConditionCache::Statistics ConditionCache::GetStatistics(void) const {
+    return Statistics(_numHits, _numMisses, _numEvictions, _numUncacheable);
+}
+
+void ConditionCache::Clear(void) {
+    for(auto const &pShard : _shards) {
+        std::scoped_lock<decltype(pShard->Mutex)>       lock(pShard->Mutex); UNUSED(lock);
+
+        pShard->Lookup.clear();
+        pShard->Entries.clear();
+    }
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// static
+ConditionCache::Result ConditionCache::CreateResult(Value const &value) {
+    return Result(value.pCondition, value.IsSuccessful, value.Ratio, value.Reason);
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ConditionCache.h
+///  \brief         Contains the ConditionCache object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:33:10
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+
+#include <DecisionEngine/Core/Components/Condition.h>
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |  Forward Declarations
+class Condition;
+class Request;
+class Resource;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ConditionCache
+///  \brief         Bounded, thread-safe cache of the Results produced by
+///                 `Condition::Apply`.
+///
+///                 Results are cached only when the Condition is pure (see
+///                 `Condition::IsPure`) and the Resource provides a state hash
+///                 (see `Resource::GetStateHash`). Entries are keyed by the
+///                 identity of the Condition and Request, so the cache must be
+///                 cleared if those objects are destroyed while the cache is
+///                 still in use.
+///
+///                 Entries are distributed across independently locked shards,
+///                 each of which evicts its least recently used entries. Lazy
+///                 reasons are cached without being materialized, so their
+///                 functors must not refer to the Request or Resource (see
+///                 `Condition::Result::LazyReason`).
+///
+class ConditionCache {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Condition                         = DecisionEngine::ConstrainedResource::Condition;
+    using Request                           = DecisionEngine::ConstrainedResource::Request;
+    using Resource                          = DecisionEngine::ConstrainedResource::Resource;
+    using Result                            = Core::Components::Condition::Result;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         Statistics
+    ///  \brief         Information about the cache's effectiveness.
+    ///
+    class Statistics {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        size_t                              NumHits;
+        size_t                              NumMisses;
+        size_t                              NumEvictions;
+
+        /// Applications that couldn't be cached (the Condition isn't pure or the
+        /// Resource doesn't provide a state hash).
+        size_t                              NumUncacheable;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        Statistics(size_t numHits, size_t numMisses, size_t numEvictions, size_t numUncacheable);
+
+#define ARGS                                MEMBERS(NumHits, NumMisses, NumEvictions, NumUncacheable)
+
+        COPY(Statistics, ARGS);
+        MOVE(Statistics, ARGS);
+        COMPARE(Statistics, ARGS);
+
+#undef ARGS
+
+        /// Returns the ratio of cacheable applications that were found in the
+        /// cache, or 0 if there weren't any cacheable applications.
+        float HitRate(void) const;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            MaxNumEntries;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ConditionCache(size_t maxNumEntries, size_t numShards=16);
+    ~ConditionCache(void);
+
+    NON_COPYABLE(ConditionCache);
+    NON_MOVABLE(ConditionCache);
+
+    /// Returns the cached Result or applies the Condition (caching the Result
+    /// if possible).
+    Result Apply(Condition const &condition, Request const &request, Resource const &resource);
+
+    Statistics GetStatistics(void) const;
+
+    /// Removes all entries (statistics are preserved).
+    void Clear(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    class Key {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        Condition const *                   pCondition;
+        Request const *                     pRequest;
+        size_t                              StateHash;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        bool operator==(Key const &other) const;
+    };
+
+    class KeyHasher {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        size_t operator()(Key const &key) const;
+    };
+
+    class Value {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        Result::ConditionPtr                pCondition;
+        bool                                IsSuccessful;
+        float                               Ratio;
+        Result::LazyReason                  Reason;
+    };
+
+    using EntryList                         = std::list<std::tuple<Key, Value>>;
+
+    class Shard {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        std::mutex                          Mutex;
+
+        /// Most recently used entries are at the front
+        EntryList                           Entries;
+        std::unordered_map<Key, EntryList::iterator, KeyHasher>             Lookup;
+    };
+
+    using ShardUniquePtr                    = std::unique_ptr<Shard>;
+    using ShardUniquePtrs                   = std::vector<ShardUniquePtr>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            _maxNumShardEntries;
+    ShardUniquePtrs const                   _shards;
+
+    std::atomic<size_t>                     _numHits;
+    std::atomic<size_t>                     _numMisses;
+    std::atomic<size_t>                     _numEvictions;
+    std::atomic<size_t>                     _numUncacheable;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static Result CreateResult(Value const &value);
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
@@ -59,6 +59,11 @@ using RequestPtrsPtr                        = std::shared_ptr<RequestPtrs>;
 using RequestPtrsContainer                  = std::vector<RequestPtrs>;
 using RequestPtrsContainerPtr               = std::shared_ptr<RequestPtrsContainer>;
 
+// Permutations of a group are stored as indexes into the group's RequestPtrs
+using RequestIndex                          = std::uint32_t;
+using RequestIndexes                        = std::vector<RequestIndex>;
+using RequestIndexesPtr                     = std::shared_ptr<RequestIndexes>;
+
 using ResourcePtr                           = std::shared_ptr<Resource>;
 using ResourcePtrs                          = std::vector<ResourcePtr>;
 
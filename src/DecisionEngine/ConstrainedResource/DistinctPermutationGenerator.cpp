@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          DistinctPermutationGenerator.cpp
+///  \brief         See DistinctPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:19:35
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "DistinctPermutationGenerator.h"
+#include "Request.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  DistinctPermutationGenerator
+// |
+// ----------------------------------------------------------------------
+DistinctPermutationGenerator::DistinctPermutationGenerator(size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/) :
+    PermutationGenerator(std::move(maxNumPermutations))
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+DistinctPermutationGenerator::RequestIndexesPtrs DistinctPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    size_t const                            numRequests(requests.size());
+
+    // Each Request belongs to the class of the first Request that it is equivalent to;
+    // classMembers[classIndex] is empty for indexes that don't identify a class.
+    std::vector<RequestIndexes>             classMembers(numRequests);
+
+    for(RequestIndex index = 0; index < numRequests; ++index) {
+        RequestIndex                        classIndex(0);
+
+        while(
+            classIndex < index
+            && (
+                classMembers[classIndex].empty()
+                || requests[classIndex]->IsEquivalent(*requests[index]) == false
+            )
+        )
+            ++classIndex;
+
+        classMembers[classIndex].emplace_back(index);
+    }
+
+    if(_classIndexes.empty()) {
+        _classIndexes.reserve(numRequests);
+
+        for(RequestIndex classIndex = 0; classIndex < numRequests; ++classIndex)
+            _classIndexes.insert(_classIndexes.end(), classMembers[classIndex].size(), classIndex);
+    }
+
+    assert(_classIndexes.size() == numRequests);
+
+    RequestIndexesPtrs                      results;
+    std::vector<size_t>                     classOffsets(numRequests);
+
+    while(maxNumPermutations--) {
+        RequestIndexes                      theseResults;
+
+        theseResults.reserve(numRequests);
+        std::fill(classOffsets.begin(), classOffsets.end(), 0);
+
+        for(auto classIndex : _classIndexes) {
+            assert(classIndex < numRequests);
+            assert(classOffsets[classIndex] < classMembers[classIndex].size());
+
+            theseResults.emplace_back(classMembers[classIndex][classOffsets[classIndex]++]);
+        }
+
+        results.emplace_back(std::make_shared<RequestIndexes>(std::move(theseResults)));
+
+        // `std::next_permutation` skips orderings that are equal to ones already
+        // generated, so equivalent Requests never produce duplicate orderings.
+        if(std::next_permutation(_classIndexes.begin(), _classIndexes.end()) == false) {
+            assert(_isActive);
+            _isActive = false;
+
+            break;
+        }
+    }
+
+    return results;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::DistinctPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::DistinctPermutationGeneratorFactory);
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          DistinctPermutationGenerator.h
+///  \brief         Contains the DistinctPermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:19:35
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DistinctPermutationGenerator
+///  \brief         PermutationGenerator that treats equivalent Requests (see
+///                 `Request::IsEquivalent`) as interchangeable and only
+///                 generates orderings that are distinct when equivalent
+///                 Requests are considered to be the same.
+///
+///                 A group with k equivalent Requests generates k! fewer
+///                 orderings than `StandardPermutationGenerator`. Equivalent
+///                 Requests always appear in the order in which they appear
+///                 in the group.
+///
+class DistinctPermutationGenerator : public PermutationGenerator {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+
+    // The equivalence class of the Request at each position, where a class is
+    // identified by the index of its first Request.
+    RequestIndexes                          _classIndexes;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    DistinctPermutationGenerator(size_t maxNumPermutations=std::numeric_limits<size_t>::max());
+    ~DistinctPermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_classIndexes), BASES(PermutationGenerator)
+
+    NON_COPYABLE(DistinctPermutationGenerator);
+    MOVE(DistinctPermutationGenerator, ARGS);
+    COMPARE(DistinctPermutationGenerator, ARGS);
+    SERIALIZATION(DistinctPermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DistinctPermutationGeneratorFactory
+///  \brief         Factory that generates DistinctPermutationGenerator instances
+///
+class DistinctPermutationGeneratorFactory : public PermutationGeneratorFactoryImpl<DistinctPermutationGenerator>
+{
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using BaseType                          = PermutationGeneratorFactoryImpl<DistinctPermutationGenerator>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using BaseType::BaseType;
+
+#define ARGS                                BASES(BaseType)
+
+    NON_COPYABLE(DistinctPermutationGeneratorFactory);
+    MOVE(DistinctPermutationGeneratorFactory, ARGS);
+    COMPARE(DistinctPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(DistinctPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::DistinctPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::DistinctPermutationGeneratorFactory);
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          HeuristicPermutationGenerator.cpp
+///  \brief         See HeuristicPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "HeuristicPermutationGenerator.h"
+#include "Request.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  HeuristicPermutationGenerator
+// |
+// ----------------------------------------------------------------------
+HeuristicPermutationGenerator::HeuristicPermutationGenerator(size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/) :
+    PermutationGenerator(std::move(maxNumPermutations))
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+HeuristicPermutationGenerator::RequestIndexesPtrs HeuristicPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    if(_priorityOrder.empty()) {
+        size_t const                        numRequests(requests.size());
+
+        _priorityOrder.reserve(numRequests);
+        _positions.reserve(numRequests);
+
+        for(RequestIndex index = 0; index < numRequests; ++index) {
+            _priorityOrder.emplace_back(index);
+            _positions.emplace_back(index);
+        }
+
+        std::vector<float>                  priorities;
+
+        priorities.reserve(numRequests);
+
+        for(auto const &pRequest : requests)
+            priorities.emplace_back(pRequest->GetPriority());
+
+        std::stable_sort(
+            _priorityOrder.begin(),
+            _priorityOrder.end(),
+            [&priorities](RequestIndex a, RequestIndex b) {
+                return priorities[a] > priorities[b];
+            }
+        );
+    }
+
+    assert(_priorityOrder.size() == requests.size());
+    assert(_positions.size() == requests.size());
+
+    RequestIndexesPtrs                      results;
+
+    while(maxNumPermutations--) {
+        RequestIndexes                      theseResults;
+
+        theseResults.reserve(_positions.size());
+
+        for(auto position : _positions)
+            theseResults.emplace_back(_priorityOrder[position]);
+
+        results.emplace_back(std::make_shared<RequestIndexes>(std::move(theseResults)));
+
+        if(std::next_permutation(_positions.begin(), _positions.end()) == false) {
+            assert(_isActive);
+            _isActive = false;
+
+            break;
+        }
+    }
+
+    return results;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::HeuristicPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::HeuristicPermutationGeneratorFactory);
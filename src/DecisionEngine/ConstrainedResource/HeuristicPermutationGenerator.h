@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          HeuristicPermutationGenerator.h
+///  \brief         Contains the HeuristicPermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HeuristicPermutationGenerator
+///  \brief         PermutationGenerator that begins with the Requests ordered
+///                 by priority (see `Request::GetPriority`) and permutes that
+///                 ordering lexicographically.
+///
+///                 The first permutation applies the highest priority Requests
+///                 first, and the highest priority Requests remain at the front
+///                 of subsequent permutations for as long as possible; a limited
+///                 number of permutations explores variations of the least
+///                 important Requests. Requests with the same priority retain
+///                 their original order.
+///
+class HeuristicPermutationGenerator : public PermutationGenerator {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexes                          _priorityOrder;
+    RequestIndexes                          _positions;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HeuristicPermutationGenerator(size_t maxNumPermutations=std::numeric_limits<size_t>::max());
+    ~HeuristicPermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_priorityOrder, _positions), BASES(PermutationGenerator)
+
+    NON_COPYABLE(HeuristicPermutationGenerator);
+    MOVE(HeuristicPermutationGenerator, ARGS);
+    COMPARE(HeuristicPermutationGenerator, ARGS);
+    SERIALIZATION(HeuristicPermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HeuristicPermutationGeneratorFactory
+///  \brief         Factory that generates HeuristicPermutationGenerator instances
+///
+class HeuristicPermutationGeneratorFactory : public PermutationGeneratorFactoryImpl<HeuristicPermutationGenerator>
+{
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using BaseType                          = PermutationGeneratorFactoryImpl<HeuristicPermutationGenerator>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using BaseType::BaseType;
+
+#define ARGS                                BASES(BaseType)
+
+    NON_COPYABLE(HeuristicPermutationGeneratorFactory);
+    MOVE(HeuristicPermutationGeneratorFactory, ARGS);
+    COMPARE(HeuristicPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(HeuristicPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::HeuristicPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::HeuristicPermutationGeneratorFactory);
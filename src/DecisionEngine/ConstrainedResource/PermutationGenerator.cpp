@@ -45,15 +45,20 @@ bool PermutationGenerator::IsComplete(void) const {
     return _isActive == false;
 }
 
-PermutationGenerator::RequestPtrsPtrs PermutationGenerator::Generate(RequestPtrs const &requests, size_t maxNumPermutations) {
-    ENSURE_ARGUMENT(requests, requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+PermutationGenerator::RequestIndexesPtrs PermutationGenerator::Generate(RequestPtrs const &requests, size_t maxNumPermutations) {
+    ENSURE_ARGUMENT(
+        requests,
+        requests.empty() == false
+        && requests.size() <= std::numeric_limits<RequestIndex>::max()
+        && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); })
+    );
     ENSURE_ARGUMENT(maxNumPermutations);
 
     if(IsComplete())
         throw std::runtime_error("Invalid operation");
 
     size_t const                            permutationsToGenerate(std::min(_permutationsRemaining, maxNumPermutations));
-    RequestPtrsPtrs                         results(GenerateImpl(requests, permutationsToGenerate));
+    RequestIndexesPtrs                      results(GenerateImpl(requests, permutationsToGenerate));
 
     if(
         results.empty()
@@ -61,20 +66,20 @@ PermutationGenerator::RequestPtrsPtrs PermutationGenerator::Generate(RequestPtrs
         || std::any_of(
             results.cbegin(),
             results.cend(),
-            [](RequestPtrsPtr const &ptrs) {
-                return !ptrs
-                    || ptrs->empty()
+            [&requests](RequestIndexesPtr const &ptr) {
+                return !ptr
+                    || ptr->size() != requests.size()
                     || std::any_of(
-                        ptrs->cbegin(),
-                        ptrs->cend(),
-                        [](RequestPtr const &ptr) {
-                            return static_cast<bool>(ptr) == false;
+                        ptr->cbegin(),
+                        ptr->cend(),
+                        [&requests](RequestIndex index) {
+                            return index >= requests.size();
                         }
                     );
             }
         )
     )
-        throw std::runtime_error("Invalid RequestPtrsPtrs");
+        throw std::runtime_error("Invalid RequestIndexesPtrs");
 
     _permutationsRemaining -= permutationsToGenerate;
     if(_permutationsRemaining == 0)
@@ -59,9 +59,11 @@ public:
     // ----------------------------------------------------------------------
     using RequestPtr                        = DecisionEngine::ConstrainedResource::RequestPtr;
     using RequestPtrs                       = DecisionEngine::ConstrainedResource::RequestPtrs;
-    using RequestPtrsPtr                    = DecisionEngine::ConstrainedResource::RequestPtrsPtr;
+    using RequestIndex                      = DecisionEngine::ConstrainedResource::RequestIndex;
+    using RequestIndexes                    = DecisionEngine::ConstrainedResource::RequestIndexes;
+    using RequestIndexesPtr                 = DecisionEngine::ConstrainedResource::RequestIndexesPtr;
 
-    using RequestPtrsPtrs                   = std::vector<RequestPtrsPtr>;
+    using RequestIndexesPtrs                = std::vector<RequestIndexesPtr>;
 
     // ----------------------------------------------------------------------
     // |
@@ -82,7 +84,9 @@ public:
 
     bool IsComplete(void) const;
 
-    RequestPtrsPtrs Generate(RequestPtrs const &requests, size_t maxNumPermutations);
+    /// Returns permutations of `requests`, where each permutation contains the
+    /// index of each Request within `requests`.
+    RequestIndexesPtrs Generate(RequestPtrs const &requests, size_t maxNumPermutations);
 
 private:
     // ----------------------------------------------------------------------
@@ -90,7 +94,7 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    virtual RequestPtrsPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) = 0;
+    virtual RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) = 0;
 };
 
 } // namespace ConstrainedResource
@@ -50,6 +50,11 @@ PermutationGeneratorFactory::PermutationGeneratorUniquePtr PermutationGeneratorF
     return result;
 }
 
+// virtual
+bool PermutationGeneratorFactory::IsIncremental(void) const {
+    return false;
+}
+
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
 
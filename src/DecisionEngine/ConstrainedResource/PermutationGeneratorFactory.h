@@ -71,6 +71,14 @@ public:
 
     PermutationGeneratorUniquePtr Create(void) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            IsIncremental
+    ///  \brief         Returns true if orderings should be built one Request at
+    ///                 a time as part of the search rather than generated up
+    ///                 front (see `IncrementalPermutationGeneratorFactory`).
+    ///
+    virtual bool IsIncremental(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PrecedencePermutationGenerator.cpp
+///  \brief         See PrecedencePermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:30:34
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "PrecedencePermutationGenerator.h"
+#include "Request.h"
+
+#include <unordered_map>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/// The Requests that must be applied before each Request
+using Predecessors                          = std::vector<RequestIndexes>;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+Predecessors CreatePredecessors(RequestPtrs const &requests, PrecedencePermutationGenerator::Constraints const &constraints) {
+    std::unordered_map<std::string, RequestIndexes>     nameIndexes;
+
+    for(RequestIndex index = 0; index < requests.size(); ++index)
+        nameIndexes[requests[index]->Name].emplace_back(index);
+
+    Predecessors                            results(requests.size());
+
+    for(auto const &constraint : constraints) {
+        auto const                          beforeIter(nameIndexes.find(constraint.Before));
+
+        if(beforeIter == nameIndexes.end())
+            continue;
+
+        auto const                          afterIter(nameIndexes.find(constraint.After));
+
+        if(afterIter == nameIndexes.end())
+            continue;
+
+        for(auto after : afterIter->second)
+            results[after].insert(results[after].end(), beforeIter->second.cbegin(), beforeIter->second.cend());
+    }
+
+    return results;
+}
+
+/// Places the smallest available Request at each position starting at
+/// `position`; returns false if no Request is available (which means that
+/// the constraints contain a cycle).
+bool Complete(RequestIndexes &indexes, std::vector<bool> &placed, Predecessors const &predecessors, size_t position) {
+    for(; position < indexes.size(); ++position) {
+        RequestIndex                        index(0);
+
+        while(
+            index < indexes.size()
+            && (
+                placed[index]
+                || std::any_of(predecessors[index].cbegin(), predecessors[index].cend(), [&placed](RequestIndex predecessor) { return placed[predecessor] == false; })
+            )
+        )
+            ++index;
+
+        if(index == indexes.size())
+            return false;
+
+        indexes[position] = index;
+        placed[index] = true;
+    }
+
+    return true;
+}
+
+/// Updates `indexes` to the next linear extension in lexicographic order;
+/// returns false if `indexes` is the last linear extension.
+bool NextLinearExtension(RequestIndexes &indexes, Predecessors const &predecessors) {
+    std::vector<bool>                       placed(indexes.size(), true);
+    size_t                                  position(indexes.size());
+
+    while(position-- != 0) {
+        // The Requests before `position` remain in place
+        placed[indexes[position]] = false;
+
+        for(RequestIndex index = indexes[position] + 1; index < indexes.size(); ++index) {
+            if(
+                placed[index]
+                || std::any_of(predecessors[index].cbegin(), predecessors[index].cend(), [&placed](RequestIndex predecessor) { return placed[predecessor] == false; })
+            )
+                continue;
+
+            indexes[position] = index;
+            placed[index] = true;
+
+            // A prefix of a linear extension can always be completed
+            bool const                      result(Complete(indexes, placed, predecessors, position + 1));
+
+            assert(result);
+            UNUSED(result);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  PrecedencePermutationGenerator
+// |
+// ----------------------------------------------------------------------
+PrecedencePermutationGenerator::PrecedencePermutationGenerator(ConstraintsPtr pConstraints, size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/) :
+    PermutationGenerator(std::move(maxNumPermutations)),
+    _pConstraints(
+        std::move(
+            [&pConstraints](void) -> ConstraintsPtr & {
+                ENSURE_ARGUMENT(
+                    pConstraints,
+                    pConstraints
+                    && std::all_of(
+                        pConstraints->cbegin(),
+                        pConstraints->cend(),
+                        [](Constraint const &constraint) {
+                            return constraint.Before.empty() == false
+                                && constraint.After.empty() == false
+                                && constraint.Before != constraint.After;
+                        }
+                    )
+                );
+                return pConstraints;
+            }()
+        )
+    )
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+PrecedencePermutationGenerator::RequestIndexesPtrs PrecedencePermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    Predecessors const                      predecessors(CreatePredecessors(requests, *_pConstraints));
+
+    if(_indexes.empty()) {
+        std::vector<bool>                   placed(requests.size(), false);
+
+        _indexes.resize(requests.size());
+
+        if(Complete(_indexes, placed, predecessors, 0) == false) {
+            _indexes.clear();
+            throw std::runtime_error("Invalid precedence constraints");
+        }
+    }
+
+    assert(_indexes.size() == requests.size());
+
+    RequestIndexesPtrs                      results;
+
+    while(maxNumPermutations--) {
+        results.emplace_back(std::make_shared<RequestIndexes>(_indexes));
+
+        if(NextLinearExtension(_indexes, predecessors) == false) {
+            assert(_isActive);
+            _isActive = false;
+
+            break;
+        }
+    }
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  PrecedencePermutationGeneratorFactory
+// |
+// ----------------------------------------------------------------------
+PrecedencePermutationGeneratorFactory::PrecedencePermutationGeneratorFactory(ConstraintsPtr pConstraints, size_t maxNumTotalPermutations/*=std::numeric_limits<size_t>::max()*/) :
+    PermutationGeneratorFactory(std::move(maxNumTotalPermutations)),
+    _pConstraints(
+        std::move(
+            [&pConstraints](void) -> ConstraintsPtr & {
+                ENSURE_ARGUMENT(pConstraints);
+                return pConstraints;
+            }()
+        )
+    )
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+PrecedencePermutationGeneratorFactory::PermutationGeneratorUniquePtr PrecedencePermutationGeneratorFactory::CreateImpl(size_t maxNumTotalPermutations) const /*override*/ {
+    return std::make_unique<PrecedencePermutationGenerator>(_pConstraints, maxNumTotalPermutations);
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::PrecedencePermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::PrecedencePermutationGeneratorFactory);
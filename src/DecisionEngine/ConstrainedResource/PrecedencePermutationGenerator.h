@@ -0,0 +1,170 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PrecedencePermutationGenerator.h
+///  \brief         Contains the PrecedencePermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:30:34
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PrecedencePermutationGenerator
+///  \brief         PermutationGenerator that only generates orderings that
+///                 satisfy a set of precedence constraints (the linear
+///                 extensions of the partial order), in lexicographic order.
+///
+///                 Constraints refer to Requests by name; a constraint applies
+///                 to every Request in the group with that name, and
+///                 constraints that refer to Requests that aren't in the group
+///                 are ignored. An exception is thrown if the constraints that
+///                 apply to a group contain a cycle.
+///
+class PrecedencePermutationGenerator : public PermutationGenerator {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         Constraint
+    ///  \brief         The Request named `Before` must be applied before the
+    ///                 Request named `After`.
+    ///
+    class Constraint {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        std::string                         Before;
+        std::string                         After;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        Constraint(void) = default;
+
+#define ARGS                                MEMBERS(Before, After)
+
+        CONSTRUCTOR(Constraint, ARGS);
+        COPY(Constraint, ARGS);
+        MOVE(Constraint, ARGS);
+        COMPARE(Constraint, ARGS);
+        SERIALIZATION(Constraint, ARGS);
+
+#undef ARGS
+    };
+
+    using Constraints                       = std::vector<Constraint>;
+    using ConstraintsPtr                    = std::shared_ptr<Constraints>;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    ConstraintsPtr                          _pConstraints;
+    RequestIndexes                          _indexes;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    PrecedencePermutationGenerator(ConstraintsPtr pConstraints, size_t maxNumPermutations=std::numeric_limits<size_t>::max());
+    ~PrecedencePermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_pConstraints, _indexes), BASES(PermutationGenerator)
+
+    NON_COPYABLE(PrecedencePermutationGenerator);
+    MOVE(PrecedencePermutationGenerator, ARGS);
+    COMPARE(PrecedencePermutationGenerator, ARGS);
+    SERIALIZATION(PrecedencePermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PrecedencePermutationGeneratorFactory
+///  \brief         Factory that generates PrecedencePermutationGenerator
+///                 instances that share the same constraints.
+///
+class PrecedencePermutationGeneratorFactory : public PermutationGeneratorFactory {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ConstraintsPtr                    = PrecedencePermutationGenerator::ConstraintsPtr;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    ConstraintsPtr const                    _pConstraints;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    PrecedencePermutationGeneratorFactory(ConstraintsPtr pConstraints, size_t maxNumTotalPermutations=std::numeric_limits<size_t>::max());
+    ~PrecedencePermutationGeneratorFactory(void) override = default;
+
+#define ARGS                                MEMBERS(_pConstraints), BASES(PermutationGeneratorFactory)
+
+    NON_COPYABLE(PrecedencePermutationGeneratorFactory);
+    MOVE(PrecedencePermutationGeneratorFactory, ARGS);
+    COMPARE(PrecedencePermutationGeneratorFactory, ARGS);
+    SERIALIZATION(PrecedencePermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    PermutationGeneratorUniquePtr CreateImpl(size_t maxNumTotalPermutations) const override;
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::PrecedencePermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::PrecedencePermutationGeneratorFactory);
@@ -0,0 +1,603 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ProblemSnapshot.cpp
+///  \brief         See ProblemSnapshot.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:08:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "ProblemSnapshot.h"
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+// The file is organized as a `Header` followed by the sections that it
+// references; each section is 8-byte aligned so that it can be accessed
+// directly from the mapped memory.
+struct ProblemSnapshot::Header {
+    char                                    Magic[8];
+    std::uint32_t                           Version;
+    std::uint32_t                           ByteOrder;
+    std::uint64_t                           FileSize;
+
+    std::uint64_t                           NumConditions;
+    std::uint64_t                           NumGroups;
+    std::uint64_t                           NumRequests;
+    std::uint64_t                           NumConditionLists;
+    std::uint64_t                           NumConditionIndexes;
+
+    std::uint64_t                           ConditionsOffset;               /// ConditionRecord[NumConditions]
+    std::uint64_t                           GroupsOffset;                   /// std::uint64_t[NumGroups + 1]; the first request in each group
+    std::uint64_t                           RequestsOffset;                 /// RequestRecord[NumRequests]
+    std::uint64_t                           ConditionListsOffset;           /// std::uint64_t[NumConditionLists + 1]; the first index in each list
+    std::uint64_t                           ConditionIndexesOffset;         /// ConditionIndex[NumConditionIndexes]
+    std::uint64_t                           StringsOffset;
+    std::uint64_t                           StringsSize;
+    std::uint64_t                           ResourceOffset;                 /// boost binary archive
+    std::uint64_t                           ResourceSize;
+};
+
+struct ProblemSnapshot::RequestRecord {
+    std::uint64_t                           NameOffset;
+    std::uint32_t                           NameLength;
+    std::uint32_t                           ConditionLists[3];              /// Applicability, Requirement, Preference
+};
+
+struct ProblemSnapshot::ConditionRecord {
+    std::uint64_t                           NameOffset;
+    std::uint32_t                           NameLength;
+    std::uint16_t                           MaxScore;
+    std::uint16_t                           Reserved;
+};
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Data
+// |
+// ----------------------------------------------------------------------
+char const                                  Magic[8] = { 'D', 'E', 'C', 'R', 'S', 'N', 'A', 'P' };
+std::uint32_t const                         Version = 1;
+std::uint32_t const                         ByteOrder = 0x01020304;
+
+std::uint32_t const                         NoConditionList = std::numeric_limits<std::uint32_t>::max();
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Methods
+// |
+// ----------------------------------------------------------------------
+std::uint64_t Align(std::uint64_t offset) {
+    return (offset + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+template <typename T>
+bool IsValidSection(std::uint64_t fileSize, std::uint64_t offset, std::uint64_t numItems) {
+    return offset % alignof(T) == 0
+        && offset <= fileSize
+        && numItems <= (fileSize - offset) / sizeof(T)
+    ;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  ProblemSnapshot::ConditionIndexes
+// |
+// ----------------------------------------------------------------------
+ProblemSnapshot::ConditionIndexes::ConditionIndexes(void) :
+    _pBegin(nullptr),
+    _pEnd(nullptr)
+{}
+
+ProblemSnapshot::ConditionIndexes::ConditionIndexes(ConditionIndex const *pBegin, ConditionIndex const *pEnd) :
+    _pBegin(pBegin),
+    _pEnd(pEnd)
+{}
+
+ProblemSnapshot::ConditionIndex const * ProblemSnapshot::ConditionIndexes::begin(void) const {
+    return _pBegin;
+}
+
+ProblemSnapshot::ConditionIndex const * ProblemSnapshot::ConditionIndexes::end(void) const {
+    return _pEnd;
+}
+
+size_t ProblemSnapshot::ConditionIndexes::size(void) const {
+    return static_cast<size_t>(_pEnd - _pBegin);
+}
+
+bool ProblemSnapshot::ConditionIndexes::empty(void) const {
+    return _pBegin == _pEnd;
+}
+
+ProblemSnapshot::ConditionIndex ProblemSnapshot::ConditionIndexes::operator[](size_t index) const {
+    assert(index < size());
+    return _pBegin[index];
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ProblemSnapshot::RequestView
+// |
+// ----------------------------------------------------------------------
+ProblemSnapshot::RequestView::RequestView(
+    std::string_view name,
+    ConditionIndexes applicabilityConditions,
+    ConditionIndexes requirementConditions,
+    ConditionIndexes preferenceConditions
+) :
+    Name(name),
+    ApplicabilityConditions(applicabilityConditions),
+    RequirementConditions(requirementConditions),
+    PreferenceConditions(preferenceConditions)
+{}
+
+// ----------------------------------------------------------------------
+// |
+// |  ProblemSnapshot
+// |
+// ----------------------------------------------------------------------
+// static
+void ProblemSnapshot::Write(
+    std::filesystem::path const &filename,
+    ConditionPtrs const &conditions,
+    RequestPtrsContainer const &requestsContainer,
+    ResourcePtr const &pInitialResource
+) {
+    static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<RequestRecord> && std::is_trivially_copyable_v<ConditionRecord>);
+    static_assert(sizeof(RequestRecord) == 24 && sizeof(ConditionRecord) == 16);
+
+    ENSURE_ARGUMENT(conditions, conditions.size() < NoConditionList && std::all_of(conditions.cbegin(), conditions.cend(), [](ConditionPtr const &ptr) { return static_cast<bool>(ptr); }));
+    ENSURE_ARGUMENT(pInitialResource);
+
+    std::string                             strings;
+
+    // Conditions
+    std::unordered_map<Condition const *, ConditionIndex>                   conditionLookup;
+    std::vector<ConditionRecord>            conditionRecords;
+
+    conditionRecords.reserve(conditions.size());
+
+    for(ConditionPtr const &pCondition : conditions) {
+        ENSURE_ARGUMENT(conditions, conditionLookup.emplace(pCondition.get(), static_cast<ConditionIndex>(conditionRecords.size())).second);
+
+        conditionRecords.emplace_back(ConditionRecord{ strings.size(), static_cast<std::uint32_t>(pCondition->Name.size()), pCondition->MaxScore, 0 });
+        strings += pCondition->Name;
+    }
+
+    // Condition lists; requests that reference the same conditions share a list
+    std::map<std::vector<ConditionIndex>, std::uint32_t>                    listLookup;
+    std::vector<std::uint64_t>              listBegins{ 0 };
+    std::vector<ConditionIndex>             conditionIndexes;
+
+    auto const                              addList(
+        [&](ConditionPtrsPtr const &pConditions) -> std::uint32_t {
+            if(!pConditions)
+                return NoConditionList;
+
+            std::vector<ConditionIndex>     list;
+
+            list.reserve(pConditions->size());
+
+            for(ConditionPtr const &pCondition : *pConditions) {
+                auto const                  iter(conditionLookup.find(pCondition.get()));
+
+                ENSURE_ARGUMENT(conditions, iter != conditionLookup.end());
+                list.emplace_back(iter->second);
+            }
+
+            auto const                      result(listLookup.emplace(list, static_cast<std::uint32_t>(listLookup.size())));
+
+            if(result.second) {
+                std::copy(list.cbegin(), list.cend(), std::back_inserter(conditionIndexes));
+                listBegins.emplace_back(conditionIndexes.size());
+            }
+
+            return result.first->second;
+        }
+    );
+
+    // Requests
+    std::vector<std::uint64_t>              groups{ 0 };
+    std::vector<RequestRecord>              requests;
+
+    for(RequestPtrs const &requestPtrs : requestsContainer) {
+        for(RequestPtr const &pRequest : requestPtrs) {
+            ENSURE_ARGUMENT(requestsContainer, pRequest && typeid(*pRequest) == typeid(Request));
+
+            RequestRecord                   record{ strings.size(), static_cast<std::uint32_t>(pRequest->Name.size()), {} };
+
+            record.ConditionLists[0] = addList(pRequest->OptionalApplicabilityConditions);
+            record.ConditionLists[1] = addList(pRequest->OptionalRequirementConditions);
+            record.ConditionLists[2] = addList(pRequest->OptionalPreferenceConditions);
+
+            requests.emplace_back(record);
+            strings += pRequest->Name;
+        }
+
+        groups.emplace_back(requests.size());
+    }
+
+    // Resource
+    std::string                             resource;
+
+    {
+        std::ostringstream                  stream;
+
+        {
+            boost::archive::binary_oarchive archive(stream);
+
+            archive << pInitialResource;
+        }
+
+        resource = stream.str();
+    }
+
+    // Layout
+    Header                                  header;
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.Magic, Magic, sizeof(Magic));
+
+    header.Version = Version;
+    header.ByteOrder = ByteOrder;
+
+    header.NumConditions = conditionRecords.size();
+    header.NumGroups = requestsContainer.size();
+    header.NumRequests = requests.size();
+    header.NumConditionLists = listBegins.size() - 1;
+    header.NumConditionIndexes = conditionIndexes.size();
+
+    std::uint64_t                           offset(Align(sizeof(Header)));
+
+    auto const                              reserveSection(
+        [&offset](std::uint64_t &sectionOffset, std::uint64_t numBytes) {
+            sectionOffset = offset;
+            offset = Align(offset + numBytes);
+        }
+    );
+
+    reserveSection(header.ConditionsOffset, conditionRecords.size() * sizeof(ConditionRecord));
+    reserveSection(header.GroupsOffset, groups.size() * sizeof(std::uint64_t));
+    reserveSection(header.RequestsOffset, requests.size() * sizeof(RequestRecord));
+    reserveSection(header.ConditionListsOffset, listBegins.size() * sizeof(std::uint64_t));
+    reserveSection(header.ConditionIndexesOffset, conditionIndexes.size() * sizeof(ConditionIndex));
+    reserveSection(header.StringsOffset, strings.size());
+    reserveSection(header.ResourceOffset, resource.size());
+
+    header.StringsSize = strings.size();
+    header.ResourceSize = resource.size();
+    header.FileSize = offset;
+
+    // Write to a temporary file so that readers never see a partially written snapshot
+    std::filesystem::path                   tempFilename(filename);
+
+    tempFilename += ".tmp";
+
+    {
+        std::ofstream                       stream(tempFilename, std::ios::binary | std::ios::trunc);
+
+        if(!stream)
+            throw std::runtime_error("Invalid snapshot file");
+
+        auto const                          writeSection(
+            [&stream](std::uint64_t sectionOffset, void const *pData, size_t numBytes) {
+                static char const           padding[8] = {};
+
+                std::uint64_t const         position(static_cast<std::uint64_t>(stream.tellp()));
+
+                assert(position <= sectionOffset && sectionOffset - position < sizeof(padding));
+                stream.write(padding, static_cast<std::streamsize>(sectionOffset - position));
+
+                if(numBytes)
+                    stream.write(static_cast<char const *>(pData), static_cast<std::streamsize>(numBytes));
+            }
+        );
+
+        writeSection(0, &header, sizeof(header));
+        writeSection(header.ConditionsOffset, conditionRecords.data(), conditionRecords.size() * sizeof(ConditionRecord));
+        writeSection(header.GroupsOffset, groups.data(), groups.size() * sizeof(std::uint64_t));
+        writeSection(header.RequestsOffset, requests.data(), requests.size() * sizeof(RequestRecord));
+        writeSection(header.ConditionListsOffset, listBegins.data(), listBegins.size() * sizeof(std::uint64_t));
+        writeSection(header.ConditionIndexesOffset, conditionIndexes.data(), conditionIndexes.size() * sizeof(ConditionIndex));
+        writeSection(header.StringsOffset, strings.data(), strings.size());
+        writeSection(header.ResourceOffset, resource.data(), resource.size());
+        writeSection(header.FileSize, nullptr, 0);
+
+        if(!stream)
+            throw std::runtime_error("Invalid snapshot file");
+    }
+
+    std::filesystem::rename(tempFilename, filename);
+}
+
+ProblemSnapshot::ProblemSnapshot(std::filesystem::path const &filename, ConditionPtrs conditions) :
+    _conditions(
+        std::move(
+            [&conditions](void) -> ConditionPtrs & {
+                ENSURE_ARGUMENT(conditions, std::all_of(conditions.cbegin(), conditions.cend(), [](ConditionPtr const &ptr) { return static_cast<bool>(ptr); }));
+                return conditions;
+            }()
+        )
+    ),
+    _mapping(filename.string().c_str(), boost::interprocess::read_only),
+    _region(_mapping, boost::interprocess::read_only),
+    _pHeader(&Validate(_region, _conditions)),
+    _pInitialResource(
+        [this](void) {
+            std::istringstream              stream(std::string(GetSection<char>(_pHeader->ResourceOffset), static_cast<size_t>(_pHeader->ResourceSize)));
+            ResourcePtr                     pResource;
+
+            try {
+                boost::archive::binary_iarchive         archive(stream);
+
+                archive >> pResource;
+            }
+            catch(boost::archive::archive_exception const &) {
+                throw std::runtime_error("Invalid snapshot file");
+            }
+
+            if(!pResource)
+                throw std::runtime_error("Invalid snapshot file");
+
+            return pResource;
+        }()
+    )
+{}
+
+ConditionPtrs const & ProblemSnapshot::GetConditions(void) const {
+    return _conditions;
+}
+
+ResourcePtr const & ProblemSnapshot::GetInitialResource(void) const {
+    return _pInitialResource;
+}
+
+size_t ProblemSnapshot::GetNumGroups(void) const {
+    return static_cast<size_t>(_pHeader->NumGroups);
+}
+
+size_t ProblemSnapshot::GetNumRequests(void) const {
+    return static_cast<size_t>(_pHeader->NumRequests);
+}
+
+size_t ProblemSnapshot::GetNumRequests(size_t group) const {
+    ENSURE_ARGUMENT(group, group < GetNumGroups());
+
+    std::uint64_t const * const             pGroups(GetSection<std::uint64_t>(_pHeader->GroupsOffset));
+
+    return static_cast<size_t>(pGroups[group + 1] - pGroups[group]);
+}
+
+ProblemSnapshot::RequestView ProblemSnapshot::GetRequest(size_t group, size_t index) const {
+    ENSURE_ARGUMENT(index, index < GetNumRequests(group));
+
+    RequestRecord const &                   record(GetSection<RequestRecord>(_pHeader->RequestsOffset)[GetSection<std::uint64_t>(_pHeader->GroupsOffset)[group] + index]);
+
+    return RequestView(
+        GetString(record.NameOffset, record.NameLength),
+        GetConditionList(record.ConditionLists[0]),
+        GetConditionList(record.ConditionLists[1]),
+        GetConditionList(record.ConditionLists[2])
+    );
+}
+
+RequestPtrsContainerPtr ProblemSnapshot::CreateRequests(void) const {
+    std::vector<ConditionPtrsPtr>           lists(static_cast<size_t>(_pHeader->NumConditionLists));
+
+    auto const                              getList(
+        [this, &lists](std::uint32_t list) -> ConditionPtrsPtr {
+            if(list == NoConditionList)
+                return ConditionPtrsPtr();
+
+            ConditionPtrsPtr &              pConditions(lists[list]);
+
+            if(!pConditions) {
+                ConditionIndexes const      indexes(GetConditionList(list));
+
+                pConditions = std::make_shared<ConditionPtrs>();
+                pConditions->reserve(indexes.size());
+
+                for(ConditionIndex conditionIndex : indexes)
+                    pConditions->emplace_back(_conditions[conditionIndex]);
+            }
+
+            return pConditions;
+        }
+    );
+
+    std::uint64_t const * const             pGroups(GetSection<std::uint64_t>(_pHeader->GroupsOffset));
+    RequestRecord const * const             pRequests(GetSection<RequestRecord>(_pHeader->RequestsOffset));
+
+    RequestPtrsContainerPtr                 pResult(std::make_shared<RequestPtrsContainer>());
+
+    pResult->reserve(GetNumGroups());
+
+    for(size_t group = 0; group < GetNumGroups(); ++group) {
+        RequestPtrs                         requests;
+
+        requests.reserve(static_cast<size_t>(pGroups[group + 1] - pGroups[group]));
+
+        for(std::uint64_t index = pGroups[group]; index < pGroups[group + 1]; ++index) {
+            RequestRecord const &           record(pRequests[index]);
+
+            requests.emplace_back(
+                std::make_shared<Request>(
+                    std::string(GetString(record.NameOffset, record.NameLength)),
+                    getList(record.ConditionLists[0]),
+                    getList(record.ConditionLists[1]),
+                    getList(record.ConditionLists[2])
+                )
+            );
+        }
+
+        pResult->emplace_back(std::move(requests));
+    }
+
+    return pResult;
+}
+
+ProblemSnapshot::WorkingSystemPtr ProblemSnapshot::CreateWorkingSystem(PermutationGeneratorFactoryPtr pOptionalPermutationGeneratorFactory) const {
+    if(pOptionalPermutationGeneratorFactory)
+        return std::make_shared<WorkingSystem>(CreateRequests(), _pInitialResource, std::move(pOptionalPermutationGeneratorFactory));
+
+    return std::make_shared<WorkingSystem>(CreateRequests(), _pInitialResource);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// static
+ProblemSnapshot::Header const & ProblemSnapshot::Validate(boost::interprocess::mapped_region const &region, ConditionPtrs const &conditions) {
+    char const * const                      pData(static_cast<char const *>(region.get_address()));
+    std::uint64_t const                     fileSize(region.get_size());
+
+    if(fileSize < sizeof(Header))
+        throw std::runtime_error("Invalid snapshot file");
+
+    Header const &                          header(*reinterpret_cast<Header const *>(pData));
+
+    if(
+        std::memcmp(header.Magic, Magic, sizeof(Magic)) != 0
+        || header.Version != Version
+        || header.ByteOrder != ByteOrder
+        || header.FileSize != fileSize
+    )
+        throw std::runtime_error("Invalid snapshot file");
+
+    if(
+        IsValidSection<ConditionRecord>(fileSize, header.ConditionsOffset, header.NumConditions) == false
+        || IsValidSection<std::uint64_t>(fileSize, header.GroupsOffset, header.NumGroups + 1) == false
+        || IsValidSection<RequestRecord>(fileSize, header.RequestsOffset, header.NumRequests) == false
+        || IsValidSection<std::uint64_t>(fileSize, header.ConditionListsOffset, header.NumConditionLists + 1) == false
+        || IsValidSection<ConditionIndex>(fileSize, header.ConditionIndexesOffset, header.NumConditionIndexes) == false
+        || IsValidSection<char>(fileSize, header.StringsOffset, header.StringsSize) == false
+        || IsValidSection<char>(fileSize, header.ResourceOffset, header.ResourceSize) == false
+    )
+        throw std::runtime_error("Invalid snapshot file");
+
+    char const * const                      pStrings(pData + header.StringsOffset);
+
+    auto const                              isValidString(
+        [&header](std::uint64_t offset, std::uint64_t length) {
+            return offset <= header.StringsSize && length <= header.StringsSize - offset;
+        }
+    );
+
+    // Conditions
+    if(header.NumConditions != conditions.size())
+        throw std::runtime_error("Invalid snapshot file (the conditions do not match)");
+
+    ConditionRecord const * const           pConditions(reinterpret_cast<ConditionRecord const *>(pData + header.ConditionsOffset));
+
+    for(size_t index = 0; index < conditions.size(); ++index) {
+        ConditionRecord const &             record(pConditions[index]);
+        Condition const &                   condition(*conditions[index]);
+
+        if(isValidString(record.NameOffset, record.NameLength) == false)
+            throw std::runtime_error("Invalid snapshot file");
+
+        if(
+            std::string_view(pStrings + record.NameOffset, record.NameLength) != condition.Name
+            || record.MaxScore != condition.MaxScore
+        )
+            throw std::runtime_error("Invalid snapshot file (the conditions do not match)");
+    }
+
+    // Groups
+    std::uint64_t const * const             pGroups(reinterpret_cast<std::uint64_t const *>(pData + header.GroupsOffset));
+
+    if(pGroups[0] != 0 || pGroups[header.NumGroups] != header.NumRequests)
+        throw std::runtime_error("Invalid snapshot file");
+
+    for(std::uint64_t group = 0; group < header.NumGroups; ++group) {
+        if(pGroups[group] > pGroups[group + 1])
+            throw std::runtime_error("Invalid snapshot file");
+    }
+
+    // Condition lists
+    std::uint64_t const * const             pListBegins(reinterpret_cast<std::uint64_t const *>(pData + header.ConditionListsOffset));
+
+    if(pListBegins[0] != 0 || pListBegins[header.NumConditionLists] != header.NumConditionIndexes)
+        throw std::runtime_error("Invalid snapshot file");
+
+    for(std::uint64_t list = 0; list < header.NumConditionLists; ++list) {
+        // Requests don't support empty lists
+        if(pListBegins[list] >= pListBegins[list + 1])
+            throw std::runtime_error("Invalid snapshot file");
+    }
+
+    ConditionIndex const * const            pConditionIndexes(reinterpret_cast<ConditionIndex const *>(pData + header.ConditionIndexesOffset));
+
+    if(std::any_of(pConditionIndexes, pConditionIndexes + header.NumConditionIndexes, [&header](ConditionIndex index) { return index >= header.NumConditions; }))
+        throw std::runtime_error("Invalid snapshot file");
+
+    // Requests
+    RequestRecord const * const             pRequests(reinterpret_cast<RequestRecord const *>(pData + header.RequestsOffset));
+
+    for(std::uint64_t index = 0; index < header.NumRequests; ++index) {
+        RequestRecord const &               record(pRequests[index]);
+
+        if(record.NameLength == 0 || isValidString(record.NameOffset, record.NameLength) == false)
+            throw std::runtime_error("Invalid snapshot file");
+
+        for(std::uint32_t list : record.ConditionLists) {
+            if(list != NoConditionList && list >= header.NumConditionLists)
+                throw std::runtime_error("Invalid snapshot file");
+        }
+    }
+
+    return header;
+}
+
+template <typename T>
+T const * ProblemSnapshot::GetSection(std::uint64_t offset) const {
+    return reinterpret_cast<T const *>(static_cast<char const *>(_region.get_address()) + offset);
+}
+
+std::string_view ProblemSnapshot::GetString(std::uint64_t offset, std::uint64_t length) const {
+    return std::string_view(GetSection<char>(_pHeader->StringsOffset) + offset, static_cast<size_t>(length));
+}
+
+ProblemSnapshot::ConditionIndexes ProblemSnapshot::GetConditionList(std::uint32_t list) const {
+    if(list == NoConditionList)
+        return ConditionIndexes();
+
+    std::uint64_t const * const             pListBegins(GetSection<std::uint64_t>(_pHeader->ConditionListsOffset));
+    ConditionIndex const * const            pIndexes(GetSection<ConditionIndex>(_pHeader->ConditionIndexesOffset));
+
+    return ConditionIndexes(pIndexes + pListBegins[list], pIndexes + pListBegins[list + 1]);
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
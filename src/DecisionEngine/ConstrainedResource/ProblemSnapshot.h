@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ProblemSnapshot.h
+///  \brief         Contains the ProblemSnapshot object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:08:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "WorkingSystem.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <filesystem>
+#include <string_view>
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ProblemSnapshot
+///  \brief         A read-only, memory-mapped snapshot of a problem definition:
+///                 the `Requests` (organized into groups, as in a
+///                 `RequestPtrsContainer`), references to the `Conditions`
+///                 used by those `Requests`, and the initial `Resource`.
+///
+///                 Snapshots are created once with `Write` and then opened by
+///                 any number of processes. Opening a snapshot maps the file
+///                 and validates its structure; `Requests` can be inspected via
+///                 `RequestView` objects that point directly into the mapped
+///                 memory, and `CreateRequests`/`CreateWorkingSystem` create
+///                 the objects used during a search without parsing.
+///
+///                 `Conditions` contain code and can't be mapped; the snapshot
+///                 stores the index of each `Condition` within a catalog that
+///                 is provided when the snapshot is written and again when it
+///                 is opened (the names and maximum scores must match). The
+///                 initial `Resource` is stored with a boost binary archive
+///                 and deserialized when the snapshot is opened.
+///
+///                 Only `Request` objects (not derived types) can be written
+///                 to a snapshot. Snapshots use the native byte order and are
+///                 not portable across platforms with different byte orders.
+///
+class ProblemSnapshot {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ConditionIndex                    = std::uint32_t;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         ConditionIndexes
+    ///  \brief         Indexes into the `Condition` catalog, stored in the
+    ///                 mapped memory.
+    ///
+    class ConditionIndexes {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ConditionIndexes(void);
+        ConditionIndexes(ConditionIndex const *pBegin, ConditionIndex const *pEnd);
+
+        ConditionIndex const * begin(void) const;
+        ConditionIndex const * end(void) const;
+
+        size_t size(void) const;
+        bool empty(void) const;
+
+        ConditionIndex operator[](size_t index) const;
+
+    private:
+        // ----------------------------------------------------------------------
+        // |  Private Data
+        ConditionIndex const *              _pBegin;
+        ConditionIndex const *              _pEnd;
+    };
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         RequestView
+    ///  \brief         A `Request` stored in the mapped memory. The view is
+    ///                 only valid while the `ProblemSnapshot` exists.
+    ///
+    class RequestView {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        std::string_view const              Name;
+        ConditionIndexes const              ApplicabilityConditions;
+        ConditionIndexes const              RequirementConditions;
+        ConditionIndexes const              PreferenceConditions;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        RequestView(
+            std::string_view name,
+            ConditionIndexes applicabilityConditions,
+            ConditionIndexes requirementConditions,
+            ConditionIndexes preferenceConditions
+        );
+    };
+
+    using PermutationGeneratorFactoryPtr    = WorkingSystem::PermutationGeneratorFactoryPtr;
+    using WorkingSystemPtr                  = std::shared_ptr<WorkingSystem>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Write
+    ///  \brief         Writes a snapshot of the problem. All `Conditions` used by
+    ///                 the `Requests` must be present in `conditions`.
+    ///
+    static void Write(
+        std::filesystem::path const &filename,
+        ConditionPtrs const &conditions,
+        RequestPtrsContainer const &requestsContainer,
+        ResourcePtr const &pInitialResource
+    );
+
+    ProblemSnapshot(std::filesystem::path const &filename, ConditionPtrs conditions);
+    ~ProblemSnapshot(void) = default;
+
+    NON_COPYABLE(ProblemSnapshot);
+    NON_MOVABLE(ProblemSnapshot);
+
+    ConditionPtrs const & GetConditions(void) const;
+    ResourcePtr const & GetInitialResource(void) const;
+
+    size_t GetNumGroups(void) const;
+    size_t GetNumRequests(void) const;
+    size_t GetNumRequests(size_t group) const;
+
+    RequestView GetRequest(size_t group, size_t index) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            CreateRequests
+    ///  \brief         Creates the `Requests` stored in the snapshot. `Requests`
+    ///                 that reference the same `Conditions` share the
+    ///                 `ConditionPtrs` that contain them.
+    ///
+    RequestPtrsContainerPtr CreateRequests(void) const;
+
+    /// Creates a `WorkingSystem` that can be used to begin a search.
+    WorkingSystemPtr CreateWorkingSystem(PermutationGeneratorFactoryPtr pOptionalPermutationGeneratorFactory=PermutationGeneratorFactoryPtr()) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct Header;
+    struct RequestRecord;
+    struct ConditionRecord;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    ConditionPtrs const                     _conditions;
+
+    boost::interprocess::file_mapping const             _mapping;
+    boost::interprocess::mapped_region const            _region;
+
+    Header const * const                    _pHeader;
+    ResourcePtr const                       _pInitialResource;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static Header const & Validate(boost::interprocess::mapped_region const &region, ConditionPtrs const &conditions);
+
+    template <typename T>
+    T const * GetSection(std::uint64_t offset) const;
+
+    std::string_view GetString(std::uint64_t offset, std::uint64_t length) const;
+    ConditionIndexes GetConditionList(std::uint32_t list) const;
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
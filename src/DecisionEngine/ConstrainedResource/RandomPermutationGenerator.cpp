@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RandomPermutationGenerator.cpp
+///  \brief         See RandomPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "RandomPermutationGenerator.h"
+#include "RankedPermutationGenerator.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  RandomPermutationGenerator
+// |
+// ----------------------------------------------------------------------
+RandomPermutationGenerator::RandomPermutationGenerator(size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/, std::uint64_t seed/*=0*/) :
+    PermutationGenerator(std::move(maxNumPermutations)),
+    _randomState(std::move(seed))
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+RandomPermutationGenerator::RequestIndexesPtrs RandomPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    size_t const                            numRequests(requests.size());
+    size_t const                            numPermutations(RankedPermutationGenerator::GetNumPermutations(numRequests));
+    RequestIndexesPtrs                      results;
+
+    while(maxNumPermutations--) {
+        if(numPermutations != std::numeric_limits<size_t>::max()) {
+            assert(_generatedRanks.size() < numPermutations);
+
+            // Select one of the ranks that hasn't been generated yet by skipping over
+            // those that have.
+            size_t                          rank(GetRandomValue(numPermutations - _generatedRanks.size()));
+            std::vector<size_t>::iterator   iter(_generatedRanks.begin());
+
+            while(iter != _generatedRanks.end() && *iter <= rank) {
+                ++rank;
+                ++iter;
+            }
+
+            _generatedRanks.insert(iter, rank);
+            results.emplace_back(std::make_shared<RequestIndexes>(RankedPermutationGenerator::Unrank(numRequests, rank)));
+
+            if(_generatedRanks.size() == numPermutations) {
+                assert(_isActive);
+                _isActive = false;
+
+                break;
+            }
+        }
+        else {
+            // Fisher-Yates shuffle
+            RequestIndexes                  permutation;
+
+            permutation.reserve(numRequests);
+
+            for(RequestIndex index = 0; index < numRequests; ++index)
+                permutation.emplace_back(index);
+
+            for(size_t index = numRequests - 1; index > 0; --index)
+                std::swap(permutation[index], permutation[GetRandomValue(index + 1)]);
+
+            results.emplace_back(std::make_shared<RequestIndexes>(std::move(permutation)));
+        }
+    }
+
+    return results;
+}
+
+size_t RandomPermutationGenerator::GetRandomValue(size_t maxValue) {
+    assert(maxValue);
+
+    // splitmix64; the state is a single integer so that it can be serialized
+    std::uint64_t                           value(_randomState += 0x9E3779B97F4A7C15ull);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    value = value ^ (value >> 31);
+
+    // The bias introduced by the modulus is negligible for the values used here
+    return static_cast<size_t>(value % maxValue);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  RandomPermutationGeneratorFactory
+// |
+// ----------------------------------------------------------------------
+RandomPermutationGeneratorFactory::RandomPermutationGeneratorFactory(size_t maxNumTotalPermutations, std::uint64_t seed/*=0*/) :
+    PermutationGeneratorFactory(std::move(maxNumTotalPermutations)),
+    _seed(std::move(seed))
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+RandomPermutationGeneratorFactory::PermutationGeneratorUniquePtr RandomPermutationGeneratorFactory::CreateImpl(size_t maxNumTotalPermutations) const /*override*/ {
+    return std::make_unique<RandomPermutationGenerator>(maxNumTotalPermutations, _seed);
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::RandomPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::RandomPermutationGeneratorFactory);
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RandomPermutationGenerator.h
+///  \brief         Contains the RandomPermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RandomPermutationGenerator
+///  \brief         PermutationGenerator that samples permutations uniformly at
+///                 random without replacement; the sequence is determined by
+///                 the seed.
+///
+///                 Permutations are sampled by rank (see
+///                 `RankedPermutationGenerator`) when the number of
+///                 permutations can be represented by a `size_t` (groups of
+///                 20 or fewer Requests), which guarantees that permutations
+///                 are not repeated. Larger groups are shuffled directly; a
+///                 repeated permutation is possible, but exceedingly unlikely.
+///
+class RandomPermutationGenerator : public PermutationGenerator {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    std::uint64_t                           _randomState;
+
+    // Sorted ranks of the permutations generated so far
+    std::vector<size_t>                     _generatedRanks;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    RandomPermutationGenerator(size_t maxNumPermutations=std::numeric_limits<size_t>::max(), std::uint64_t seed=0);
+    ~RandomPermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_randomState, _generatedRanks), BASES(PermutationGenerator)
+
+    NON_COPYABLE(RandomPermutationGenerator);
+    MOVE(RandomPermutationGenerator, ARGS);
+    COMPARE(RandomPermutationGenerator, ARGS);
+    SERIALIZATION(RandomPermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+
+    /// Returns a value in the range [0, maxValue).
+    size_t GetRandomValue(size_t maxValue);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RandomPermutationGeneratorFactory
+///  \brief         Factory that generates RandomPermutationGenerator instances
+///                 that use the same seed.
+///
+class RandomPermutationGeneratorFactory : public PermutationGeneratorFactory {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    std::uint64_t const                     _seed;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    RandomPermutationGeneratorFactory(size_t maxNumTotalPermutations, std::uint64_t seed=0);
+    ~RandomPermutationGeneratorFactory(void) override = default;
+
+#define ARGS                                MEMBERS(_seed), BASES(PermutationGeneratorFactory)
+
+    NON_COPYABLE(RandomPermutationGeneratorFactory);
+    MOVE(RandomPermutationGeneratorFactory, ARGS);
+    COMPARE(RandomPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(RandomPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    PermutationGeneratorUniquePtr CreateImpl(size_t maxNumTotalPermutations) const override;
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::RandomPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::RandomPermutationGeneratorFactory);
@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RankedPermutationGenerator.cpp
+///  \brief         See RankedPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:21:02
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "RankedPermutationGenerator.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  RankedPermutationGenerator
+// |
+// ----------------------------------------------------------------------
+// static
+size_t RankedPermutationGenerator::GetNumPermutations(size_t numItems) {
+    size_t                                  result(1);
+
+    for(size_t value = 2; value <= numItems; ++value) {
+        if(result > std::numeric_limits<size_t>::max() / value)
+            return std::numeric_limits<size_t>::max();
+
+        result *= value;
+    }
+
+    return result;
+}
+
+// static
+RankedPermutationGenerator::RequestIndexes RankedPermutationGenerator::Unrank(size_t numItems, size_t rank) {
+    ENSURE_ARGUMENT(numItems, numItems && numItems <= std::numeric_limits<RequestIndex>::max());
+
+    size_t const                            numPermutations(GetNumPermutations(numItems));
+
+    ENSURE_ARGUMENT(rank, rank < numPermutations || numPermutations == std::numeric_limits<size_t>::max());
+
+    RequestIndexes                          remaining;
+
+    remaining.reserve(numItems);
+
+    for(RequestIndex index = 0; index < numItems; ++index)
+        remaining.emplace_back(index);
+
+    RequestIndexes                          results;
+
+    results.reserve(numItems);
+
+    while(remaining.empty() == false) {
+        size_t const                        factorial(GetNumPermutations(remaining.size() - 1));
+
+        // A saturated factorial is larger than any rank, so the digit is 0
+        size_t const                        digit(factorial == std::numeric_limits<size_t>::max() ? 0 : rank / factorial);
+
+        assert(digit < remaining.size());
+
+        if(factorial != std::numeric_limits<size_t>::max())
+            rank %= factorial;
+
+        results.emplace_back(remaining[digit]);
+        remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(digit));
+    }
+
+    return results;
+}
+
+// static
+RankedPermutationGenerator::RankRanges RankedPermutationGenerator::Partition(size_t numItems, size_t numPartitions) {
+    ENSURE_ARGUMENT(numItems);
+    ENSURE_ARGUMENT(numPartitions);
+
+    size_t const                            numPermutations(GetNumPermutations(numItems));
+
+    numPartitions = std::min(numPartitions, numPermutations);
+
+    size_t const                            partitionSize(numPermutations / numPartitions);
+    size_t                                  remainder(numPermutations % numPartitions);
+    RankRanges                              results;
+    size_t                                  firstRank(0);
+
+    results.reserve(numPartitions);
+
+    while(numPartitions--) {
+        size_t const                        endRank(firstRank + partitionSize + (remainder ? 1 : 0));
+
+        if(remainder)
+            --remainder;
+
+        results.emplace_back(firstRank, endRank);
+        firstRank = endRank;
+    }
+
+    assert(firstRank == numPermutations);
+    return results;
+}
+
+RankedPermutationGenerator::RankedPermutationGenerator(
+    size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/,
+    size_t firstRank/*=0*/,
+    size_t endRank/*=std::numeric_limits<size_t>::max()*/
+) :
+    PermutationGenerator(std::move(maxNumPermutations)),
+    _nextRank(
+        std::move(
+            [&firstRank, &endRank](void) -> size_t & {
+                ENSURE_ARGUMENT(firstRank, firstRank < endRank);
+                return firstRank;
+            }()
+        )
+    ),
+    _endRank(std::move(endRank))
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+RankedPermutationGenerator::RequestIndexesPtrs RankedPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    size_t const                            endRank(std::min(_endRank, GetNumPermutations(requests.size())));
+
+    if(_nextRank >= endRank)
+        throw std::runtime_error("Invalid rank");
+
+    RequestIndexesPtrs                      results;
+
+    while(maxNumPermutations--) {
+        results.emplace_back(std::make_shared<RequestIndexes>(Unrank(requests.size(), _nextRank)));
+
+        if(++_nextRank == endRank) {
+            assert(_isActive);
+            _isActive = false;
+
+            break;
+        }
+    }
+
+    return results;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::RankedPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::RankedPermutationGeneratorFactory);
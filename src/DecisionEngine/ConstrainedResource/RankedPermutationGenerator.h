@@ -0,0 +1,141 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RankedPermutationGenerator.h
+///  \brief         Contains the RankedPermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:21:02
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RankedPermutationGenerator
+///  \brief         PermutationGenerator that produces each permutation directly
+///                 from its lexicographic rank (via the factorial number
+///                 system), generating the same orderings as
+///                 `StandardPermutationGenerator`.
+///
+///                 Because permutations don't depend upon their predecessors,
+///                 disjoint rank ranges (see `Partition`) can be generated
+///                 independently by different tasks or threads.
+///
+///                 Ranks are stored as `size_t` values, so only the first
+///                 `std::numeric_limits<size_t>::max()` permutations of groups
+///                 with more than 20 Requests can be addressed.
+///
+class RankedPermutationGenerator : public PermutationGenerator {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    size_t                                  _nextRank;
+    size_t                                  _endRank;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    /// [first, end) rank ranges
+    using RankRange                         = std::tuple<size_t, size_t>;
+    using RankRanges                        = std::vector<RankRange>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the number of permutations of `numItems` items, saturated at
+    /// `std::numeric_limits<size_t>::max()`.
+    static size_t GetNumPermutations(size_t numItems);
+
+    /// Returns the order of the items in the permutation with the provided rank.
+    static RequestIndexes Unrank(size_t numItems, size_t rank);
+
+    /// Divides the permutations of `numItems` items into at most `numPartitions`
+    /// contiguous, non-empty rank ranges of (nearly) equal size.
+    static RankRanges Partition(size_t numItems, size_t numPartitions);
+
+    /// `endRank` is clamped to the number of permutations of the Requests
+    /// provided to `Generate`; `firstRank` must be less than that value.
+    RankedPermutationGenerator(
+        size_t maxNumPermutations=std::numeric_limits<size_t>::max(),
+        size_t firstRank=0,
+        size_t endRank=std::numeric_limits<size_t>::max()
+    );
+
+    ~RankedPermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_nextRank, _endRank), BASES(PermutationGenerator)
+
+    NON_COPYABLE(RankedPermutationGenerator);
+    MOVE(RankedPermutationGenerator, ARGS);
+    COMPARE(RankedPermutationGenerator, ARGS);
+    SERIALIZATION(RankedPermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RankedPermutationGeneratorFactory
+///  \brief         Factory that generates RankedPermutationGenerator instances
+///                 that cover all ranks.
+///
+class RankedPermutationGeneratorFactory : public PermutationGeneratorFactoryImpl<RankedPermutationGenerator>
+{
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using BaseType                          = PermutationGeneratorFactoryImpl<RankedPermutationGenerator>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using BaseType::BaseType;
+
+#define ARGS                                BASES(BaseType)
+
+    NON_COPYABLE(RankedPermutationGeneratorFactory);
+    MOVE(RankedPermutationGeneratorFactory, ARGS);
+    COMPARE(RankedPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(RankedPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::RankedPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::RankedPermutationGeneratorFactory);
@@ -40,6 +40,22 @@ bool IsValidOptionalConditionPtrsPtr(ConditionPtrsPtr const &conditions) {
         && std::all_of(conditions->cbegin(), conditions->cend(), [](ConditionPtr const &ptr) { return static_cast<bool>(ptr); });
 }
 
+bool AreIdenticalOptionalConditionPtrsPtrs(ConditionPtrsPtr const &a, ConditionPtrsPtr const &b) {
+    if(a == b)
+        return true;
+
+    if(!a || !b)
+        return false;
+
+    return std::equal(
+        a->cbegin(),
+        a->cend(),
+        b->cbegin(),
+        b->cend(),
+        [](ConditionPtr const &conditionA, ConditionPtr const &conditionB) { return conditionA.get() == conditionB.get(); }
+    );
+}
+
 } // anonymous namespace
 
 Request::Request(
@@ -86,6 +102,35 @@ std::string const & Request::ToString(void) const {
     return Name;
 }
 
+// virtual
+std::optional<std::string> Request::GetEquivalenceKey(void) const {
+    return std::nullopt;
+}
+
+bool Request::IsEquivalent(Request const &other) const {
+    if(this == &other)
+        return true;
+
+    std::optional<std::string> const        key(GetEquivalenceKey());
+    std::optional<std::string> const        otherKey(other.GetEquivalenceKey());
+
+    if(key || otherKey)
+        return key == otherKey;
+
+    if(typeid(*this) != typeid(Request) || typeid(other) != typeid(Request))
+        return false;
+
+    return
+        AreIdenticalOptionalConditionPtrsPtrs(OptionalApplicabilityConditions, other.OptionalApplicabilityConditions)
+        && AreIdenticalOptionalConditionPtrsPtrs(OptionalRequirementConditions, other.OptionalRequirementConditions)
+        && AreIdenticalOptionalConditionPtrsPtrs(OptionalPreferenceConditions, other.OptionalPreferenceConditions);
+}
+
+// virtual
+float Request::GetPriority(void) const {
+    return 0.0f;
+}
+
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
 
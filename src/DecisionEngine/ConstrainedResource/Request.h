@@ -68,6 +68,22 @@ public:
 #undef ARGS
 
     std::string const & ToString(void) const;
+
+    /// Returns a key that identifies Requests that are interchangeable with this
+    /// one. The default implementation does not provide a key; `Request` objects
+    /// without keys are equivalent when their Conditions are identical, but
+    /// derived types may contain state used by their Conditions and must provide
+    /// a key to be considered equivalent.
+    virtual std::optional<std::string> GetEquivalenceKey(void) const;
+
+    /// Returns true if applying this Request is indistinguishable from applying
+    /// `other` (ignoring the Requests' names).
+    bool IsEquivalent(Request const &other) const;
+
+    /// Returns a value used by heuristic PermutationGenerators, where Requests
+    /// with higher priorities (for example, those that are more difficult to
+    /// fulfill) are applied first. The default implementation returns 0.
+    virtual float GetPriority(void) const;
 };
 
 } // namespace ConstrainedResource
@@ -20,8 +20,12 @@
 ///
 /////////////////////////////////////////////////////////////////////////
 #include "Resource.h"
+#include "AdaptiveConditionOrderer.h"
+#include "ConditionCache.h"
 #include "Request.h"
 
+#include <numeric>
+
 namespace DecisionEngine {
 namespace ConstrainedResource {
 
@@ -34,6 +38,11 @@ Resource::State::State(Resource const &resource) :
     _resource(resource.SharedFromThis())
 {}
 
+// virtual
+size_t Resource::State::GetApproximateSize(void) const {
+    return sizeof(State);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Resource::Evaluation
@@ -71,10 +80,10 @@ std::string const & Resource::ToString(void) const {
     return Name;
 }
 
-Resource::EvaluateResult Resource::Evaluate(Request const &request, size_t maxNumEvaluations) const {
+Resource::EvaluateResult Resource::Evaluate(Request const &request, size_t maxNumEvaluations, bool isFailFast/*=false*/) const {
     ENSURE_ARGUMENT(maxNumEvaluations);
 
-    EvaluateResult                          result(EvaluateImpl(request, maxNumEvaluations));
+    EvaluateResult                          result(EvaluateImpl(request, maxNumEvaluations, isFailFast));
     Evaluations const &                     evaluations(std::get<0>(result));
 
     if(evaluations.empty() || evaluations.size() > maxNumEvaluations)
@@ -83,11 +92,11 @@ Resource::EvaluateResult Resource::Evaluate(Request const &request, size_t maxNu
     return result;
 }
 
-Resource::EvaluateResult Resource::Evaluate(Request const &request, size_t maxNumEvaluations, State &continuationState) const {
+Resource::EvaluateResult Resource::Evaluate(Request const &request, size_t maxNumEvaluations, State &continuationState, bool isFailFast/*=false*/) const {
     ENSURE_ARGUMENT(maxNumEvaluations);
     ENSURE_ARGUMENT(continuationState, continuationState._resource.get() == this);
 
-    EvaluateResult                          result(EvaluateImpl(request, maxNumEvaluations, continuationState));
+    EvaluateResult                          result(EvaluateImpl(request, maxNumEvaluations, continuationState, isFailFast));
     Evaluations const &                     evaluations(std::get<0>(result));
 
     if(evaluations.empty() || evaluations.size() > maxNumEvaluations)
@@ -107,62 +116,195 @@ ResourcePtr Resource::Apply(State &applyState) const {
     return result;
 }
 
+// virtual
+std::optional<size_t> Resource::GetStateHash(void) const {
+    return std::nullopt;
+}
+
+// virtual
+size_t Resource::GetApproximateSize(void) const {
+    auto const                              getConditionsSize(
+        [](ConditionPtrsPtr const &pConditions) -> size_t {
+            if(!pConditions)
+                return 0;
+
+            return (sizeof(ConditionPtrs) + pConditions->capacity() * sizeof(ConditionPtr)) / static_cast<size_t>(pConditions.use_count());
+        }
+    );
+
+    return sizeof(Resource)
+        + Name.capacity()
+        + getConditionsSize(OptionalApplicabilityConditions)
+        + getConditionsSize(OptionalRequirementConditions)
+        + getConditionsSize(OptionalPreferenceConditions);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // static
-Core::Components::Score::Result Resource::CalculateResult(Request const &request, Resource const &resource) {
+Core::Components::Score::Result Resource::CalculateResult(
+    Request const &request,
+    Resource const &resource,
+    bool isFailFast/*=false*/,
+    ConditionCache *pOptionalCache/*=nullptr*/,
+    AdaptiveConditionOrderer *pOptionalOrderer/*=nullptr*/
+) {
     // ----------------------------------------------------------------------
     using Result                            = Core::Components::Score::Result;
     using ConditionResults                  = Result::ConditionResults;
     using ConditionResult                   = ConditionResults::value_type;
     // ----------------------------------------------------------------------
 
-    auto const                              applyConditionsFunc(
-        [&request, &resource](ConditionPtrsPtr const * const * pppConditionPtrs, size_t numConditionPtrs) {
+    auto const                              applyConditionFunc(
+        [&request, &resource, &pOptionalCache, &pOptionalOrderer](Condition const &condition) {
+            auto const                      applyFunc(
+                [&request, &resource, &pOptionalCache](Condition const &c) {
+                    if(pOptionalCache)
+                        return pOptionalCache->Apply(c, request, resource);
+
+                    return c.Apply(request, resource);
+                }
+            );
+
+            if(pOptionalOrderer)
+                return pOptionalOrderer->Apply(condition, applyFunc);
+
+            return applyFunc(condition);
+        }
+    );
+
+    auto const                              getNumConditionsFunc(
+        [](ConditionPtrsPtr const * const * pppConditionPtrs, size_t numConditionPtrs) {
             assert(pppConditionPtrs);
             assert(numConditionPtrs);
 
+            ConditionPtrsPtr const * const * const      pppConditionPtrsEnd(pppConditionPtrs + numConditionPtrs);
+            size_t                                      result(0);
+
+            while(pppConditionPtrs != pppConditionPtrsEnd) {
+                if(**pppConditionPtrs)
+                    result += (**pppConditionPtrs)->size();
+
+                ++pppConditionPtrs;
+            }
+
+            return result;
+        }
+    );
+
+    // Conditions are only collected when they are ordered adaptively;
+    // otherwise, they are applied in place.
+    auto const                              getConditionsFunc(
+        [&getNumConditionsFunc](ConditionPtrsPtr const * const * pppConditionPtrs, size_t numConditionPtrs) {
+            ConditionPtrsPtr const * const * const      pppConditionPtrsEnd(pppConditionPtrs + numConditionPtrs);
+            AdaptiveConditionOrderer::Conditions        conditions;
+
+            conditions.reserve(getNumConditionsFunc(pppConditionPtrs, numConditionPtrs));
+
+            while(pppConditionPtrs != pppConditionPtrsEnd) {
+                if(**pppConditionPtrs) {
+                    for(auto const &pCondition : ***pppConditionPtrs)
+                        conditions.emplace_back(pCondition.get());
+                }
+
+                ++pppConditionPtrs;
+            }
+
+            return conditions;
+        }
+    );
+
+    // Returns the results and a flag indicating if all of the Conditions were applied
+    auto const                              applyConditionsFunc(
+        [&applyConditionFunc, &getNumConditionsFunc](ConditionPtrsPtr const * const * pppConditionPtrs, size_t numConditionPtrs, bool stopOnFailure) {
+            size_t const                                numConditions(getNumConditionsFunc(pppConditionPtrs, numConditionPtrs));
             ConditionPtrsPtr const * const * const      pppConditionPtrsEnd(pppConditionPtrs + numConditionPtrs);
             ConditionResults                            results;
 
+            results.reserve(numConditions);
+
             while(pppConditionPtrs != pppConditionPtrsEnd) {
                 if(**pppConditionPtrs) {
-                    ConditionPtrs const &   conditionPtrs(***pppConditionPtrs);
+                    for(auto const &pCondition : ***pppConditionPtrs) {
+                        results.emplace_back(applyConditionFunc(*pCondition));
 
-                    results.reserve(results.size() + conditionPtrs.size());
+                        if(stopOnFailure && results.back().IsSuccessful == false) {
+                            bool const      isComplete(results.size() == numConditions);
 
-                    for(auto const &pCondition : conditionPtrs)
-                        results.emplace_back(pCondition->Apply(request, resource));
+                            return std::make_tuple(std::move(results), isComplete);
+                        }
+                    }
                 }
 
                 ++pppConditionPtrs;
             }
 
-            return results;
+            return std::make_tuple(std::move(results), true);
         }
     );
 
     // Calculate applicability
     ConditionPtrsPtr const * const          ppApplicability[] = { &request.OptionalApplicabilityConditions, &resource.OptionalApplicabilityConditions };
 
-    ConditionResults                        applicabilityResults(applyConditionsFunc(ppApplicability, sizeof(ppApplicability) / sizeof(*ppApplicability)));
+    ConditionResults                        applicabilityResults(std::get<0>(applyConditionsFunc(ppApplicability, sizeof(ppApplicability) / sizeof(*ppApplicability), false)));
     ConditionResults                        requirementResults;
     ConditionResults                        preferenceResults;
+    bool                                    isPartial(false);
 
     // Only calculate requirements and preferences if everything is applicable
     if(std::all_of(applicabilityResults.cbegin(), applicabilityResults.cend(), [](ConditionResult const &result) { return result.IsSuccessful; })) {
         ConditionPtrsPtr const * const      ppRequirements[] = { &request.OptionalRequirementConditions, &resource.OptionalRequirementConditions };
         ConditionPtrsPtr const * const      ppPreferences[] = { &request.OptionalPreferenceConditions, &resource.OptionalPreferenceConditions };
 
-        requirementResults = applyConditionsFunc(ppRequirements, sizeof(ppRequirements) / sizeof(*ppRequirements));
-        preferenceResults = applyConditionsFunc(ppPreferences, sizeof(ppPreferences) / sizeof(*ppPreferences));
+        bool                                            areRequirementsComplete;
+
+        if(isFailFast && pOptionalOrderer) {
+            // Apply the requirements that are most likely to fail cheaply first
+            AdaptiveConditionOrderer::Conditions const      requirements(getConditionsFunc(ppRequirements, sizeof(ppRequirements) / sizeof(*ppRequirements)));
+            AdaptiveConditionOrderer::Indexes const         order(pOptionalOrderer->GetOrder(requirements));
+            ConditionResults                                orderedResults;
+
+            orderedResults.reserve(order.size());
+
+            for(size_t index : order) {
+                orderedResults.emplace_back(applyConditionFunc(*requirements[index]));
+
+                if(orderedResults.back().IsSuccessful == false)
+                    break;
+            }
+
+            areRequirementsComplete = orderedResults.size() == requirements.size();
+
+            // Restore the declared order of the Results
+            AdaptiveConditionOrderer::Indexes           positions(orderedResults.size());
+
+            std::iota(positions.begin(), positions.end(), 0);
+            std::sort(positions.begin(), positions.end(), [&order](size_t a, size_t b) { return order[a] < order[b]; });
+
+            requirementResults.reserve(positions.size());
+
+            for(size_t position : positions)
+                requirementResults.emplace_back(std::move(orderedResults[position]));
+        }
+        else
+            std::tie(requirementResults, areRequirementsComplete) = applyConditionsFunc(ppRequirements, sizeof(ppRequirements) / sizeof(*ppRequirements), isFailFast);
+
+        // Preferences can't make a failed result successful
+        if(
+            isFailFast
+            && std::any_of(requirementResults.cbegin(), requirementResults.cend(), [](ConditionResult const &result) { return result.IsSuccessful == false; })
+        )
+            isPartial = areRequirementsComplete == false || getNumConditionsFunc(ppPreferences, sizeof(ppPreferences) / sizeof(*ppPreferences)) != 0;
+        else
+            preferenceResults = std::get<0>(applyConditionsFunc(ppPreferences, sizeof(ppPreferences) / sizeof(*ppPreferences), false));
     }
 
     return Result(
         std::move(applicabilityResults),
         std::move(requirementResults),
-        std::move(preferenceResults)
+        std::move(preferenceResults),
+        isPartial
     );
 }
 
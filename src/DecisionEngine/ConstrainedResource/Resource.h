@@ -31,6 +31,8 @@ namespace ConstrainedResource {
 
 // ----------------------------------------------------------------------
 // |  Forward Declarations
+class AdaptiveConditionOrderer;
+class ConditionCache;
 class Request;
 
 /////////////////////////////////////////////////////////////////////////
@@ -79,6 +81,11 @@ public:
 
 #undef ARGS
 
+        /// Returns the approximate number of bytes used by this object (see
+        /// `System::GetApproximateSize`); states that hold more than a few
+        /// values should override this method.
+        virtual size_t GetApproximateSize(void) const;
+
     private:
         // Relationships
         friend class Resource;
@@ -166,18 +173,50 @@ public:
 
     std::string const & ToString(void) const;
 
-    EvaluateResult Evaluate(Request const &request, size_t maxNumEvaluations) const;
-    EvaluateResult Evaluate(Request const &request, size_t maxNumEvaluations, State &continuationState) const;
+    /// When `isFailFast` is true, unsuccessful Evaluations will be discarded by
+    /// the caller, so their Results may be partial (see `CalculateResult`).
+    EvaluateResult Evaluate(Request const &request, size_t maxNumEvaluations, bool isFailFast=false) const;
+    EvaluateResult Evaluate(Request const &request, size_t maxNumEvaluations, State &continuationState, bool isFailFast=false) const;
 
     ResourcePtr Apply(State &applyState) const;
 
+    /// Returns a hash of the state that is visible to Conditions, where Resources
+    /// with the same hash produce the same Results when pure Conditions are
+    /// applied (see `Condition::IsPure`). Results are only cached by a
+    /// `ConditionCache` when a hash is provided; the default implementation
+    /// doesn't provide one.
+    virtual std::optional<size_t> GetStateHash(void) const;
+
+    /// Returns the approximate number of bytes used by this object (see
+    /// `System::GetApproximateSize`). Conditions shared with other Resources
+    /// are divided evenly among them. Resources that accumulate data as
+    /// Requests are applied should override this method and add the size
+    /// of that data to the value returned here.
+    virtual size_t GetApproximateSize(void) const;
+
 protected:
     // ----------------------------------------------------------------------
     // |
     // |  Protected Methods
     // |
     // ----------------------------------------------------------------------
-    static Core::Components::Score::Result CalculateResult(Request const &request, Resource const &resource);
+
+    /// When `isFailFast` is true, requirements are no longer applied once one
+    /// has failed and preferences are not applied if any requirement failed;
+    /// the Result is marked as partial if any Conditions were skipped.
+    ///
+    /// Statistics are sampled from the Conditions applied when an
+    /// `AdaptiveConditionOrderer` is provided; the orderer also decides the
+    /// order in which requirements are applied when `isFailFast` is true.
+    /// Results are always returned in the order in which the Conditions were
+    /// declared.
+    static Core::Components::Score::Result CalculateResult(
+        Request const &request,
+        Resource const &resource,
+        bool isFailFast=false,
+        ConditionCache *pOptionalCache=nullptr,
+        AdaptiveConditionOrderer *pOptionalOrderer=nullptr
+    );
 
 private:
     // ----------------------------------------------------------------------
@@ -185,8 +224,8 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    virtual EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations) const = 0;
-    virtual EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &continuationState) const = 0;
+    virtual EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, bool isFailFast) const = 0;
+    virtual EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &continuationState, bool isFailFast) const = 0;
 
     virtual ResourcePtr ApplyImpl(State const &applyState) const = 0;
 };
@@ -75,6 +75,18 @@ std::string ResultSystem::ToString(void) const /*override*/ {
     );
 }
 
+size_t ResultSystem::GetApproximateSize(void) const /*override*/ {
+    size_t                                  requestsSize(sizeof(RequestPtrsContainer) + Requests->capacity() * sizeof(RequestPtrs));
+
+    for(RequestPtrs const &requests : *Requests)
+        requestsSize += requests.capacity() * sizeof(RequestPtr);
+
+    return Core::Components::ResultSystem::GetApproximateSize()
+        + sizeof(ResultSystem) - sizeof(Core::Components::ResultSystem)
+        + Resource->GetApproximateSize() / static_cast<size_t>(Resource.use_count())
+        + requestsSize / static_cast<size_t>(Requests.use_count());
+}
+
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
 
@@ -70,6 +70,8 @@ public:
 #undef ARGS
 
     std::string ToString(void) const override;
+
+    size_t GetApproximateSize(void) const override;
 };
 
 } // namespace ConstrainedResource
@@ -36,7 +36,7 @@ StandardPermutationGenerator::StandardPermutationGenerator(size_t maxNumPermutat
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-StandardPermutationGenerator::RequestPtrsPtrs StandardPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+StandardPermutationGenerator::RequestIndexesPtrs StandardPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
     assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
     assert(maxNumPermutations);
     assert(IsComplete() == false);
@@ -46,25 +46,16 @@ StandardPermutationGenerator::RequestPtrsPtrs StandardPermutationGenerator::Gene
 
         _indexes.reserve(numRequests);
 
-        for(size_t index = 0; index < numRequests; ++index)
+        for(RequestIndex index = 0; index < numRequests; ++index)
             _indexes.emplace_back(index);
     }
 
     assert(_indexes.size() == requests.size());
 
-    RequestPtrsPtrs                         results;
+    RequestIndexesPtrs                      results;
 
     while(maxNumPermutations--) {
-        RequestPtrs                         theseResults;
-
-        theseResults.reserve(_indexes.size());
-
-        for(auto index : _indexes) {
-            assert(index < requests.size());
-            theseResults.emplace_back(requests[index]);
-        }
-
-        results.emplace_back(std::make_shared<RequestPtrs>(std::move(theseResults)));
+        results.emplace_back(std::make_shared<RequestIndexes>(_indexes));
 
         if(std::next_permutation(_indexes.begin(), _indexes.end()) == false) {
             assert(_isActive);
@@ -77,8 +68,26 @@ StandardPermutationGenerator::RequestPtrsPtrs StandardPermutationGenerator::Gene
     return results;
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  IncrementalPermutationGeneratorFactory
+// |
+// ----------------------------------------------------------------------
+IncrementalPermutationGeneratorFactory::IncrementalPermutationGeneratorFactory(void) :
+    PermutationGeneratorFactory(std::numeric_limits<size_t>::max())
+{}
+
+bool IncrementalPermutationGeneratorFactory::IsIncremental(void) const /*override*/ {
+    return true;
+}
+
+IncrementalPermutationGeneratorFactory::PermutationGeneratorUniquePtr IncrementalPermutationGeneratorFactory::CreateImpl(size_t maxNumTotalPermutations) const /*override*/ {
+    return std::make_unique<StandardPermutationGenerator>(maxNumTotalPermutations);
+}
+
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
 
 SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::StandardPermutationGenerator);
 SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::StandardPermutationGeneratorFactory);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::IncrementalPermutationGeneratorFactory);
@@ -41,7 +41,7 @@ private:
     // |  Private Data (used in public declarations)
     // |
     // ----------------------------------------------------------------------
-    std::vector<size_t>                     _indexes;
+    RequestIndexes                          _indexes;
 
 public:
     // ----------------------------------------------------------------------
@@ -67,7 +67,7 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    RequestPtrsPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -95,8 +95,56 @@ public:
 #undef ARGS
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         IncrementalPermutationGeneratorFactory
+///  \brief         Factory that causes a WorkingSystem to build orderings
+///                 incrementally rather than generating them up front.
+///
+///                 Each child of a WorkingSystem applies one of the Requests
+///                 that remain in its group, so an ordering is extended one
+///                 Request at a time. Orderings that share a prefix share the
+///                 evaluation of that prefix, and a prefix that fails (or is
+///                 ranked below the pending systems retained by the engine)
+///                 prunes every ordering that extends it.
+///
+///                 The orderings reached are the same as those generated by
+///                 `StandardPermutationGenerator`. Orderings aren't generated
+///                 up front, so they can't be limited.
+///
+///                 This class doesn't derive from
+///                 `StandardPermutationGeneratorFactory` so that the two
+///                 factories never compare as equal.
+///
+class IncrementalPermutationGeneratorFactory : public PermutationGeneratorFactory {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    IncrementalPermutationGeneratorFactory(void);
+    ~IncrementalPermutationGeneratorFactory(void) override = default;
+
+#define ARGS                                BASES(PermutationGeneratorFactory)
+
+    NON_COPYABLE(IncrementalPermutationGeneratorFactory);
+    MOVE(IncrementalPermutationGeneratorFactory, ARGS);
+    COMPARE(IncrementalPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(IncrementalPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+
+    bool IsIncremental(void) const override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    PermutationGeneratorUniquePtr CreateImpl(size_t maxNumTotalPermutations) const override;
+};
+
 } // namespace ConstrainedResource
 } // namespace DecisionEngine
 
 SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::StandardPermutationGenerator);
 SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::StandardPermutationGeneratorFactory);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::IncrementalPermutationGeneratorFactory);
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          StridedPermutationGenerator.cpp
+///  \brief         See StridedPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "StridedPermutationGenerator.h"
+#include "RankedPermutationGenerator.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+// ----------------------------------------------------------------------
+// |
+// |  StridedPermutationGenerator
+// |
+// ----------------------------------------------------------------------
+// static
+size_t StridedPermutationGenerator::GetStride(size_t numPermutations) {
+    ENSURE_ARGUMENT(numPermutations);
+
+    if(numPermutations <= 2)
+        return 1;
+
+    size_t                                  result(
+        std::max(
+            static_cast<size_t>(static_cast<long double>(numPermutations) * 0.6180339887498948L),
+            static_cast<size_t>(1)
+        )
+    );
+
+    while(std::gcd(result, numPermutations) != 1)
+        ++result;
+
+    assert(result < numPermutations);
+    return result;
+}
+
+StridedPermutationGenerator::StridedPermutationGenerator(size_t maxNumPermutations/*=std::numeric_limits<size_t>::max()*/) :
+    PermutationGenerator(std::move(maxNumPermutations)),
+    _stride(0),
+    _rank(0),
+    _numGenerated(0)
+{}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+StridedPermutationGenerator::RequestIndexesPtrs StridedPermutationGenerator::GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) /*override*/ {
+    assert(requests.empty() == false && std::all_of(requests.cbegin(), requests.cend(), [](RequestPtr const &ptr) { return static_cast<bool>(ptr); }));
+    assert(maxNumPermutations);
+    assert(IsComplete() == false);
+
+    size_t const                            numPermutations(RankedPermutationGenerator::GetNumPermutations(requests.size()));
+
+    if(_stride == 0)
+        _stride = GetStride(numPermutations);
+
+    RequestIndexesPtrs                      results;
+
+    while(maxNumPermutations--) {
+        results.emplace_back(std::make_shared<RequestIndexes>(RankedPermutationGenerator::Unrank(requests.size(), _rank)));
+
+        if(++_numGenerated == numPermutations) {
+            assert(_isActive);
+            _isActive = false;
+
+            break;
+        }
+
+        // (_rank + _stride) % numPermutations, without overflow
+        _rank = _rank >= numPermutations - _stride ? _rank - (numPermutations - _stride) : _rank + _stride;
+    }
+
+    return results;
+}
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::StridedPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DEFINE(DecisionEngine::ConstrainedResource::StridedPermutationGeneratorFactory);
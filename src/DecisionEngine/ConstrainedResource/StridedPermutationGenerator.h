@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          StridedPermutationGenerator.h
+///  \brief         Contains the StridedPermutationGenerator object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ConstrainedResource.h"
+#include "PermutationGenerator.h"
+#include "PermutationGeneratorFactory.h"
+
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         StridedPermutationGenerator
+///  \brief         PermutationGenerator that visits permutation ranks (see
+///                 `RankedPermutationGenerator`) with a fixed stride, so that
+///                 consecutive permutations differ in their leading Requests.
+///
+///                 The stride is near the number of permutations divided by
+///                 the golden ratio and is coprime with the number of
+///                 permutations, so every permutation is generated exactly
+///                 once. A limited number of permutations samples the space
+///                 evenly rather than varying only the last Requests.
+///
+///                 As with `RankedPermutationGenerator`, only the first
+///                 `std::numeric_limits<size_t>::max()` permutations of groups
+///                 with more than 20 Requests can be generated.
+///
+class StridedPermutationGenerator : public PermutationGenerator {
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data (used in public declarations)
+    // |
+    // ----------------------------------------------------------------------
+    size_t                                  _stride;
+    size_t                                  _rank;
+    size_t                                  _numGenerated;
+
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the stride used for the provided number of permutations.
+    static size_t GetStride(size_t numPermutations);
+
+    StridedPermutationGenerator(size_t maxNumPermutations=std::numeric_limits<size_t>::max());
+    ~StridedPermutationGenerator(void) override = default;
+
+#define ARGS                                MEMBERS(_stride, _rank, _numGenerated), BASES(PermutationGenerator)
+
+    NON_COPYABLE(StridedPermutationGenerator);
+    MOVE(StridedPermutationGenerator, ARGS);
+    COMPARE(StridedPermutationGenerator, ARGS);
+    SERIALIZATION(StridedPermutationGenerator, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGenerator)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         StridedPermutationGeneratorFactory
+///  \brief         Factory that generates StridedPermutationGenerator instances
+///
+class StridedPermutationGeneratorFactory : public PermutationGeneratorFactoryImpl<StridedPermutationGenerator>
+{
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using BaseType                          = PermutationGeneratorFactoryImpl<StridedPermutationGenerator>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using BaseType::BaseType;
+
+#define ARGS                                BASES(BaseType)
+
+    NON_COPYABLE(StridedPermutationGeneratorFactory);
+    MOVE(StridedPermutationGeneratorFactory, ARGS);
+    COMPARE(StridedPermutationGeneratorFactory, ARGS);
+    SERIALIZATION(StridedPermutationGeneratorFactory, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(PermutationGeneratorFactory)));
+
+#undef ARGS
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::StridedPermutationGenerator);
+SERIALIZATION_POLYMORPHIC_DECLARE(DecisionEngine::ConstrainedResource::StridedPermutationGeneratorFactory);
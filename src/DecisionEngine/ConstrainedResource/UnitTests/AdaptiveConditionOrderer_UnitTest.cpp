@@ -0,0 +1,374 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AdaptiveConditionOrderer_UnitTest.cpp
+///  \brief         Unit test for AdaptiveConditionOrderer.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:45:01
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../AdaptiveConditionOrderer.h"
+#include <catch.hpp>
+
+#include "../Request.h"
+#include "../Resource.h"
+
+#include <thread>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+namespace Components                        = DecisionEngine::Core::Components;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyCondition : public NS::Condition {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+    bool const                              _result;
+    std::chrono::milliseconds const         _delay;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    mutable std::atomic<size_t>             NumApplications{0};
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyCondition);
+
+    template <typename PrivateConstructorTagT>
+    MyCondition(PrivateConstructorTagT tag, bool result, std::chrono::milliseconds delay=std::chrono::milliseconds(0)) :
+        NS::Condition(tag, "MyCondition", 100),
+        _result(result),
+        _delay(delay)
+    {}
+
+    ~MyCondition(void) override = default;
+
+#define ARGS                                MEMBERS(_result, _delay), BASES(NS::Condition)
+
+    NON_COPYABLE(MyCondition);
+    MOVE(MyCondition, ARGS);
+    COMPARE(MyCondition, ARGS);
+    SERIALIZATION(MyCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(MyCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &, Resource const &) const override {
+        ++NumApplications;
+
+        if(_delay.count())
+            std::this_thread::sleep_for(_delay);
+
+        return Result(SharedFromThis(), _result);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyCondition);
+
+class MyResource : public NS::Resource {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyResource);
+
+    template <typename PrivateContructorTagT>
+    MyResource(PrivateContructorTagT tag, std::string name, ConditionPtrsPtr optionalRequirementConditions=ConditionPtrsPtr()) :
+        NS::Resource(tag, std::move(name), ConditionPtrsPtr(), std::move(optionalRequirementConditions))
+    {}
+
+    template <typename PrivateConstructorTagT>
+    MyResource(PrivateConstructorTagT tag, MyResource const &other) :
+        NS::Resource(tag, other)
+    {}
+
+    ~MyResource(void) override = default;
+
+#define ARGS                                BASES(NS::Resource)
+
+    NON_COPYABLE(MyResource);
+    MOVE(MyResource, ARGS);
+    COMPARE(MyResource, ARGS);
+    SERIALIZATION(MyResource, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(NS::Resource)));
+
+#undef ARGS
+
+    using NS::Resource::CalculateResult;
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    EvaluateResult EvaluateImpl(Request const &, size_t, bool) const override {
+        return EvaluateResult(Evaluations(), std::make_shared<State>(*this));
+    }
+
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &, bool isFailFast) const override {
+        return EvaluateImpl(request, maxNumEvaluations, isFailFast);
+    }
+
+    ResourcePtr ApplyImpl(State const &) const override {
+        return MyResource::Create(*this);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Statistics") {
+    using Statistics                        = NS::AdaptiveConditionOrderer::Statistics;
+
+    CHECK(Statistics(0, 0, std::chrono::nanoseconds(0)).AverageCost() == std::chrono::nanoseconds(0));
+    CHECK(Statistics(4, 2, std::chrono::nanoseconds(400)).AverageCost() == std::chrono::nanoseconds(100));
+
+    CHECK(Approx(Statistics(0, 0, std::chrono::nanoseconds(0)).FailureRate()) == 0.5f);
+    CHECK(Approx(Statistics(8, 0, std::chrono::nanoseconds(0)).FailureRate()) == 0.1f);
+    CHECK(Approx(Statistics(8, 8, std::chrono::nanoseconds(0)).FailureRate()) == 0.9f);
+
+    CHECK(Approx(Statistics(8, 3, std::chrono::nanoseconds(800)).Rank()) == 250.0);
+
+    // Conditions that fail more often are ranked lower
+    CHECK(Statistics(8, 6, std::chrono::nanoseconds(800)).Rank() < Statistics(8, 2, std::chrono::nanoseconds(800)).Rank());
+
+    // Conditions that are cheaper are ranked lower
+    CHECK(Statistics(8, 2, std::chrono::nanoseconds(400)).Rank() < Statistics(8, 2, std::chrono::nanoseconds(800)).Rank());
+}
+
+TEST_CASE("Apply") {
+    std::shared_ptr<MyCondition> const      pSuccessful(MyCondition::Create(true, std::chrono::milliseconds(1)));
+    std::shared_ptr<MyCondition> const      pFailed(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+    NS::AdaptiveConditionOrderer            orderer(1, 1);
+
+    auto const                              applyFunc(
+        [&request, &pResource](NS::Condition const &condition) {
+            return condition.Apply(request, *pResource);
+        }
+    );
+
+    for(size_t index = 0; index < 10; ++index)
+        CHECK(orderer.Apply(*pSuccessful, applyFunc).IsSuccessful);
+
+    CHECK(orderer.Apply(*pFailed, applyFunc).IsSuccessful == false);
+    CHECK(pSuccessful->NumApplications == 10);
+    CHECK(pFailed->NumApplications == 1);
+
+    NS::AdaptiveConditionOrderer::ConditionStatistics const             statistics(orderer.GetStatistics());
+
+    REQUIRE(statistics.size() == 2);
+
+    // The failed Condition will be applied first
+    CHECK(std::get<0>(statistics[0]) == pFailed.get());
+    CHECK(std::get<1>(statistics[0]).NumSamples == 1);
+    CHECK(std::get<1>(statistics[0]).NumFailures == 1);
+
+    CHECK(std::get<0>(statistics[1]) == pSuccessful.get());
+    CHECK(std::get<1>(statistics[1]).NumSamples == 10);
+    CHECK(std::get<1>(statistics[1]).NumFailures == 0);
+    CHECK(std::get<1>(statistics[1]).SampledDuration >= std::chrono::milliseconds(10));
+
+    orderer.Clear();
+    CHECK(orderer.GetStatistics().empty());
+    CHECK(orderer.GetOrder(NS::AdaptiveConditionOrderer::Conditions{ pSuccessful.get(), pFailed.get() }) == NS::AdaptiveConditionOrderer::Indexes{ 0, 1 });
+}
+
+TEST_CASE("Apply - Sampling") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+    NS::AdaptiveConditionOrderer            orderer(4);
+
+    for(size_t index = 0; index < 1000; ++index) {
+        CHECK(
+            orderer.Apply(
+                *pCondition,
+                [&request, &pResource](NS::Condition const &condition) {
+                    return condition.Apply(request, *pResource);
+                }
+            ).IsSuccessful == false
+        );
+    }
+
+    // Every application is performed, but only about 1 in 4 is recorded
+    CHECK(pCondition->NumApplications == 1000);
+
+    NS::AdaptiveConditionOrderer::ConditionStatistics const             statistics(orderer.GetStatistics());
+
+    REQUIRE(statistics.size() == 1);
+    CHECK(std::get<1>(statistics[0]).NumSamples > 150);
+    CHECK(std::get<1>(statistics[0]).NumSamples < 350);
+    CHECK(std::get<1>(statistics[0]).NumFailures == std::get<1>(statistics[0]).NumSamples);
+}
+
+TEST_CASE("GetOrder") {
+    std::shared_ptr<MyCondition> const      pCheap(MyCondition::Create(false));
+    std::shared_ptr<MyCondition> const      pExpensive(MyCondition::Create(true, std::chrono::milliseconds(5)));
+    std::shared_ptr<MyCondition> const      pUnknown(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+    NS::AdaptiveConditionOrderer            orderer(1, 2);
+
+    auto const                              applyFunc(
+        [&request, &pResource](NS::Condition const &condition) {
+            return condition.Apply(request, *pResource);
+        }
+    );
+
+    NS::AdaptiveConditionOrderer::Conditions const      conditions{ pExpensive.get(), pCheap.get(), pUnknown.get() };
+
+    // Conditions are applied in their original order until enough is known about them
+    CHECK(orderer.GetOrder(conditions) == NS::AdaptiveConditionOrderer::Indexes{ 0, 1, 2 });
+
+    orderer.Apply(*pExpensive, applyFunc);
+    orderer.Apply(*pCheap, applyFunc);
+    CHECK(orderer.GetOrder(conditions) == NS::AdaptiveConditionOrderer::Indexes{ 0, 1, 2 });
+
+    orderer.Apply(*pExpensive, applyFunc);
+    orderer.Apply(*pCheap, applyFunc);
+    CHECK(orderer.GetOrder(conditions) == NS::AdaptiveConditionOrderer::Indexes{ 2, 1, 0 });
+
+    CHECK(orderer.GetOrder(NS::AdaptiveConditionOrderer::Conditions()).empty());
+}
+
+TEST_CASE("CalculateResult") {
+    std::shared_ptr<MyCondition> const      pExpensive(MyCondition::Create(true, std::chrono::milliseconds(5)));
+    std::shared_ptr<MyCondition> const      pCheap(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource", std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ pExpensive, pCheap })));
+    NS::AdaptiveConditionOrderer            orderer(1, 1);
+
+    // Both Conditions are applied while the statistics are learned
+    Components::Score::Result const         result1(MyResource::CalculateResult(request, *pResource, true, nullptr, &orderer));
+
+    CHECK(result1 == MyResource::CalculateResult(request, *pResource, true));
+    CHECK(pExpensive->NumApplications == 2);
+    CHECK(pCheap->NumApplications == 2);
+
+    // The cheap Condition that fails is applied first
+    Components::Score::Result const         result2(MyResource::CalculateResult(request, *pResource, true, nullptr, &orderer));
+
+    CHECK(result2.IsSuccessful == false);
+    CHECK(result2.IsPartial);
+    REQUIRE(result2.RequirementResults.size() == 1);
+    CHECK(result2.RequirementResults[0].Condition == pCheap);
+    CHECK(pExpensive->NumApplications == 2);
+    CHECK(pCheap->NumApplications == 3);
+
+    // The order is only changed when evaluation stops at the first failure
+    Components::Score::Result const         result3(MyResource::CalculateResult(request, *pResource, false, nullptr, &orderer));
+
+    REQUIRE(result3.RequirementResults.size() == 2);
+    CHECK(result3.RequirementResults[0].Condition == pExpensive);
+    CHECK(result3.RequirementResults[1].Condition == pCheap);
+}
+
+TEST_CASE("Concurrency") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+    NS::AdaptiveConditionOrderer            orderer(8);
+    std::vector<std::thread>                threads;
+
+    for(size_t threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back(
+            [&orderer, &pCondition, &request, &pResource](void) {
+                for(size_t iteration = 0; iteration < 1000; ++iteration) {
+                    orderer.Apply(
+                        *pCondition,
+                        [&request, &pResource](NS::Condition const &condition) {
+                            return condition.Apply(request, *pResource);
+                        }
+                    );
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    NS::AdaptiveConditionOrderer::ConditionStatistics const             statistics(orderer.GetStatistics());
+
+    REQUIRE(statistics.size() == 1);
+    CHECK(std::get<1>(statistics[0]).NumSamples > 350);
+    CHECK(std::get<1>(statistics[0]).NumSamples < 650);
+    CHECK(std::get<1>(statistics[0]).NumFailures == std::get<1>(statistics[0]).NumSamples);
+}
+
+TEST_CASE("Concurrency - Clear") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(false));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+    NS::AdaptiveConditionOrderer            orderer(1);
+    std::vector<std::thread>                threads;
+
+    for(size_t threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back(
+            [&orderer, &pCondition, &request, &pResource](void) {
+                for(size_t iteration = 0; iteration < 1000; ++iteration) {
+                    orderer.Apply(
+                        *pCondition,
+                        [&request, &pResource](NS::Condition const &condition) {
+                            return condition.Apply(request, *pResource);
+                        }
+                    );
+                }
+            }
+        );
+    }
+
+    // Entries are removed while they are being updated
+    for(size_t iteration = 0; iteration < 100; ++iteration)
+        orderer.Clear();
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(pCondition->NumApplications == 4000);
+
+    NS::AdaptiveConditionOrderer::ConditionStatistics const             statistics(orderer.GetStatistics());
+
+    REQUIRE(statistics.size() <= 1);
+
+    if(statistics.empty() == false) {
+        CHECK(std::get<1>(statistics[0]).NumSamples <= 4000);
+        CHECK(std::get<1>(statistics[0]).NumFailures == std::get<1>(statistics[0]).NumSamples);
+    }
+
+    orderer.Clear();
+    CHECK(orderer.GetStatistics().empty());
+}
+
+TEST_CASE("Invalid Args") {
+    CHECK_THROWS_MATCHES(
+        NS::AdaptiveConditionOrderer(0),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("samplingInterval")
+    );
+
+    CHECK_THROWS_MATCHES(
+        NS::AdaptiveConditionOrderer(16, 16, 0),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("numShards")
+    );
+}
@@ -55,11 +55,11 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    EvaluateResult EvaluateImpl(Request const &, size_t) const override {
+    EvaluateResult EvaluateImpl(Request const &, size_t, bool) const override {
         return EvaluateResult(Evaluations(), ContinuationStatePtr());
     }
 
-    EvaluateResult EvaluateImpl(Request const &, size_t, State &) const override {
+    EvaluateResult EvaluateImpl(Request const &, size_t, State &, bool) const override {
         return EvaluateResult(Evaluations(), ContinuationStatePtr());
     }
 
@@ -0,0 +1,311 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ConditionCache_UnitTest.cpp
+///  \brief         Unit test for ConditionCache.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:33:10
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../ConditionCache.h"
+#include <catch.hpp>
+
+#include "../Request.h"
+#include "../Resource.h"
+
+#include <thread>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+namespace Components                        = DecisionEngine::Core::Components;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyCondition : public NS::Condition {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+    bool const                              _isPure;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    mutable std::atomic<size_t>             NumApplications{0};
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyCondition);
+
+    template <typename PrivateConstructorTagT>
+    MyCondition(PrivateConstructorTagT tag, bool isPure) :
+        NS::Condition(tag, "MyCondition", 100),
+        _isPure(isPure)
+    {}
+
+    ~MyCondition(void) override = default;
+
+#define ARGS                                MEMBERS(_isPure), BASES(NS::Condition)
+
+    NON_COPYABLE(MyCondition);
+    MOVE(MyCondition, ARGS);
+    COMPARE(MyCondition, ARGS);
+    SERIALIZATION(MyCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(MyCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &, Resource const &resource) const override {
+        ++NumApplications;
+        return Result(SharedFromThis(), true, [name = resource.Name](void) { return "Applied to " + name; });
+    }
+
+    bool IsPure(void) const override {
+        return _isPure;
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyCondition);
+
+class MyResource : public NS::Resource {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+
+    // A hash of 0 indicates that a hash isn't available
+    size_t const                            _stateHash;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyResource);
+
+    template <typename PrivateContructorTagT>
+    MyResource(PrivateContructorTagT tag, std::string name, size_t stateHash, ConditionPtrsPtr optionalRequirementConditions=ConditionPtrsPtr()) :
+        NS::Resource(tag, std::move(name), ConditionPtrsPtr(), std::move(optionalRequirementConditions)),
+        _stateHash(stateHash)
+    {}
+
+    template <typename PrivateConstructorTagT>
+    MyResource(PrivateConstructorTagT tag, MyResource const &other) :
+        NS::Resource(tag, other),
+        _stateHash(other._stateHash)
+    {}
+
+    ~MyResource(void) override = default;
+
+#define ARGS                                MEMBERS(_stateHash), BASES(NS::Resource)
+
+    NON_COPYABLE(MyResource);
+    MOVE(MyResource, ARGS);
+    COMPARE(MyResource, ARGS);
+    SERIALIZATION(MyResource, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(NS::Resource)));
+
+#undef ARGS
+
+    using NS::Resource::CalculateResult;
+
+    std::optional<size_t> GetStateHash(void) const override {
+        if(_stateHash == 0)
+            return std::nullopt;
+
+        return _stateHash;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    EvaluateResult EvaluateImpl(Request const &, size_t, bool) const override {
+        return EvaluateResult(Evaluations(), std::make_shared<State>(*this));
+    }
+
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &, bool isFailFast) const override {
+        return EvaluateImpl(request, maxNumEvaluations, isFailFast);
+    }
+
+    ResourcePtr ApplyImpl(State const &) const override {
+        return MyResource::Create(*this);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Hits") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(true));
+    NS::Request const                       request("Request");
+    NS::ConditionCache                      cache(100);
+
+    NS::ResourcePtr const                   pResource1(MyResource::Create("Resource1", 1));
+    NS::ResourcePtr const                   pResource2(MyResource::Create("Resource2", 1));
+    NS::ResourcePtr const                   pResource3(MyResource::Create("Resource3", 2));
+
+    NS::ConditionCache::Result const        result1(cache.Apply(*pCondition, request, *pResource1));
+
+    CHECK(result1.IsSuccessful);
+    CHECK(result1.Reason == "Applied to Resource1");
+    CHECK(pCondition->NumApplications == 1);
+
+    // Resources with the same state hash produce the same results
+    NS::ConditionCache::Result const        result2(cache.Apply(*pCondition, request, *pResource2));
+
+    CHECK(result2 == result1);
+    CHECK(result2.Reason == "Applied to Resource1");
+
+    // Reasons are cached without being materialized
+    CHECK(result2.Reason.IsLazy());
+    CHECK(pCondition->NumApplications == 1);
+
+    cache.Apply(*pCondition, request, *pResource3);
+    CHECK(pCondition->NumApplications == 2);
+
+    // Different Requests are cached independently
+    cache.Apply(*pCondition, NS::Request("Other"), *pResource1);
+    CHECK(pCondition->NumApplications == 3);
+
+    NS::ConditionCache::Statistics const    statistics(cache.GetStatistics());
+
+    CHECK(statistics.NumHits == 1);
+    CHECK(statistics.NumMisses == 3);
+    CHECK(statistics.NumEvictions == 0);
+    CHECK(statistics.NumUncacheable == 0);
+    CHECK(Approx(statistics.HitRate()) == 0.25f);
+}
+
+TEST_CASE("Uncacheable") {
+    std::shared_ptr<MyCondition> const      pImpureCondition(MyCondition::Create(false));
+    std::shared_ptr<MyCondition> const      pPureCondition(MyCondition::Create(true));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource", 1));
+    NS::ResourcePtr const                   pUnhashedResource(MyResource::Create("Resource", 0));
+    NS::ConditionCache                      cache(100);
+
+    cache.Apply(*pImpureCondition, request, *pResource);
+    cache.Apply(*pImpureCondition, request, *pResource);
+    CHECK(pImpureCondition->NumApplications == 2);
+
+    cache.Apply(*pPureCondition, request, *pUnhashedResource);
+    cache.Apply(*pPureCondition, request, *pUnhashedResource);
+    CHECK(pPureCondition->NumApplications == 2);
+
+    NS::ConditionCache::Statistics const    statistics(cache.GetStatistics());
+
+    CHECK(statistics.NumHits == 0);
+    CHECK(statistics.NumMisses == 0);
+    CHECK(statistics.NumUncacheable == 4);
+    CHECK(statistics.HitRate() == 0.0f);
+}
+
+TEST_CASE("Eviction") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(true));
+    NS::Request const                       request("Request");
+    NS::ConditionCache                      cache(2, 1);
+
+    NS::ResourcePtr const                   pResource1(MyResource::Create("Resource1", 1));
+    NS::ResourcePtr const                   pResource2(MyResource::Create("Resource2", 2));
+    NS::ResourcePtr const                   pResource3(MyResource::Create("Resource3", 3));
+
+    cache.Apply(*pCondition, request, *pResource1);
+    cache.Apply(*pCondition, request, *pResource2);
+
+    // Resource1 becomes the most recently used entry, so Resource2 is evicted
+    cache.Apply(*pCondition, request, *pResource1);
+    cache.Apply(*pCondition, request, *pResource3);
+    CHECK(pCondition->NumApplications == 3);
+    CHECK(cache.GetStatistics().NumEvictions == 1);
+
+    cache.Apply(*pCondition, request, *pResource1);
+    CHECK(pCondition->NumApplications == 3);
+
+    cache.Apply(*pCondition, request, *pResource2);
+    CHECK(pCondition->NumApplications == 4);
+
+    cache.Clear();
+    cache.Apply(*pCondition, request, *pResource1);
+    CHECK(pCondition->NumApplications == 5);
+}
+
+TEST_CASE("CalculateResult") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(true));
+    NS::Request const                       request("Request");
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource", 1, std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ pCondition })));
+    NS::ConditionCache                      cache(100);
+
+    Components::Score::Result const         result1(MyResource::CalculateResult(request, *pResource, false, &cache));
+    Components::Score::Result const         result2(MyResource::CalculateResult(request, *pResource, false, &cache));
+
+    CHECK(result1 == result2);
+    CHECK(result1 == MyResource::CalculateResult(request, *pResource));
+    CHECK(pCondition->NumApplications == 2);
+    CHECK(cache.GetStatistics().NumHits == 1);
+}
+
+TEST_CASE("Concurrency") {
+    std::shared_ptr<MyCondition> const      pCondition(MyCondition::Create(true));
+    NS::Request const                       request("Request");
+    NS::ConditionCache                      cache(1000);
+    std::vector<NS::ResourcePtr>            resources;
+
+    for(size_t index = 1; index <= 100; ++index)
+        resources.emplace_back(MyResource::Create("Resource" + std::to_string(index), index));
+
+    std::atomic<size_t>                     numInvalid(0);
+    std::vector<std::thread>                threads;
+
+    for(size_t threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back(
+            [&cache, &pCondition, &request, &resources, &numInvalid](void) {
+                // Catch assertions are not thread safe
+                for(size_t iteration = 0; iteration < 10; ++iteration) {
+                    for(auto const &pResource : resources) {
+                        if(cache.Apply(*pCondition, request, *pResource).Reason != "Applied to " + pResource->Name)
+                            ++numInvalid;
+                    }
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(numInvalid == 0);
+
+    NS::ConditionCache::Statistics const    statistics(cache.GetStatistics());
+
+    CHECK(statistics.NumHits + statistics.NumMisses == 4000);
+    CHECK(statistics.NumMisses == pCondition->NumApplications);
+    CHECK(statistics.NumMisses >= 100);
+    CHECK(statistics.NumEvictions == 0);
+}
+
+TEST_CASE("Invalid Args") {
+    CHECK_THROWS_MATCHES(
+        NS::ConditionCache(0),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("maxNumEntries")
+    );
+
+    CHECK_THROWS_MATCHES(
+        NS::ConditionCache(10, 0),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("numShards")
+    );
+}
@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          DistinctPermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for DistinctPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:19:35
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../DistinctPermutationGenerator.h"
+#include "../Request.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class KeyedRequest : public NS::Request {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::string const                       Key;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    KeyedRequest(std::string name, std::string key) :
+        NS::Request(std::move(name)),
+        Key(std::move(key))
+    {}
+
+    ~KeyedRequest(void) override = default;
+
+    std::optional<std::string> GetEquivalenceKey(void) const override {
+        return Key;
+    }
+};
+
+std::string ToString(NS::RequestPtrs const &requests, NS::DistinctPermutationGenerator::RequestIndexesPtrs const &permutations) {
+    std::string                             result;
+
+    for(auto const &pPermutation : permutations) {
+        for(auto index : *pPermutation)
+            result += requests[index]->Name;
+
+        result += " ";
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Unique") {
+    NS::DistinctPermutationGenerator::RequestPtrs const                     requests{
+        std::make_shared<KeyedRequest>("a", "1"),
+        std::make_shared<KeyedRequest>("b", "2"),
+        std::make_shared<KeyedRequest>("c", "3")
+    };
+
+    CHECK(ToString(requests, NS::DistinctPermutationGenerator().Generate(requests, 10000)) == "abc acb bac bca cab cba ");
+}
+
+TEST_CASE("Equivalent Keys") {
+    NS::DistinctPermutationGenerator::RequestPtrs const                     requests{
+        std::make_shared<KeyedRequest>("a", "1"),
+        std::make_shared<KeyedRequest>("b", "2"),
+        std::make_shared<KeyedRequest>("c", "1"),
+        std::make_shared<KeyedRequest>("d", "1")
+    };
+
+    // 4! / 3! orderings; equivalent Requests maintain their original order
+    CHECK(ToString(requests, NS::DistinctPermutationGenerator().Generate(requests, 10000)) == "acdb acbd abcd bacd ");
+}
+
+TEST_CASE("Equivalent Conditions") {
+    NS::DistinctPermutationGenerator::RequestPtrs const                     requests{
+        std::make_shared<NS::Request>("a"),
+        std::make_shared<KeyedRequest>("b", "1"),
+        std::make_shared<NS::Request>("c")
+    };
+
+    CHECK(ToString(requests, NS::DistinctPermutationGenerator().Generate(requests, 10000)) == "acb abc bac ");
+}
+
+TEST_CASE("Multiple Calls") {
+    NS::DistinctPermutationGenerator::RequestPtrs const                     requests{
+        std::make_shared<KeyedRequest>("a", "1"),
+        std::make_shared<KeyedRequest>("b", "1"),
+        std::make_shared<KeyedRequest>("c", "2"),
+        std::make_shared<KeyedRequest>("d", "2")
+    };
+
+    NS::DistinctPermutationGenerator        generator;
+
+    CHECK(ToString(requests, generator.Generate(requests, 4)) == "abcd acbd acdb cabd ");
+    CHECK(generator.IsComplete() == false);
+    CHECK(ToString(requests, generator.Generate(requests, 4)) == "cadb cdab ");
+    CHECK(generator.IsComplete());
+}
+
+TEST_CASE("Factory") {
+    CHECK(NS::DistinctPermutationGeneratorFactory(10).Create());
+    CHECK(NS::DistinctPermutationGeneratorFactory(10).IsIncremental() == false);
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::DistinctPermutationGenerator(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::DistinctPermutationGeneratorFactory(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
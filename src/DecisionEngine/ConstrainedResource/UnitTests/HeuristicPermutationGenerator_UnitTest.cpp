@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          HeuristicPermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for HeuristicPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../HeuristicPermutationGenerator.h"
+#include "../Request.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+class PriorityRequest : public NS::Request {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    float const                             Priority;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    PriorityRequest(std::string name, float priority) :
+        NS::Request(std::move(name)),
+        Priority(priority)
+    {}
+
+    ~PriorityRequest(void) override = default;
+
+    float GetPriority(void) const override {
+        return Priority;
+    }
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Priority Order") {
+    NS::RequestPtrs const                   requests{
+        std::make_shared<PriorityRequest>("a", 1.0f),
+        std::make_shared<PriorityRequest>("b", 3.0f),
+        std::make_shared<PriorityRequest>("c", 1.0f),
+        std::make_shared<PriorityRequest>("d", 2.0f)
+    };
+
+    NS::HeuristicPermutationGenerator       generator;
+    NS::HeuristicPermutationGenerator::RequestIndexesPtrs const            results(generator.Generate(requests, 3));
+
+    REQUIRE(results.size() == 3);
+
+    // Highest priority first; equal priorities retain their order
+    CHECK(*results[0] == NS::RequestIndexes{ 1, 3, 0, 2 });
+
+    // The least important Requests are permuted first
+    CHECK(*results[1] == NS::RequestIndexes{ 1, 3, 2, 0 });
+    CHECK(*results[2] == NS::RequestIndexes{ 1, 0, 3, 2 });
+}
+
+TEST_CASE("All Permutations") {
+    NS::RequestPtrs const                   requests{
+        std::make_shared<PriorityRequest>("a", 1.0f),
+        std::make_shared<PriorityRequest>("b", 2.0f),
+        std::make_shared<PriorityRequest>("c", 3.0f)
+    };
+
+    NS::HeuristicPermutationGenerator       generator;
+    NS::HeuristicPermutationGenerator::RequestIndexesPtrs const            results(generator.Generate(requests, 10000));
+
+    CHECK(results.size() == 6);
+    CHECK(generator.IsComplete());
+    CHECK(*results[0] == NS::RequestIndexes{ 2, 1, 0 });
+    CHECK(*results[5] == NS::RequestIndexes{ 0, 1, 2 });
+}
+
+TEST_CASE("Default Priority") {
+    // Without priorities, the order is the same as StandardPermutationGenerator
+    NS::RequestPtrs const                   requests{ std::make_shared<NS::Request>("a"), std::make_shared<NS::Request>("b") };
+    NS::HeuristicPermutationGenerator::RequestIndexesPtrs const            results(NS::HeuristicPermutationGenerator().Generate(requests, 10000));
+
+    REQUIRE(results.size() == 2);
+    CHECK(*results[0] == NS::RequestIndexes{ 0, 1 });
+    CHECK(*results[1] == NS::RequestIndexes{ 1, 0 });
+}
+
+TEST_CASE("Factory") {
+    CHECK(NS::HeuristicPermutationGeneratorFactory(10).Create());
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::HeuristicPermutationGenerator(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::HeuristicPermutationGeneratorFactory(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
@@ -54,8 +54,8 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    RequestPtrsPtrs GenerateImpl(RequestPtrs const &, size_t) override {
-        return RequestPtrsPtrs();
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &, size_t) override {
+        return RequestIndexesPtrs();
     }
 };
 
@@ -87,32 +87,39 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    RequestPtrsPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override {
+    RequestIndexesPtrs GenerateImpl(RequestPtrs const &requests, size_t maxNumPermutations) override {
         if(_autoComplete)
             _isActive = false;
 
+        RequestIndexes                      indexes;
+
+        for(RequestIndex index = 0; index < requests.size(); ++index)
+            indexes.emplace_back(index);
+
         if(_generateType == GenerateType::Valid)
-            return RequestPtrsPtrs{ std::make_shared<RequestPtrs>(requests) };
+            return RequestIndexesPtrs{ std::make_shared<RequestIndexes>(indexes) };
         if(_generateType == GenerateType::Empty)
-            return RequestPtrsPtrs();
+            return RequestIndexesPtrs();
         if(_generateType == GenerateType::InvalidPointer)
-            return RequestPtrsPtrs{ std::make_shared<RequestPtrs>() };
-        if(_generateType == GenerateType::InvalidRequestsPtr)
-            return RequestPtrsPtrs{ std::make_shared<RequestPtrs>(RequestPtrs{ RequestPtr() }) };
+            return RequestIndexesPtrs{ std::make_shared<RequestIndexes>() };
+        if(_generateType == GenerateType::InvalidRequestsPtr) {
+            indexes.back() = static_cast<RequestIndex>(requests.size());
+            return RequestIndexesPtrs{ std::make_shared<RequestIndexes>(indexes) };
+        }
         if(_generateType == GenerateType::TooMany) {
-            RequestPtrsPtrs                 results;
+            RequestIndexesPtrs              results;
 
             while(maxNumPermutations--)
-                results.emplace_back(std::make_shared<RequestPtrs>(requests));
+                results.emplace_back(std::make_shared<RequestIndexes>(indexes));
 
-            results.emplace_back(std::make_shared<RequestPtrs>(requests));
+            results.emplace_back(std::make_shared<RequestIndexes>(indexes));
 
             return results;
         }
         else
             assert(!"Unrecognized GenerateType");
 
-        return RequestPtrsPtrs();
+        return RequestIndexesPtrs();
     }
 };
 
@@ -147,10 +154,10 @@ TEST_CASE("Generate") {
 
         CHECK(generator.IsComplete() == false);
 
-        MyPermutationGenerator::RequestPtrsPtrs const   results(generator.Generate(requests, 1));
+        MyPermutationGenerator::RequestIndexesPtrs const    results(generator.Generate(requests, 1));
 
         REQUIRE(results.size() == 1);
-        CHECK(*results[0] == requests);
+        CHECK(*results[0] == MyPermutationGenerator::RequestIndexes{ 0, 1 });
 
         // Attempts to invoke Generate after the generator is complete should result in errors
         CHECK(generator.IsComplete());
@@ -179,7 +186,7 @@ TEST_CASE("Generate") {
         CHECK_THROWS_MATCHES(
             generator.Generate(requests, 1),
             std::runtime_error,
-            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestPtrsPtrs")
+            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestIndexesPtrs")
         );
     }
 
@@ -189,7 +196,7 @@ TEST_CASE("Generate") {
         CHECK_THROWS_MATCHES(
             generator.Generate(requests, 1),
             std::runtime_error,
-            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestPtrsPtrs")
+            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestIndexesPtrs")
         );
     }
 
@@ -199,7 +206,7 @@ TEST_CASE("Generate") {
         CHECK_THROWS_MATCHES(
             generator.Generate(requests, 1),
             std::runtime_error,
-            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestPtrsPtrs")
+            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestIndexesPtrs")
         );
     }
 
@@ -209,7 +216,7 @@ TEST_CASE("Generate") {
         CHECK_THROWS_MATCHES(
             generator.Generate(requests, 1),
             std::runtime_error,
-            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestPtrsPtrs")
+            Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid RequestIndexesPtrs")
         );
     }
 }
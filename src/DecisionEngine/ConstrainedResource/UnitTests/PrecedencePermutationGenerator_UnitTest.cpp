@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PrecedencePermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for PrecedencePermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:30:34
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../PrecedencePermutationGenerator.h"
+#include "../Request.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+NS::PermutationGenerator::RequestPtrs CreateRequests(std::vector<std::string> const &names) {
+    NS::PermutationGenerator::RequestPtrs   results;
+
+    for(auto const &name : names)
+        results.emplace_back(std::make_shared<NS::Request>(name));
+
+    return results;
+}
+
+std::vector<NS::RequestIndexes> ToVector(NS::PermutationGenerator::RequestIndexesPtrs const &permutations) {
+    std::vector<NS::RequestIndexes>         results;
+
+    for(auto const &pPermutation : permutations)
+        results.emplace_back(*pPermutation);
+
+    return results;
+}
+
+NS::PrecedencePermutationGenerator::ConstraintsPtr CreateConstraints(NS::PrecedencePermutationGenerator::Constraints constraints) {
+    return std::make_shared<NS::PrecedencePermutationGenerator::Constraints>(std::move(constraints));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Linear Extensions") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B", "C", "D" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({ { "A", "B" }, { "A", "C" } }));
+    std::vector<NS::RequestIndexes>                                         results(ToVector(generator.Generate(requests, 3)));
+
+    CHECK(results.size() == 3);
+    CHECK(generator.IsComplete() == false);
+
+    for(auto &permutation : ToVector(generator.Generate(requests, 100)))
+        results.emplace_back(std::move(permutation));
+
+    CHECK(generator.IsComplete());
+
+    // "A" is always applied before "B" and "C"
+    CHECK(
+        results == std::vector<NS::RequestIndexes>{
+            { 0, 1, 2, 3 },
+            { 0, 1, 3, 2 },
+            { 0, 2, 1, 3 },
+            { 0, 2, 3, 1 },
+            { 0, 3, 1, 2 },
+            { 0, 3, 2, 1 },
+            { 3, 0, 1, 2 },
+            { 3, 0, 2, 1 }
+        }
+    );
+}
+
+TEST_CASE("Chain") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B", "C" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({ { "C", "B" }, { "B", "A" } }));
+
+    CHECK(ToVector(generator.Generate(requests, 100)) == std::vector<NS::RequestIndexes>{ { 2, 1, 0 } });
+    CHECK(generator.IsComplete());
+}
+
+TEST_CASE("No Constraints") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B", "C" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({}));
+
+    CHECK(generator.Generate(requests, 100).size() == 6);
+    CHECK(generator.IsComplete());
+}
+
+TEST_CASE("Unknown and Duplicate Names") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "B", "A", "B" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({ { "A", "B" }, { "Unknown", "A" } }));
+
+    // Both Requests named "B" are applied after "A"
+    CHECK(ToVector(generator.Generate(requests, 100)) == std::vector<NS::RequestIndexes>{ { 1, 0, 2 }, { 1, 2, 0 } });
+}
+
+TEST_CASE("Cycle") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B", "C" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({ { "A", "B" }, { "B", "C" }, { "C", "A" } }));
+
+    CHECK_THROWS_MATCHES(
+        generator.Generate(requests, 100),
+        std::runtime_error,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid precedence constraints")
+    );
+}
+
+TEST_CASE("Max Num Permutations") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B", "C", "D" }));
+    NS::PrecedencePermutationGenerator                                      generator(CreateConstraints({ { "A", "B" } }), 5);
+
+    CHECK(generator.Generate(requests, 100).size() == 5);
+    CHECK(generator.IsComplete());
+}
+
+TEST_CASE("Invalid Args") {
+    CHECK_THROWS_MATCHES(
+        NS::PrecedencePermutationGenerator(NS::PrecedencePermutationGenerator::ConstraintsPtr()),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("pConstraints")
+    );
+
+    CHECK_THROWS_MATCHES(
+        NS::PrecedencePermutationGenerator(CreateConstraints({ { "", "B" } })),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("pConstraints")
+    );
+
+    CHECK_THROWS_MATCHES(
+        NS::PrecedencePermutationGenerator(CreateConstraints({ { "A", "A" } })),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("pConstraints")
+    );
+
+    CHECK_THROWS_MATCHES(
+        NS::PrecedencePermutationGeneratorFactory(NS::PrecedencePermutationGenerator::ConstraintsPtr()),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("pConstraints")
+    );
+}
+
+TEST_CASE("Factory") {
+    NS::PrecedencePermutationGeneratorFactory const                         factory(CreateConstraints({ { "B", "A" } }), 10);
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests({ "A", "B" }));
+
+    CHECK(ToVector(factory.Create()->Generate(requests, 10)) == std::vector<NS::RequestIndexes>{ { 1, 0 } });
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::PrecedencePermutationGenerator(CreateConstraints({ { "A", "B" } }), 10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::PrecedencePermutationGeneratorFactory(CreateConstraints({ { "A", "B" } }), 10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
@@ -0,0 +1,279 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ProblemSnapshot_UnitTest.cpp
+///  \brief         Unit test for ProblemSnapshot.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:08:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../ProblemSnapshot.h"
+#include <catch.hpp>
+
+#include <fstream>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyCondition : public NS::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyCondition);
+
+    template <typename PrivateConstructorTagT>
+    MyCondition(PrivateConstructorTagT tag, std::string name) :
+        NS::Condition(tag, std::move(name), 100)
+    {}
+
+    ~MyCondition(void) override = default;
+
+#define ARGS                                BASES(NS::Condition)
+
+    NON_COPYABLE(MyCondition);
+    MOVE(MyCondition, ARGS);
+    COMPARE(MyCondition, ARGS);
+    SERIALIZATION(MyCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(DecisionEngine::Core::Components::Condition)));
+    SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(MyCondition, NS::Condition);
+
+#undef ARGS
+
+    Result Apply(Request const &, Resource const &) const override {
+        return Result(SharedFromThis(), true);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyCondition);
+
+class MyResource : public NS::Resource {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyResource);
+
+    using NS::Resource::Resource;
+
+#define ARGS                                BASES(NS::Resource)
+
+    NON_COPYABLE(MyResource);
+    MOVE(MyResource, ARGS);
+    COMPARE(MyResource, ARGS);
+    SERIALIZATION(MyResource, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(NS::Resource)));
+
+#undef ARGS
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    EvaluateResult EvaluateImpl(Request const &, size_t, bool) const override {
+        return EvaluateResult(Evaluations(), ContinuationStatePtr());
+    }
+
+    EvaluateResult EvaluateImpl(Request const &, size_t, State &, bool) const override {
+        return EvaluateResult(Evaluations(), ContinuationStatePtr());
+    }
+
+    ResourcePtr ApplyImpl(State const &) const override {
+        return MyResource::Create(*this);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource);
+
+NS::ConditionPtrs CreateConditions(void) {
+    return NS::ConditionPtrs{ MyCondition::Create("Condition1"), MyCondition::Create("Condition2"), MyCondition::Create("Condition3") };
+}
+
+std::vector<NS::ProblemSnapshot::ConditionIndex> ToVector(NS::ProblemSnapshot::ConditionIndexes const &indexes) {
+    return std::vector<NS::ProblemSnapshot::ConditionIndex>(indexes.begin(), indexes.end());
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ProblemSnapshot
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("Write and Read") {
+    std::filesystem::path const             filename(std::filesystem::temp_directory_path() / "ProblemSnapshot_UnitTest.snapshot");
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    NS::ConditionPtrs const                 conditions(CreateConditions());
+    NS::ConditionPtrsPtr const              pConditions13(std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ conditions[0], conditions[2] }));
+
+    NS::RequestPtrsContainer const          requestsContainer{
+        NS::RequestPtrs{
+            std::make_shared<NS::Request>("Request1", pConditions13),
+            std::make_shared<NS::Request>("Request2", NS::ConditionPtrsPtr(), std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ conditions[0], conditions[2] }), std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ conditions[1] }))
+        },
+        NS::RequestPtrs{
+            std::make_shared<NS::Request>("Request3")
+        }
+    };
+
+    NS::ProblemSnapshot::Write(filename, conditions, requestsContainer, MyResource::Create("Resource", pConditions13));
+    CHECK(std::filesystem::exists(filename));
+
+    // Conditions are provided by the reader; they don't need to be the same
+    // objects, but must have the same names and max scores.
+    NS::ProblemSnapshot const               snapshot(filename, CreateConditions());
+
+    CHECK(snapshot.GetConditions().size() == 3);
+    CHECK(snapshot.GetInitialResource()->Name == "Resource");
+    REQUIRE(snapshot.GetInitialResource()->OptionalApplicabilityConditions);
+    CHECK(snapshot.GetInitialResource()->OptionalApplicabilityConditions->size() == 2);
+
+    CHECK(snapshot.GetNumGroups() == 2);
+    CHECK(snapshot.GetNumRequests() == 3);
+    CHECK(snapshot.GetNumRequests(0) == 2);
+    CHECK(snapshot.GetNumRequests(1) == 1);
+
+    // Views
+    NS::ProblemSnapshot::RequestView const  view1(snapshot.GetRequest(0, 0));
+
+    CHECK(view1.Name == "Request1");
+    CHECK(ToVector(view1.ApplicabilityConditions) == std::vector<NS::ProblemSnapshot::ConditionIndex>{ 0, 2 });
+    CHECK(view1.RequirementConditions.empty());
+    CHECK(view1.PreferenceConditions.empty());
+
+    NS::ProblemSnapshot::RequestView const  view2(snapshot.GetRequest(0, 1));
+
+    CHECK(view2.Name == "Request2");
+    CHECK(view2.ApplicabilityConditions.empty());
+    CHECK(ToVector(view2.RequirementConditions) == std::vector<NS::ProblemSnapshot::ConditionIndex>{ 0, 2 });
+    CHECK(ToVector(view2.PreferenceConditions) == std::vector<NS::ProblemSnapshot::ConditionIndex>{ 1 });
+
+    // Condition lists with the same content are stored once
+    CHECK(view1.ApplicabilityConditions.begin() == view2.RequirementConditions.begin());
+
+    NS::ProblemSnapshot::RequestView const  view3(snapshot.GetRequest(1, 0));
+
+    CHECK(view3.Name == "Request3");
+    CHECK(view3.ApplicabilityConditions.empty());
+    CHECK(view3.RequirementConditions.empty());
+    CHECK(view3.PreferenceConditions.empty());
+
+    CHECK_THROWS_MATCHES(snapshot.GetRequest(2, 0), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("group"));
+    CHECK_THROWS_MATCHES(snapshot.GetRequest(1, 1), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("index"));
+
+    // Requests
+    NS::RequestPtrsContainerPtr const       pRequests(snapshot.CreateRequests());
+
+    REQUIRE(pRequests->size() == 2);
+    REQUIRE((*pRequests)[0].size() == 2);
+    REQUIRE((*pRequests)[1].size() == 1);
+
+    NS::Request const &                     request1(*(*pRequests)[0][0]);
+    NS::Request const &                     request2(*(*pRequests)[0][1]);
+
+    CHECK(request1.Name == "Request1");
+    REQUIRE(request1.OptionalApplicabilityConditions);
+    CHECK(request1.OptionalApplicabilityConditions->size() == 2);
+    CHECK((*request1.OptionalApplicabilityConditions)[0] == snapshot.GetConditions()[0]);
+    CHECK((*request1.OptionalApplicabilityConditions)[1] == snapshot.GetConditions()[2]);
+    CHECK(!request1.OptionalRequirementConditions);
+    CHECK(!request1.OptionalPreferenceConditions);
+
+    CHECK(request2.Name == "Request2");
+    CHECK(!request2.OptionalApplicabilityConditions);
+    CHECK(request2.OptionalRequirementConditions == request1.OptionalApplicabilityConditions);
+    REQUIRE(request2.OptionalPreferenceConditions);
+    CHECK((*request2.OptionalPreferenceConditions)[0] == snapshot.GetConditions()[1]);
+
+    CHECK((*pRequests)[1][0]->Name == "Request3");
+
+    // Working system
+    NS::ProblemSnapshot::WorkingSystemPtr const         pWorkingSystem(snapshot.CreateWorkingSystem());
+
+    CHECK(pWorkingSystem);
+    CHECK(pWorkingSystem->IsComplete() == false);
+}
+
+TEST_CASE("Write Errors") {
+    std::filesystem::path const             filename(std::filesystem::temp_directory_path() / "ProblemSnapshot_UnitTest.snapshot");
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    NS::ConditionPtrs const                 conditions(CreateConditions());
+    NS::ResourcePtr const                   pResource(MyResource::Create("Resource"));
+
+    // Invalid resource
+    CHECK_THROWS_MATCHES(NS::ProblemSnapshot::Write(filename, conditions, NS::RequestPtrsContainer(), NS::ResourcePtr()), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("pInitialResource"));
+
+    // Duplicate condition
+    CHECK_THROWS_MATCHES(NS::ProblemSnapshot::Write(filename, NS::ConditionPtrs{ conditions[0], conditions[0] }, NS::RequestPtrsContainer(), pResource), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("conditions"));
+
+    // Condition not in the catalog
+    CHECK_THROWS_MATCHES(
+        NS::ProblemSnapshot::Write(
+            filename,
+            conditions,
+            NS::RequestPtrsContainer{ NS::RequestPtrs{ std::make_shared<NS::Request>("Request", std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ MyCondition::Create("Other") })) } },
+            pResource
+        ),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("conditions")
+    );
+
+    // Null request
+    CHECK_THROWS_MATCHES(NS::ProblemSnapshot::Write(filename, conditions, NS::RequestPtrsContainer{ NS::RequestPtrs{ NS::RequestPtr() } }, pResource), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("requestsContainer"));
+
+    CHECK(std::filesystem::exists(filename) == false);
+}
+
+TEST_CASE("Read Errors") {
+    std::filesystem::path const             filename(std::filesystem::temp_directory_path() / "ProblemSnapshot_UnitTest.snapshot");
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    NS::ProblemSnapshot::Write(
+        filename,
+        CreateConditions(),
+        NS::RequestPtrsContainer{ NS::RequestPtrs{ std::make_shared<NS::Request>("Request") } },
+        MyResource::Create("Resource")
+    );
+
+    SECTION("Different conditions") {
+        CHECK_THROWS_MATCHES(NS::ProblemSnapshot(filename, NS::ConditionPtrs()), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid snapshot file (the conditions do not match)"));
+
+        NS::ConditionPtrs                   conditions(CreateConditions());
+
+        conditions[1] = MyCondition::Create("Different");
+
+        CHECK_THROWS_MATCHES(NS::ProblemSnapshot(filename, std::move(conditions)), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid snapshot file (the conditions do not match)"));
+    }
+
+    SECTION("Truncated") {
+        std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+
+        CHECK_THROWS_MATCHES(NS::ProblemSnapshot(filename, CreateConditions()), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid snapshot file"));
+    }
+
+    SECTION("Invalid header") {
+        {
+            std::fstream                    stream(filename, std::ios::binary | std::ios::in | std::ios::out);
+
+            stream.write("XXXX", 4);
+        }
+
+        CHECK_THROWS_MATCHES(NS::ProblemSnapshot(filename, CreateConditions()), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid snapshot file"));
+    }
+}
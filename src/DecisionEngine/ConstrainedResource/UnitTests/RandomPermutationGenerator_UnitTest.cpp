@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RandomPermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for RandomPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../RandomPermutationGenerator.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+#include <set>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+class Request {};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+NS::PermutationGenerator::RequestPtrs CreateRequests(size_t numRequests) {
+    NS::PermutationGenerator::RequestPtrs   results;
+
+    while(numRequests--)
+        results.emplace_back(std::make_shared<NS::Request>());
+
+    return results;
+}
+
+std::set<NS::RequestIndexes> ToSet(NS::PermutationGenerator::RequestIndexesPtrs const &permutations) {
+    std::set<NS::RequestIndexes>            results;
+
+    for(auto const &pPermutation : permutations)
+        results.emplace(*pPermutation);
+
+    return results;
+}
+
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Without Replacement") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(4));
+    NS::RandomPermutationGenerator                                          generator(10000, 123);
+    NS::PermutationGenerator::RequestIndexesPtrs                            results(generator.Generate(requests, 10));
+
+    CHECK(results.size() == 10);
+    CHECK(generator.IsComplete() == false);
+
+    for(auto &pPermutation : generator.Generate(requests, 10000))
+        results.emplace_back(std::move(pPermutation));
+
+    // All 24 permutations are generated exactly once
+    CHECK(results.size() == 24);
+    CHECK(ToSet(results).size() == 24);
+    CHECK(generator.IsComplete());
+}
+
+TEST_CASE("Seed") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(8));
+
+    auto const                              generateFunc(
+        [&requests](std::uint64_t seed) {
+            std::vector<NS::RequestIndexes>     results;
+
+            for(auto const &pPermutation : NS::RandomPermutationGenerator(10000, seed).Generate(requests, 5))
+                results.emplace_back(*pPermutation);
+
+            return results;
+        }
+    );
+
+    CHECK(generateFunc(1) == generateFunc(1));
+    CHECK(generateFunc(1) != generateFunc(2));
+
+    // Permutations aren't generated in lexicographic order
+    CHECK(generateFunc(1)[0] != NS::RequestIndexes{ 0, 1, 2, 3, 4, 5, 6, 7 });
+}
+
+TEST_CASE("Large Groups") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(30));
+    NS::PermutationGenerator::RequestIndexesPtrs const                      results(NS::RandomPermutationGenerator(10000, 5).Generate(requests, 100));
+
+    CHECK(results.size() == 100);
+    CHECK(ToSet(results).size() == 100);
+
+    // Each result is a permutation
+    NS::RequestIndexes                      expected;
+
+    for(NS::RequestIndex index = 0; index < requests.size(); ++index)
+        expected.emplace_back(index);
+
+    for(auto const &pPermutation : results) {
+        NS::RequestIndexes                  sorted(*pPermutation);
+
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(sorted == expected);
+    }
+}
+
+TEST_CASE("Factory") {
+    NS::RandomPermutationGeneratorFactory const                             factory(10, 7);
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(5));
+
+    CHECK(*factory.Create()->Generate(requests, 1)[0] == *NS::RandomPermutationGenerator(10, 7).Generate(requests, 1)[0]);
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::RandomPermutationGenerator(10, 3),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::RandomPermutationGeneratorFactory(10, 3),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
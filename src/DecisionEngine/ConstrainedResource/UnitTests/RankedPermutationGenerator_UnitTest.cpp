@@ -0,0 +1,177 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          RankedPermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for RankedPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:21:02
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../RankedPermutationGenerator.h"
+#include "../StandardPermutationGenerator.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+class Request {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    unsigned long const                     Id;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    Request(unsigned long id) : Id(id) {}
+};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+std::vector<std::vector<unsigned long>> ToIds(NS::PermutationGenerator::RequestPtrs const &requests, NS::PermutationGenerator::RequestIndexesPtrs const &permutations) {
+    std::vector<std::vector<unsigned long>> results;
+
+    for(auto const &pPermutation : permutations) {
+        std::vector<unsigned long>          ids;
+
+        for(auto index : *pPermutation)
+            ids.emplace_back(requests[index]->Id);
+
+        results.emplace_back(std::move(ids));
+    }
+
+    return results;
+}
+
+NS::PermutationGenerator::RequestPtrs CreateRequests(unsigned long numRequests) {
+    NS::PermutationGenerator::RequestPtrs   results;
+
+    for(unsigned long id = 1; id <= numRequests; ++id)
+        results.emplace_back(std::make_shared<NS::Request>(id));
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("GetNumPermutations") {
+    CHECK(NS::RankedPermutationGenerator::GetNumPermutations(0) == 1);
+    CHECK(NS::RankedPermutationGenerator::GetNumPermutations(1) == 1);
+    CHECK(NS::RankedPermutationGenerator::GetNumPermutations(4) == 24);
+    CHECK(NS::RankedPermutationGenerator::GetNumPermutations(10) == 3628800);
+    CHECK(NS::RankedPermutationGenerator::GetNumPermutations(1000) == std::numeric_limits<size_t>::max());
+}
+
+TEST_CASE("Unrank") {
+    CHECK(NS::RankedPermutationGenerator::Unrank(3, 0) == NS::RequestIndexes{ 0, 1, 2 });
+    CHECK(NS::RankedPermutationGenerator::Unrank(3, 3) == NS::RequestIndexes{ 1, 2, 0 });
+    CHECK(NS::RankedPermutationGenerator::Unrank(3, 5) == NS::RequestIndexes{ 2, 1, 0 });
+
+    // Ranks in large groups only permute the trailing items
+    NS::RequestIndexes const                                                indexes(NS::RankedPermutationGenerator::Unrank(100, 1));
+
+    CHECK(indexes[97] == 97);
+    CHECK(indexes[98] == 99);
+    CHECK(indexes[99] == 98);
+
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator::Unrank(0, 0), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("numItems"));
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator::Unrank(3, 6), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("rank"));
+}
+
+TEST_CASE("Standard Order") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(5));
+
+    CHECK(
+        ToIds(requests, NS::RankedPermutationGenerator().Generate(requests, 10000))
+        == ToIds(requests, NS::StandardPermutationGenerator().Generate(requests, 10000))
+    );
+}
+
+TEST_CASE("Range") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(3));
+    NS::RankedPermutationGenerator                                          generator(10000, 2, 5);
+
+    CHECK(ToIds(requests, generator.Generate(requests, 2)) == std::vector<std::vector<unsigned long>>{ { 2, 1, 3 }, { 2, 3, 1 } });
+    CHECK(generator.IsComplete() == false);
+    CHECK(ToIds(requests, generator.Generate(requests, 2)) == std::vector<std::vector<unsigned long>>{ { 3, 1, 2 } });
+    CHECK(generator.IsComplete());
+
+    // The end rank is clamped
+    CHECK(ToIds(requests, NS::RankedPermutationGenerator(10000, 5).Generate(requests, 10000)) == std::vector<std::vector<unsigned long>>{ { 3, 2, 1 } });
+
+    // The first rank is out of range
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator(10000, 6).Generate(requests, 10000), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid rank"));
+
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator(10000, 2, 2), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("firstRank"));
+}
+
+TEST_CASE("Partition") {
+    CHECK(NS::RankedPermutationGenerator::Partition(3, 1) == NS::RankedPermutationGenerator::RankRanges{ { 0, 6 } });
+    CHECK(NS::RankedPermutationGenerator::Partition(3, 4) == NS::RankedPermutationGenerator::RankRanges{ { 0, 2 }, { 2, 4 }, { 4, 5 }, { 5, 6 } });
+    CHECK(NS::RankedPermutationGenerator::Partition(2, 4) == NS::RankedPermutationGenerator::RankRanges{ { 0, 1 }, { 1, 2 } });
+
+    // Generating each partition independently produces all permutations
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(4));
+    std::vector<std::vector<unsigned long>>                                 results;
+
+    for(auto const &range : NS::RankedPermutationGenerator::Partition(requests.size(), 5)) {
+        for(auto &ids : ToIds(requests, NS::RankedPermutationGenerator(10000, std::get<0>(range), std::get<1>(range)).Generate(requests, 10000)))
+            results.emplace_back(std::move(ids));
+    }
+
+    CHECK(results == ToIds(requests, NS::StandardPermutationGenerator().Generate(requests, 10000)));
+
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator::Partition(0, 1), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("numItems"));
+    CHECK_THROWS_MATCHES(NS::RankedPermutationGenerator::Partition(1, 0), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("numPartitions"));
+}
+
+TEST_CASE("Factory") {
+    CHECK(NS::RankedPermutationGeneratorFactory(10).Create());
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::RankedPermutationGenerator(10, 3, 7),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::RankedPermutationGeneratorFactory(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
@@ -185,6 +185,32 @@ TEST_CASE("Construct - Errors") {
     );
 }
 
+TEST_CASE("Equivalence") {
+    class KeyedRequest : public NS::Request {
+    public:
+        std::string const                   Key;
+
+        KeyedRequest(std::string name, std::string key) : NS::Request(std::move(name)), Key(std::move(key)) {}
+        ~KeyedRequest(void) override = default;
+
+        std::optional<std::string> GetEquivalenceKey(void) const override { return Key; }
+    };
+
+    NS::ConditionPtrsPtr const              pConditions(std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ sg_pCondition }));
+
+    CHECK(NS::Request("a").IsEquivalent(NS::Request("b")));
+    CHECK(NS::Request("a", pConditions).IsEquivalent(NS::Request("b", pConditions)));
+    CHECK(NS::Request("a", pConditions).IsEquivalent(NS::Request("b", std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ sg_pCondition }))));
+    CHECK(NS::Request("a", pConditions).IsEquivalent(NS::Request("b")) == false);
+    CHECK(NS::Request("a", pConditions).IsEquivalent(NS::Request("b", NS::ConditionPtrsPtr(), pConditions)) == false);
+    CHECK(NS::Request("a", pConditions).IsEquivalent(NS::Request("b", pConditions, pConditions)) == false);
+
+    CHECK(KeyedRequest("a", "1").IsEquivalent(KeyedRequest("b", "1")));
+    CHECK(KeyedRequest("a", "1").IsEquivalent(KeyedRequest("b", "2")) == false);
+    CHECK(KeyedRequest("a", "1").IsEquivalent(NS::Request("b")) == false);
+    CHECK(NS::Request("a").IsEquivalent(KeyedRequest("b", "1")) == false);
+}
+
 TEST_CASE("Compare") {
     CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Request("a"), NS::Request("a"), true) == 0);
     CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Request("a"), NS::Request("z")) == 0);
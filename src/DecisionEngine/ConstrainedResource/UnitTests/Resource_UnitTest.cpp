@@ -168,7 +168,7 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    EvaluateResult EvaluateImpl(Request const &, size_t maxNumEvaluations) const override {
+    EvaluateResult EvaluateImpl(Request const &, size_t maxNumEvaluations, bool) const override {
         if(_operation == OperationType::Valid || _operation == OperationType::ApplyInvalid)
             return EvaluateResult(
                 CreateEvaluations(*this, { true, false }),
@@ -196,8 +196,8 @@ private:
         return EvaluateResult(Evaluations(), ContinuationStatePtr());
     }
 
-    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &) const override {
-        return EvaluateImpl(request, maxNumEvaluations);
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &, bool isFailFast) const override {
+        return EvaluateImpl(request, maxNumEvaluations, isFailFast);
     }
 
     ResourcePtr ApplyImpl(State const &) const override {
@@ -541,6 +541,22 @@ TEST_CASE("Resource - Serialization") {
     );
 }
 
+TEST_CASE("Resource - Approximate Size") {
+    std::shared_ptr<MyResource> const       pSimple(MyResource::Create(MyResource::OperationType::Valid, "MyResource"));
+    NS::ConditionPtrsPtr const              pConditions(std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ sg_pCondition }));
+    std::shared_ptr<MyResource> const       pWithConditions(MyResource::Create(MyResource::OperationType::Valid, "MyResource", pConditions));
+
+    CHECK(pSimple->GetApproximateSize() >= sizeof(NS::Resource));
+    CHECK(pWithConditions->GetApproximateSize() > pSimple->GetApproximateSize());
+
+    // Conditions shared with other Resources are divided among them
+    size_t const                            withConditionsSize(pWithConditions->GetApproximateSize());
+    std::shared_ptr<MyResource> const       pSharedConditions(MyResource::Create(MyResource::OperationType::Valid, "MyResource", pConditions));
+
+    CHECK(pWithConditions->GetApproximateSize() < withConditionsSize);
+    CHECK(pSharedConditions->GetApproximateSize() == pWithConditions->GetApproximateSize());
+}
+
 TEST_CASE("Resource - CalculateResult - Request Requirement") {
     Components::Score::Result const         result(
         MyResource::CalculateResult(
@@ -801,6 +817,54 @@ TEST_CASE("Resource - CalculateRequest - Applicability") {
     }
 }
 
+TEST_CASE("Resource - CalculateResult - Fail Fast") {
+    NS::Request const                       request(
+        "Request",
+        NS::ConditionPtrsPtr(),
+        std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ MyCondition::Create(true), MyCondition::Create(false), MyCondition::Create(true) }),
+        std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ MyCondition::Create(true) })
+    );
+    std::shared_ptr<MyResource> const       pResource(MyResource::Create(MyResource::OperationType::Valid, "Resource"));
+
+    SECTION("Fail Fast") {
+        Components::Score::Result const     result(MyResource::CalculateResult(request, *pResource, true));
+
+        CHECK(result.IsSuccessful == false);
+        CHECK(result.IsPartial);
+
+        REQUIRE(result.RequirementResults.size() == 2);
+        CHECK(result.RequirementResults[0].IsSuccessful);
+        CHECK(result.RequirementResults[1].IsSuccessful == false);
+
+        CHECK(result.PreferenceResults.empty());
+    }
+
+    SECTION("Standard") {
+        Components::Score::Result const     result(MyResource::CalculateResult(request, *pResource));
+
+        CHECK(result.IsSuccessful == false);
+        CHECK(result.IsPartial == false);
+        CHECK(result.RequirementResults.size() == 3);
+        CHECK(result.PreferenceResults.size() == 1);
+    }
+
+    SECTION("Successful") {
+        NS::Request const                   successfulRequest(
+            "Request",
+            NS::ConditionPtrsPtr(),
+            std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ MyCondition::Create(true) }),
+            std::make_shared<NS::ConditionPtrs>(NS::ConditionPtrs{ MyCondition::Create(false) })
+        );
+
+        Components::Score::Result const     result(MyResource::CalculateResult(successfulRequest, *pResource, true));
+
+        // Results that are successful are always complete
+        CHECK(result == MyResource::CalculateResult(successfulRequest, *pResource));
+        CHECK(result.IsPartial == false);
+        CHECK(result.PreferenceResults.size() == 1);
+    }
+}
+
 TEST_CASE("Resource::State - Compare") {
     std::shared_ptr<MyResource>             resource1(MyResource::Create(MyResource::OperationType::Valid, "Resource1"));
     std::shared_ptr<MyResource>             resource2(MyResource::Create(MyResource::OperationType::Valid, "Resource2"));
@@ -55,11 +55,11 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    EvaluateResult EvaluateImpl(Request const &, size_t) const override {
+    EvaluateResult EvaluateImpl(Request const &, size_t, bool) const override {
         return EvaluateResult(Evaluations(), ContinuationStatePtr());
     }
 
-    EvaluateResult EvaluateImpl(Request const &, size_t, State &) const override {
+    EvaluateResult EvaluateImpl(Request const &, size_t, State &, bool) const override {
         return EvaluateResult(Evaluations(), ContinuationStatePtr());
     }
 
@@ -86,6 +86,35 @@ TEST_CASE("Valid") {
     CHECK(system.ToString() == "ConstrainedResource::ResultSystem(Score(Pending(1,100001.00,0,0)),Index())");
 }
 
+TEST_CASE("Approximate Size") {
+    auto const                              createSystem(
+        [](NS::RequestPtrs requests) -> NS::ResultSystem {
+            return NS::ResultSystem(
+                MyResource::Create("Resource"),
+                std::make_shared<NS::RequestPtrsContainer>(NS::RequestPtrsContainer{ std::move(requests) }),
+                Components::Score(),
+                Components::Index()
+            );
+        }
+    );
+
+    NS::ResultSystem const                  system(createSystem(NS::RequestPtrs{ std::make_shared<NS::Request>("Request1") }));
+
+    // The Resource and Requests are included
+    CHECK(system.GetApproximateSize() > system.Components::System::GetApproximateSize());
+
+    // More Requests
+    CHECK(
+        createSystem(
+            NS::RequestPtrs{
+                std::make_shared<NS::Request>("Request1"),
+                std::make_shared<NS::Request>("Request2"),
+                std::make_shared<NS::Request>("Request3")
+            }
+        ).GetApproximateSize() > system.GetApproximateSize()
+    );
+}
+
 TEST_CASE("Construct Errors") {
     // Invalid resource
     CHECK_THROWS_MATCHES(
@@ -53,43 +53,52 @@ public:
 
 TEST_CASE("Standard") {
     NS::StandardPermutationGenerator::RequestPtrs const                     requests{ std::make_shared<NS::Request>(1), std::make_shared<NS::Request>(2), std::make_shared<NS::Request>(3) };
-    NS::StandardPermutationGenerator::RequestPtrsPtrs const                 results(NS::StandardPermutationGenerator().Generate(requests, 10000));
+    NS::StandardPermutationGenerator::RequestIndexesPtrs const              results(NS::StandardPermutationGenerator().Generate(requests, 10000));
 
     REQUIRE(results.size() == 6);
 
     REQUIRE(results[0]->size() == 3);
-    CHECK((*results[0])[0]->Id == 1);
-    CHECK((*results[0])[1]->Id == 2);
-    CHECK((*results[0])[2]->Id == 3);
+    CHECK(requests[(*results[0])[0]]->Id == 1);
+    CHECK(requests[(*results[0])[1]]->Id == 2);
+    CHECK(requests[(*results[0])[2]]->Id == 3);
 
     REQUIRE(results[1]->size() == 3);
-    CHECK((*results[1])[0]->Id == 1);
-    CHECK((*results[1])[1]->Id == 3);
-    CHECK((*results[1])[2]->Id == 2);
+    CHECK(requests[(*results[1])[0]]->Id == 1);
+    CHECK(requests[(*results[1])[1]]->Id == 3);
+    CHECK(requests[(*results[1])[2]]->Id == 2);
 
     REQUIRE(results[2]->size() == 3);
-    CHECK((*results[2])[0]->Id == 2);
-    CHECK((*results[2])[1]->Id == 1);
-    CHECK((*results[2])[2]->Id == 3);
+    CHECK(requests[(*results[2])[0]]->Id == 2);
+    CHECK(requests[(*results[2])[1]]->Id == 1);
+    CHECK(requests[(*results[2])[2]]->Id == 3);
 
     REQUIRE(results[3]->size() == 3);
-    CHECK((*results[3])[0]->Id == 2);
-    CHECK((*results[3])[1]->Id == 3);
-    CHECK((*results[3])[2]->Id == 1);
+    CHECK(requests[(*results[3])[0]]->Id == 2);
+    CHECK(requests[(*results[3])[1]]->Id == 3);
+    CHECK(requests[(*results[3])[2]]->Id == 1);
 
     REQUIRE(results[4]->size() == 3);
-    CHECK((*results[4])[0]->Id == 3);
-    CHECK((*results[4])[1]->Id == 1);
-    CHECK((*results[4])[2]->Id == 2);
+    CHECK(requests[(*results[4])[0]]->Id == 3);
+    CHECK(requests[(*results[4])[1]]->Id == 1);
+    CHECK(requests[(*results[4])[2]]->Id == 2);
 
     REQUIRE(results[5]->size() == 3);
-    CHECK((*results[5])[0]->Id == 3);
-    CHECK((*results[5])[1]->Id == 2);
-    CHECK((*results[5])[2]->Id == 1);
+    CHECK(requests[(*results[5])[0]]->Id == 3);
+    CHECK(requests[(*results[5])[1]]->Id == 2);
+    CHECK(requests[(*results[5])[2]]->Id == 1);
 }
 
 TEST_CASE("Factory") {
     CHECK(NS::StandardPermutationGeneratorFactory(10).Create());
+    CHECK(NS::StandardPermutationGeneratorFactory(10).IsIncremental() == false);
+}
+
+TEST_CASE("Incremental Factory") {
+    CHECK(NS::IncrementalPermutationGeneratorFactory().Create());
+    CHECK(NS::IncrementalPermutationGeneratorFactory().IsIncremental());
+
+    // The factories are distinct types, so they can't compare as equal
+    CHECK(std::is_base_of_v<NS::StandardPermutationGeneratorFactory, NS::IncrementalPermutationGeneratorFactory> == false);
 }
 
 TEST_CASE("Serialization") {
@@ -112,4 +121,14 @@ TEST_CASE("Serialization") {
             }
         ) == 0
     );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::IncrementalPermutationGeneratorFactory(),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
 }
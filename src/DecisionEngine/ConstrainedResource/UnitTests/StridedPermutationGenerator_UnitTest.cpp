@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          StridedPermutationGenerator_UnitTest.cpp
+///  \brief         Unit test for StridedPermutationGenerator.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:28:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../StridedPermutationGenerator.h"
+#include <catch.hpp>
+
+#include <BoostHelpers/TestHelpers.h>
+#include <CommonHelpers/TestHelpers.h>
+
+#include <set>
+
+namespace NS                                = DecisionEngine::ConstrainedResource;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+namespace DecisionEngine {
+namespace ConstrainedResource {
+
+class Request {};
+
+} // namespace ConstrainedResource
+} // namespace DecisionEngine
+
+NS::PermutationGenerator::RequestPtrs CreateRequests(size_t numRequests) {
+    NS::PermutationGenerator::RequestPtrs   results;
+
+    while(numRequests--)
+        results.emplace_back(std::make_shared<NS::Request>());
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("GetStride") {
+    CHECK(NS::StridedPermutationGenerator::GetStride(1) == 1);
+    CHECK(NS::StridedPermutationGenerator::GetStride(2) == 1);
+    CHECK(NS::StridedPermutationGenerator::GetStride(6) == 5);
+    CHECK(NS::StridedPermutationGenerator::GetStride(24) == 17);
+    CHECK(NS::StridedPermutationGenerator::GetStride(std::numeric_limits<size_t>::max()) < std::numeric_limits<size_t>::max());
+
+    CHECK_THROWS_MATCHES(NS::StridedPermutationGenerator::GetStride(0), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("numPermutations"));
+}
+
+TEST_CASE("All Permutations") {
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(4));
+    NS::StridedPermutationGenerator                                         generator;
+    NS::PermutationGenerator::RequestIndexesPtrs const                      results(generator.Generate(requests, 10000));
+
+    CHECK(generator.IsComplete());
+    REQUIRE(results.size() == 24);
+
+    std::set<NS::RequestIndexes>            unique;
+
+    for(auto const &pPermutation : results)
+        unique.emplace(*pPermutation);
+
+    CHECK(unique.size() == 24);
+
+    // Ranks 0, 17, 10 (mod 24)
+    CHECK(*results[0] == NS::RequestIndexes{ 0, 1, 2, 3 });
+    CHECK(*results[1] == NS::RequestIndexes{ 2, 3, 1, 0 });
+    CHECK(*results[2] == NS::RequestIndexes{ 1, 3, 0, 2 });
+}
+
+TEST_CASE("Diverse Prefixes") {
+    // The first Request varies across a small number of permutations
+    NS::PermutationGenerator::RequestPtrs const                             requests(CreateRequests(8));
+    NS::PermutationGenerator::RequestIndexesPtrs const                      results(NS::StridedPermutationGenerator().Generate(requests, 8));
+    std::set<NS::RequestIndex>              firstRequests;
+
+    for(auto const &pPermutation : results)
+        firstRequests.emplace((*pPermutation)[0]);
+
+    CHECK(firstRequests.size() > 4);
+}
+
+TEST_CASE("Factory") {
+    CHECK(NS::StridedPermutationGeneratorFactory(10).Create());
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::StridedPermutationGenerator(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::StridedPermutationGeneratorFactory(10),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
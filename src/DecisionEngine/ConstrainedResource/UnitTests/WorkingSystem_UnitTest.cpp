@@ -24,12 +24,448 @@
 #include "../WorkingSystem.h"
 #include <catch.hpp>
 
+#include "../ResultSystem.h"
+#include "../StandardPermutationGenerator.h"
+
+#include <DecisionEngine/Core/Components/CalculatedResultSystem.h>
+#include <DecisionEngine/Core/Components/CalculatedWorkingSystem.h>
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <sstream>
+
 #include <BoostHelpers/TestHelpers.h>
 #include <CommonHelpers/TestHelpers.h>
 
 namespace NS                                = DecisionEngine::ConstrainedResource;
+namespace Components                        = DecisionEngine::Core::Components;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MyResource
+///  \brief         Resource that records the Requests applied to it; each
+///                 Request produces `NumEvaluations` Evaluations, and each
+///                 applied Evaluation is recorded as the Request name followed
+///                 by the Evaluation index (for example, "A0B1").
+///
+class MyResource : public NS::Resource {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    class ApplyState : public NS::Resource::State {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        std::string const                   Applied;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ApplyState(Resource const &resource, std::string applied) :
+            NS::Resource::State(resource),
+            Applied(std::move(applied))
+        {}
+
+        ~ApplyState(void) override = default;
+
+#define ARGS                                MEMBERS(Applied), BASES(NS::Resource::State)
+
+        NON_COPYABLE(ApplyState);
+        MOVE(ApplyState, ARGS);
+        COMPARE(ApplyState, ARGS);
+        SERIALIZATION(ApplyState, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(NS::Resource::State)));
+
+#undef ARGS
+    };
+
+    class ContinuationState : public NS::Resource::State {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+        size_t const                        NextEvaluation;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ContinuationState(Resource const &resource, size_t nextEvaluation) :
+            NS::Resource::State(resource),
+            NextEvaluation(std::move(nextEvaluation))
+        {}
+
+        ~ContinuationState(void) override = default;
+
+#define ARGS                                MEMBERS(NextEvaluation), BASES(NS::Resource::State)
+
+        NON_COPYABLE(ContinuationState);
+        MOVE(ContinuationState, ARGS);
+        COMPARE(ContinuationState, ARGS);
+        SERIALIZATION(ContinuationState, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(NS::Resource::State)));
+
+#undef ARGS
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            NumEvaluations;
+    std::string const                       Applied;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyResource);
+
+    template <typename PrivateConstructorTagT>
+    MyResource(PrivateConstructorTagT tag, size_t numEvaluations, std::string applied=std::string()) :
+        NS::Resource(tag, "MyResource"),
+        NumEvaluations(std::move(numEvaluations)),
+        Applied(std::move(applied))
+    {}
+
+    ~MyResource(void) override = default;
+
+#define ARGS                                MEMBERS(NumEvaluations, Applied), BASES(NS::Resource)
+
+    NON_COPYABLE(MyResource);
+    MOVE(MyResource, ARGS);
+    COMPARE(MyResource, ARGS);
+    SERIALIZATION(MyResource, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(NS::Resource)));
+
+#undef ARGS
+
+    size_t GetApproximateSize(void) const override {
+        return NS::Resource::GetApproximateSize() + sizeof(MyResource) - sizeof(NS::Resource) + Applied.capacity();
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, bool) const override {
+        return EvaluateFrom(request, maxNumEvaluations, 0);
+    }
+
+    EvaluateResult EvaluateImpl(Request const &request, size_t maxNumEvaluations, State &continuationState, bool) const override {
+        return EvaluateFrom(request, maxNumEvaluations, static_cast<ContinuationState &>(continuationState).NextEvaluation);
+    }
+
+    ResourcePtr ApplyImpl(State const &applyState) const override {
+        return MyResource::Create(NumEvaluations, static_cast<ApplyState const &>(applyState).Applied);
+    }
+
+    EvaluateResult EvaluateFrom(Request const &request, size_t maxNumEvaluations, size_t evaluation) const {
+        size_t const                        endEvaluation(std::min(NumEvaluations, evaluation + maxNumEvaluations));
+        Evaluations                         evaluations;
+
+        while(evaluation != endEvaluation) {
+            evaluations.emplace_back(
+                Components::Score::Result(
+                    Components::Score::Result::ConditionResults(),
+                    Components::Score::Result::ConditionResults(),
+                    Components::Score::Result::ConditionResults()
+                ),
+                std::make_shared<ApplyState>(*this, Applied + request.Name + std::to_string(evaluation))
+            );
+
+            ++evaluation;
+        }
+
+        if(evaluation == NumEvaluations)
+            return EvaluateResult(std::move(evaluations), ContinuationStatePtr());
+
+        return EvaluateResult(std::move(evaluations), std::make_shared<ContinuationState>(*this, evaluation));
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource::ApplyState);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResource::ContinuationState);
+
+using Strings                               = std::vector<std::string>;
+
+NS::RequestPtrs CreateRequests(Strings const &names) {
+    NS::RequestPtrs                         results;
+
+    for(std::string const &name : names)
+        results.emplace_back(std::make_shared<NS::Request>(name));
+
+    return results;
+}
+
+using WorkingSystemPtr                      = std::shared_ptr<Components::WorkingSystem>;
+
+/// Serializes and deserializes the system
+WorkingSystemPtr RoundTrip(WorkingSystemPtr const &pSystem) {
+    std::stringstream                       stream;
+
+    {
+        boost::archive::binary_oarchive     archive(stream);
+        Components::WorkingSystem::SystemPtr const      pBaseSystem(pSystem);
+
+        archive << pBaseSystem;
+    }
+
+    Components::WorkingSystem::SystemPtr    pResult;
+
+    {
+        boost::archive::binary_iarchive     archive(stream);
+
+        archive >> pResult;
+    }
+
+    WorkingSystemPtr                        pWorkingSystem(std::dynamic_pointer_cast<Components::WorkingSystem>(pResult));
+
+    REQUIRE(pWorkingSystem);
+    return pWorkingSystem;
+}
+
+/// Generates all of the children of the system and then (recursively) the
+/// children of each child, in the order in which they were generated; returns
+/// the Requests applied by each ResultSystem. When `isRoundTrip` is true,
+/// each WorkingSystem is serialized and deserialized before every request to
+/// generate children.
+Strings GenerateResults(WorkingSystemPtr pSystem, size_t maxNumChildren, bool isRoundTrip) {
+    Components::WorkingSystem::SystemPtrs   children;
+
+    while(pSystem->IsComplete() == false) {
+        if(isRoundTrip)
+            pSystem = RoundTrip(pSystem);
+
+        Components::WorkingSystem::SystemPtrs           theseChildren(pSystem->GenerateChildren(maxNumChildren));
+
+        REQUIRE(theseChildren.empty() == false);
+        REQUIRE(theseChildren.size() <= maxNumChildren);
+
+        std::move(theseChildren.begin(), theseChildren.end(), std::back_inserter(children));
+    }
+
+    Strings                                 results;
+
+    for(auto const &pChild : children) {
+        if(auto pWorkingSystem = std::dynamic_pointer_cast<Components::CalculatedWorkingSystem>(pChild)) {
+            Strings                         childResults(GenerateResults(pWorkingSystem->Commit(), maxNumChildren, isRoundTrip));
+
+            std::move(childResults.begin(), childResults.end(), std::back_inserter(results));
+            continue;
+        }
+
+        auto                                pCalculatedResultSystem(std::dynamic_pointer_cast<Components::CalculatedResultSystem>(pChild));
+
+        REQUIRE(pCalculatedResultSystem);
+
+        Components::CalculatedResultSystem::ResultSystemUniquePtr           pResultSystem(pCalculatedResultSystem->Commit());
+        NS::ResultSystem const *                                            pConstrainedResultSystem(dynamic_cast<NS::ResultSystem const *>(pResultSystem.get()));
+
+        REQUIRE(pConstrainedResultSystem);
+        results.emplace_back(static_cast<MyResource const &>(*pConstrainedResultSystem->Resource).Applied);
+    }
+
+    return results;
+}
+
+/// Returns the results generated from the system, verifying that they are the
+/// same when the system and its descendants are serialized along the way.
+Strings GenerateResults(NS::WorkingSystem system, size_t maxNumChildren=10) {
+    WorkingSystemPtr const                  pSystem(std::make_shared<NS::WorkingSystem>(std::move(system)));
+    Strings                                 results(GenerateResults(RoundTrip(pSystem), maxNumChildren, true));
+
+    CHECK(GenerateResults(pSystem, maxNumChildren, false) == results);
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+TEST_CASE("Single Request") {
+    CHECK(GenerateResults(NS::WorkingSystem(std::make_shared<NS::Request>("A"), MyResource::Create(1))) == Strings{ "A0" });
+    CHECK(GenerateResults(NS::WorkingSystem(std::make_shared<NS::Request>("A"), MyResource::Create(3))) == Strings{ "A0", "A1", "A2" });
+
+    // Continuations
+    CHECK(GenerateResults(NS::WorkingSystem(std::make_shared<NS::Request>("A"), MyResource::Create(3)), 1) == Strings{ "A0", "A1", "A2" });
+}
+
+TEST_CASE("Multiple Requests") {
+    CHECK(GenerateResults(NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1))) == Strings{ "A0B0C0" });
+
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(
+                std::make_shared<NS::RequestPtrsContainer>(NS::RequestPtrsContainer{ CreateRequests({ "A", "B" }), CreateRequests({ "C" }) }),
+                MyResource::Create(2)
+            ),
+            1
+        ) == Strings{ "A0B0C0", "A0B0C1", "A0B1C0", "A0B1C1", "A1B0C0", "A1B0C1", "A1B1C0", "A1B1C1" }
+    );
+}
+
+TEST_CASE("Permutations") {
+    // Every Request in the permutation is applied in the permuted order; the
+    // end of the permutation is detected by the Request index rather than the
+    // group index.
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::StandardPermutationGeneratorFactory>(100))
+        ) == Strings{ "A0B0C0", "A0C0B0", "B0A0C0", "B0C0A0", "C0A0B0", "C0B0A0" }
+    );
+
+    // Generating permutations across multiple invocations
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::StandardPermutationGeneratorFactory>(100)),
+            1
+        ) == Strings{ "A0B0C0", "A0C0B0", "B0A0C0", "B0C0A0", "C0A0B0", "C0B0A0" }
+    );
+
+    // maxNumTotalPermutations
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::StandardPermutationGeneratorFactory>(2))
+        ) == Strings{ "A0B0C0", "A0C0B0" }
+    );
+}
+
+TEST_CASE("Permutations - Multiple Groups") {
+    // Completing a permuted group that isn't the last group continues with the
+    // next group.
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(
+                std::make_shared<NS::RequestPtrsContainer>(NS::RequestPtrsContainer{ CreateRequests({ "A", "B" }), CreateRequests({ "C", "D" }) }),
+                MyResource::Create(1),
+                std::make_shared<NS::StandardPermutationGeneratorFactory>(100)
+            )
+        ) == Strings{ "A0B0C0D0", "A0B0D0C0", "B0A0C0D0", "B0A0D0C0" }
+    );
+}
+
+TEST_CASE("Permutations - Continuations") {
+    // Continuations within a permuted group apply the permuted Request
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B" }), MyResource::Create(2), std::make_shared<NS::StandardPermutationGeneratorFactory>(100)),
+            1
+        ) == Strings{ "A0B0", "A0B1", "A1B0", "A1B1", "B0A0", "B0A1", "B1A0", "B1A1" }
+    );
+}
+
+TEST_CASE("Permutations - Children") {
+    // Children carry their permutation as indexes into the group of Requests
+    NS::WorkingSystem                       system(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::StandardPermutationGeneratorFactory>(100));
+    Components::WorkingSystem::SystemPtrs   children(system.GenerateChildren(10));
+
+    REQUIRE(children.size() == 6);
+    CHECK(system.IsComplete());
+
+    Strings                                 results;
+
+    for(auto const &pChild : children) {
+        auto                                pWorkingSystem(std::dynamic_pointer_cast<Components::CalculatedWorkingSystem>(pChild));
+
+        REQUIRE(pWorkingSystem);
+
+        Strings                             childResults(GenerateResults(RoundTrip(pWorkingSystem->Commit()), 10, true));
+
+        REQUIRE(childResults.size() == 1);
+        results.emplace_back(std::move(childResults.front()));
+    }
+
+    CHECK(results == Strings{ "A0B0C0", "A0C0B0", "B0A0C0", "B0C0A0", "C0A0B0", "C0B0A0" });
+}
+
+TEST_CASE("Incremental") {
+    // Each candidate for the next position is swapped into place, so orderings
+    // are reached in a different order than `StandardPermutationGenerator`
+    // generates them; the orderings themselves are the same.
+    Strings const                           expected{ "A0B0C0", "A0C0B0", "B0A0C0", "B0C0A0", "C0B0A0", "C0A0B0" };
+
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::IncrementalPermutationGeneratorFactory>())
+        ) == expected
+    );
+
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::IncrementalPermutationGeneratorFactory>()),
+            1
+        ) == expected
+    );
+
+    // Each child applies one candidate
+    NS::WorkingSystem                       system(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::IncrementalPermutationGeneratorFactory>());
+
+    CHECK(system.GenerateChildren(2).size() == 2);
+    CHECK(system.IsComplete() == false);
+    CHECK(system.GenerateChildren(2).size() == 1);
+    CHECK(system.IsComplete());
+}
+
+TEST_CASE("Incremental - Multiple Groups") {
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(
+                std::make_shared<NS::RequestPtrsContainer>(NS::RequestPtrsContainer{ CreateRequests({ "A", "B" }), CreateRequests({ "C", "D" }) }),
+                MyResource::Create(1),
+                std::make_shared<NS::IncrementalPermutationGeneratorFactory>()
+            )
+        ) == Strings{ "A0B0C0D0", "A0B0D0C0", "B0A0C0D0", "B0A0D0C0" }
+    );
+}
+
+TEST_CASE("Incremental - Continuations") {
+    CHECK(
+        GenerateResults(
+            NS::WorkingSystem(CreateRequests({ "A", "B" }), MyResource::Create(2), std::make_shared<NS::IncrementalPermutationGeneratorFactory>()),
+            1
+        ) == Strings{ "A0B0", "A0B1", "A1B0", "A1B1", "B0A0", "B0A1", "B1A0", "B1A1" }
+    );
+}
+
+TEST_CASE("Approximate Size") {
+    NS::WorkingSystem                       system(CreateRequests({ "A_Request_With_A_Long_Name", "B" }), MyResource::Create(1));
+
+    // The Resource and Requests are included
+    CHECK(system.GetApproximateSize() > system.Components::System::GetApproximateSize());
+
+    // More Requests
+    CHECK(
+        NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1)).GetApproximateSize()
+        > NS::WorkingSystem(CreateRequests({ "A" }), MyResource::Create(1)).GetApproximateSize()
+    );
+
+    // Deeper systems include the data accumulated by their Resource
+    Components::WorkingSystem::SystemPtrs   children(system.GenerateChildren(10));
+
+    REQUIRE(children.size() == 1);
+
+    auto                                    pCalculatedWorkingSystem(std::dynamic_pointer_cast<Components::CalculatedWorkingSystem>(children.front()));
+
+    REQUIRE(pCalculatedWorkingSystem);
+    CHECK(pCalculatedWorkingSystem->GetApproximateSize() > pCalculatedWorkingSystem->Components::System::GetApproximateSize());
+
+    WorkingSystemPtr const                  pChild(pCalculatedWorkingSystem->Commit());
+
+    CHECK(pChild->GetApproximateSize() > system.GetApproximateSize());
+}
+
+TEST_CASE("Serialization") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::StandardPermutationGeneratorFactory>(100)),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
 
-// TODO
-TEST_CASE("TODO") {
-    CHECK(true);
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::WorkingSystem(CreateRequests({ "A", "B", "C" }), MyResource::Create(1), std::make_shared<NS::IncrementalPermutationGeneratorFactory>()),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+                CHECK(true);
+            }
+        ) == 0
+    );
 }
@@ -27,6 +27,40 @@
 namespace DecisionEngine {
 namespace ConstrainedResource {
 
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+
+// Shared data is divided evenly among the objects that reference it so that
+// the sum of the sizes across all Systems approximates the total memory used.
+template <typename T>
+size_t GetSharedSize(std::shared_ptr<T> const &ptr, size_t size) {
+    if(!ptr)
+        return 0;
+
+    return size / static_cast<size_t>(ptr.use_count());
+}
+
+size_t GetPermutationSize(RequestIndexesPtr const &pPermutation) {
+    if(!pPermutation)
+        return 0;
+
+    return GetSharedSize(pPermutation, sizeof(RequestIndexes) + pPermutation->capacity() * sizeof(RequestIndex));
+}
+
+size_t GetStateSize(Resource::ContinuationStatePtr const &pState) {
+    if(!pState)
+        return 0;
+
+    return GetSharedSize(pState, pState->GetApproximateSize());
+}
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------
 // |
 // |  WorkingSystem::ImmutableState
@@ -84,6 +118,15 @@ WorkingSystem::ImmutableState::ImmutableState(RequestPtrsContainerPtr pRequestsC
     OptionalPermutationGeneratorFactory(std::move(optionalPermutationGeneratorFactory))
 {}
 
+size_t WorkingSystem::ImmutableState::GetApproximateSize(void) const {
+    size_t                                  numBytes(sizeof(RequestPtrsContainer) + RequestsContainer->capacity() * sizeof(RequestPtrs));
+
+    for(RequestPtrs const &requests : *RequestsContainer)
+        numBytes += requests.capacity() * sizeof(RequestPtr);
+
+    return sizeof(ImmutableState) + GetSharedSize(RequestsContainer, numBytes);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  WorkingSystem::CurrentState
@@ -101,6 +144,10 @@ WorkingSystem::CurrentState::CurrentState(ResourcePtr pResource, size_t requestO
     RequestOffset(std::move(requestOffset))
 {}
 
+size_t WorkingSystem::CurrentState::GetApproximateSize(void) const {
+    return sizeof(CurrentState) + GetSharedSize(Resource, Resource->GetApproximateSize());
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  WorkingSystem::TransitionState
@@ -125,7 +172,7 @@ WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, A
     )
 {}
 
-WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, ApplyStatePtr pApplyState, RequestPtrsPtr pPermutedRequests) :
+WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, ApplyStatePtr pApplyState, RequestIndexesPtr pPermutation) :
     CurrentState(
         std::move(
             [&pCurrentState](void) -> CurrentStatePtr & {
@@ -142,17 +189,17 @@ WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, A
             }()
         )
     ),
-    OptionalPermutedRequests(
+    OptionalPermutation(
         std::move(
-            [&pPermutedRequests](void) -> RequestPtrsPtr & {
-                ENSURE_ARGUMENT(pPermutedRequests);
-                return pPermutedRequests;
+            [&pPermutation](void) -> RequestIndexesPtr & {
+                ENSURE_ARGUMENT(pPermutation);
+                return pPermutation;
             }()
         )
     )
 {}
 
-WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, RequestPtrsPtr pPermutedRequests) :
+WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, RequestIndexesPtr pPermutation) :
     CurrentState(
         std::move(
             [&pCurrentState](void) -> CurrentStatePtr & {
@@ -161,16 +208,23 @@ WorkingSystem::TransitionState::TransitionState(CurrentStatePtr pCurrentState, R
             }()
         )
     ),
-    OptionalPermutedRequests(
+    OptionalPermutation(
         std::move(
-            [&pPermutedRequests](void) -> RequestPtrsPtr & {
-                ENSURE_ARGUMENT(pPermutedRequests);
-                return pPermutedRequests;
+            [&pPermutation](void) -> RequestIndexesPtr & {
+                ENSURE_ARGUMENT(pPermutation);
+                return pPermutation;
             }()
         )
     )
 {}
 
+size_t WorkingSystem::TransitionState::GetApproximateSize(void) const {
+    return sizeof(TransitionState)
+        + GetSharedSize(CurrentState, CurrentState->GetApproximateSize())
+        + GetStateSize(OptionalApplyState)
+        + GetPermutationSize(OptionalPermutation);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  WorkingSystem
@@ -243,10 +297,19 @@ WorkingSystem::WorkingSystem(ImmutableStatePtr pImmutableState, TransitionState
     else
         make_mutable(_pCurrentState) = transition.CurrentState;
 
-    if(transition.OptionalPermutedRequests)
-        _state = transition.OptionalPermutedRequests;
+    if(transition.OptionalPermutation)
+        _state = transition.OptionalPermutation;
 
     FinalConstruct();
+
+    // Incremental orderings continue to branch until a single Request remains
+    if(
+        transition.OptionalPermutation
+        && _pInitialState->OptionalPermutationGeneratorFactory
+        && _pInitialState->OptionalPermutationGeneratorFactory->IsIncremental()
+        && _requestIndex + 1 < transition.OptionalPermutation->size()
+    )
+        _state = IncrementalInfo(transition.OptionalPermutation, 0, Resource::ContinuationStatePtr(), 0);
 }
 
 std::string WorkingSystem::ToString(void) const /*override*/ {
@@ -261,6 +324,28 @@ bool WorkingSystem::IsComplete(void) const /*override*/ {
     return boost::get<CompletedType>(&_state) != nullptr;
 }
 
+size_t WorkingSystem::GetApproximateSize(void) const /*override*/ {
+    // The InternalState variant is stored inline; only the data that it
+    // references is added here.
+    size_t                                  numBytes(
+        Core::Components::WorkingSystem::GetApproximateSize()
+        + sizeof(WorkingSystem) - sizeof(Core::Components::WorkingSystem)
+        + GetSharedSize(_pInitialState, _pInitialState->GetApproximateSize())
+        + GetSharedSize(_pCurrentState, _pCurrentState->GetApproximateSize())
+    );
+
+    if(ActivePermutationsInfo const * const pInfo = boost::get<ActivePermutationsInfo>(&_state))
+        numBytes += GetSharedSize(pInfo->PermutationGenerator, sizeof(PermutationGenerator));
+    else if(RequestIndexesPtr const * const ppPermutation = boost::get<RequestIndexesPtr>(&_state))
+        numBytes += GetPermutationSize(*ppPermutation);
+    else if(ContinuationInfo const * const pInfo = boost::get<ContinuationInfo>(&_state))
+        numBytes += GetStateSize(pInfo->ContinuationState) + GetPermutationSize(pInfo->OptionalPermutation);
+    else if(IncrementalInfo const * const pInfo = boost::get<IncrementalInfo>(&_state))
+        numBytes += GetPermutationSize(pInfo->Permutation) + GetStateSize(pInfo->ContinuationState);
+
+    return numBytes;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -279,13 +364,16 @@ void WorkingSystem::FinalConstruct(void) {
     make_mutable(_requestsIndex) = static_cast<size_t>(std::distance(_pInitialState->RequestsContainer->cbegin(), pRequests));
     make_mutable(_requestIndex) = requestOffset;
     make_mutable(_atLastRequests) = _requestsIndex == _pInitialState->RequestsContainer->size() - 1;
-    make_mutable(_atLastRequest) = _requestsIndex == pRequests->size() - 1;
+    make_mutable(_atLastRequest) = _requestIndex == pRequests->size() - 1;
 }
 
-WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChildren) /*override*/ {
+WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChildren, bool continueProcessingSystemsWithFailures) /*override*/ {
     assert(maxNumChildren);
     assert(IsComplete() == false);
 
+    // Unsuccessful children will be discarded, so their Results may be partial
+    bool const                              isFailFast(continueProcessingSystemsWithFailures == false);
+
     // ----------------------------------------------------------------------
     struct Internal {
         static void ApplyPermutations(
@@ -299,7 +387,7 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
             assert(maxNumChildren);
             assert(pPermutationGenerator);
 
-            PermutationGenerator::RequestPtrsPtrs       permutations(pPermutationGenerator->Generate(requests, maxNumChildren));
+            PermutationGenerator::RequestIndexesPtrs    permutations(pPermutationGenerator->Generate(requests, maxNumChildren));
 
             for(auto &permutation : permutations)
                 results.emplace_back(
@@ -320,23 +408,26 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
         static void ApplyEvaluations(
             WorkingSystem &ws,
             size_t maxNumChildren,
+            bool isFailFast,
             SystemPtrs &results,
             Request const &request,
+            RequestIndexesPtr pOptionalPermutation,
             Resource::ContinuationStatePtr pOptionalContinuationState,
             size_t evaluationIndex
         ) {
             assert(maxNumChildren);
 
             Resource::EvaluateResult        result(
-                [&ws, &request, &maxNumChildren, &pOptionalContinuationState](void) {
+                [&ws, &request, &maxNumChildren, &pOptionalContinuationState, isFailFast](void) {
                     if(pOptionalContinuationState)
                         return ws._pCurrentState->Resource->Evaluate(
                             request,
                             maxNumChildren,
-                            *pOptionalContinuationState
+                            *pOptionalContinuationState,
+                            isFailFast
                         );
 
-                    return ws._pCurrentState->Resource->Evaluate(request, maxNumChildren);
+                    return ws._pCurrentState->Resource->Evaluate(request, maxNumChildren, isFailFast);
                 }()
             );
 
@@ -361,24 +452,21 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
                         )
                     );
                 }
-                else if(auto *requestPtrs = boost::get<RequestPtrsPtr>(&ws._state)) {
-                    // If here, we just completed a Request within a permutation. Pass the permutation on
-                    // if there are more Requests remaining.
-
-                    if(ws._atLastRequest == false) {
-                        results.emplace_back(
-                            std::make_shared<CalculatedWorkingSystem>(
-                                ws._pInitialState,
-                                TransitionState(
-                                    ws._pCurrentState,
-                                    std::move(evaluation.ApplyState),
-                                    *requestPtrs
-                                ),
-                                std::move(newScore),
-                                std::move(newIndex)
-                            )
-                        );
-                    }
+                else if(pOptionalPermutation && ws._atLastRequest == false) {
+                    // If here, we just completed a Request within a permutation and there are more
+                    // Requests remaining; pass the permutation on.
+                    results.emplace_back(
+                        std::make_shared<CalculatedWorkingSystem>(
+                            ws._pInitialState,
+                            TransitionState(
+                                ws._pCurrentState,
+                                std::move(evaluation.ApplyState),
+                                pOptionalPermutation
+                            ),
+                            std::move(newScore),
+                            std::move(newIndex)
+                        )
+                    );
                 }
                 else {
                     // Pass on the results. An invocation to the resulting CalculatedWorkingSystem will
@@ -398,31 +486,135 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
             }
 
             if(pContinuationState)
-                ws._state = ContinuationInfo(std::move(pContinuationState), evaluationIndex);
+                ws._state = ContinuationInfo(std::move(pContinuationState), evaluationIndex, std::move(pOptionalPermutation));
             else
                 ws._state = CompletedType();
         }
+
+        static void ApplyIncrementalEvaluations(
+            WorkingSystem &ws,
+            size_t maxNumChildren,
+            bool isFailFast,
+            SystemPtrs &results,
+            RequestIndexesPtr pPermutation,
+            size_t candidateOffset,
+            Resource::ContinuationStatePtr pOptionalContinuationState,
+            size_t evaluationIndex
+        ) {
+            assert(maxNumChildren);
+            assert(pPermutation);
+            assert(ws._atLastRequest == false);
+
+            RequestPtrs const &             requests((*ws._pInitialState->RequestsContainer)[ws._requestsIndex]);
+            RequestIndexes const &          permutation(*pPermutation);
+
+            assert(permutation.size() == requests.size());
+            assert(ws._requestIndex + candidateOffset < permutation.size());
+
+            while(maxNumChildren) {
+                size_t const                candidateIndex(ws._requestIndex + candidateOffset);
+                Request const &             request(*requests[permutation[candidateIndex]]);
+
+                Resource::EvaluateResult    result(
+                    [&ws, &request, &maxNumChildren, &pOptionalContinuationState, isFailFast](void) {
+                        if(pOptionalContinuationState)
+                            return ws._pCurrentState->Resource->Evaluate(
+                                request,
+                                maxNumChildren,
+                                *pOptionalContinuationState,
+                                isFailFast
+                            );
+
+                        return ws._pCurrentState->Resource->Evaluate(request, maxNumChildren, isFailFast);
+                    }()
+                );
+
+                Resource::Evaluations &                 evaluations(std::get<0>(result));
+
+                assert(evaluations.empty() == false);
+                assert(evaluations.size() <= maxNumChildren);
+
+                // Children apply the candidate at the current position; the
+                // Requests that have already been applied are unchanged.
+                RequestIndexesPtr const     pOrdering(
+                    [&pPermutation, &permutation, &ws, candidateIndex](void) {
+                        if(candidateIndex == ws._requestIndex)
+                            return pPermutation;
+
+                        RequestIndexes      ordering(permutation);
+
+                        std::swap(ordering[ws._requestIndex], ordering[candidateIndex]);
+                        return std::make_shared<RequestIndexes>(std::move(ordering));
+                    }()
+                );
+
+                for(auto &evaluation : evaluations) {
+                    results.emplace_back(
+                        std::make_shared<CalculatedWorkingSystem>(
+                            ws._pInitialState,
+                            TransitionState(
+                                ws._pCurrentState,
+                                std::move(evaluation.ApplyState),
+                                pOrdering
+                            ),
+                            Score(ws.GetScore(), std::move(evaluation.Result), false),
+                            Index(ws.GetIndex(), evaluationIndex++)
+                        )
+                    );
+                }
+
+                maxNumChildren -= evaluations.size();
+                pOptionalContinuationState = std::move(std::get<1>(result));
+
+                if(pOptionalContinuationState)
+                    continue;
+
+                ++candidateOffset;
+
+                if(ws._requestIndex + candidateOffset == permutation.size()) {
+                    ws._state = CompletedType();
+                    return;
+                }
+            }
+
+            ws._state = IncrementalInfo(std::move(pPermutation), candidateOffset, std::move(pOptionalContinuationState), evaluationIndex);
+        }
     };
     // ----------------------------------------------------------------------
 
     SystemPtrs                              results;
+    RequestPtrs const &                     requests((*_pInitialState->RequestsContainer)[_requestsIndex]);
 
-    if(auto *ppRequestPtrs = boost::get<RequestPtrsPtr>(&_state)) {
+    if(auto *ppPermutation = boost::get<RequestIndexesPtr>(&_state)) {
         // If here, we are extracting results for a request that is part of a permutation
-        RequestPtrs const &                 requests(**ppRequestPtrs);
-        Request const &                     request(*requests[_requestIndex]);
+        RequestIndexesPtr                   pPermutation(*ppPermutation);
+        Request const &                     request(*requests[(*pPermutation)[_requestIndex]]);
 
         Internal::ApplyEvaluations(
             *this,
             maxNumChildren,
+            isFailFast,
             results,
             request,
+            std::move(pPermutation),
             Resource::ContinuationStatePtr(),
             0
         );
     }
+    else if(auto *incrementalInfo = boost::get<IncrementalInfo>(&_state)) {
+        // Evaluate more candidates for the next Request in the ordering
+        Internal::ApplyIncrementalEvaluations(
+            *this,
+            maxNumChildren,
+            isFailFast,
+            results,
+            std::move(incrementalInfo->Permutation),
+            std::move(incrementalInfo->CandidateOffset),
+            std::move(incrementalInfo->ContinuationState),
+            std::move(incrementalInfo->EvaluationIndex)
+        );
+    }
     else {
-        RequestPtrs const &                 requests((*_pInitialState->RequestsContainer)[_requestsIndex]);
         Request const &                     request(*requests[_requestIndex]);
 
         if(boost::get<InitializedType>(&_state)) {
@@ -433,8 +625,32 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
                 Internal::ApplyEvaluations(
                     *this,
                     maxNumChildren,
+                    isFailFast,
                     results,
                     request,
+                    RequestIndexesPtr(),
+                    Resource::ContinuationStatePtr(),
+                    0
+                );
+            }
+            else if(_pInitialState->OptionalPermutationGeneratorFactory->IsIncremental()) {
+                // Build the ordering one Request at a time
+                Internal::ApplyIncrementalEvaluations(
+                    *this,
+                    maxNumChildren,
+                    isFailFast,
+                    results,
+                    [&requests](void) {
+                        RequestIndexes      permutation;
+
+                        permutation.reserve(requests.size());
+
+                        for(RequestIndex index = 0; index < requests.size(); ++index)
+                            permutation.emplace_back(index);
+
+                        return std::make_shared<RequestIndexes>(std::move(permutation));
+                    }(),
+                    0,
                     Resource::ContinuationStatePtr(),
                     0
                 );
@@ -464,11 +680,15 @@ WorkingSystem::SystemPtrs WorkingSystem::GenerateChildrenImpl(size_t maxNumChild
         }
         else if(auto *continuationInfo = boost::get<ContinuationInfo>(&_state)) {
             // Generate more evaluations
+            RequestIndexesPtr               pPermutation(std::move(continuationInfo->OptionalPermutation));
+
             Internal::ApplyEvaluations(
                 *this,
                 maxNumChildren,
+                isFailFast,
                 results,
-                request,
+                pPermutation ? *requests[(*pPermutation)[_requestIndex]] : request,
+                pPermutation,
                 std::move(continuationInfo->ContinuationState),
                 std::move(continuationInfo->EvaluationIndex)
             );
@@ -75,6 +75,8 @@ public:
 
 #undef ARGS
 
+        size_t GetApproximateSize(void) const;
+
     private:
         // ----------------------------------------------------------------------
         // |  Private Method
@@ -106,6 +108,8 @@ public:
         SERIALIZATION(CurrentState, ARGS);
 
 #undef ARGS
+
+        size_t GetApproximateSize(void) const;
     };
 
     using ImmutableStatePtr                 = std::shared_ptr<ImmutableState>;
@@ -127,17 +131,17 @@ public:
         // |  Public Data
         CurrentStatePtr const               CurrentState;
         ApplyStatePtr const                 OptionalApplyState;
-        RequestPtrsPtr const                OptionalPermutedRequests;
+        RequestIndexesPtr const             OptionalPermutation;
 
         // ----------------------------------------------------------------------
         // |  Public Methods
         TransitionState(CurrentStatePtr pCurrentState, ApplyStatePtr pApplyState);
-        TransitionState(CurrentStatePtr pCurrentState, ApplyStatePtr pApplyState, RequestPtrsPtr pPermutedRequests);
-        TransitionState(CurrentStatePtr pCurrentState, RequestPtrsPtr pPermutedRequests);
+        TransitionState(CurrentStatePtr pCurrentState, ApplyStatePtr pApplyState, RequestIndexesPtr pPermutation);
+        TransitionState(CurrentStatePtr pCurrentState, RequestIndexesPtr pPermutation);
 
         ~TransitionState(void) = default;
 
-#define ARGS                                MEMBERS(CurrentState, OptionalApplyState, OptionalPermutedRequests)
+#define ARGS                                MEMBERS(CurrentState, OptionalApplyState, OptionalPermutation)
 
         NON_COPYABLE(TransitionState);
         MOVE(TransitionState, ARGS);
@@ -145,6 +149,8 @@ public:
         SERIALIZATION(TransitionState, ARGS);
 
 #undef ARGS
+
+        size_t GetApproximateSize(void) const;
     };
 
 private:
@@ -188,12 +194,13 @@ private:
         // |  Public Data
         Resource::ContinuationStatePtr      ContinuationState;
         size_t                              EvaluationIndex;
+        RequestIndexesPtr                   OptionalPermutation;
 
         // ----------------------------------------------------------------------
         // |  Public Methods
         ContinuationInfo(void) = default;
 
-#define ARGS                                MEMBERS(ContinuationState, EvaluationIndex)
+#define ARGS                                MEMBERS(ContinuationState, EvaluationIndex, OptionalPermutation)
 
         CONSTRUCTOR(ContinuationInfo, ARGS);
         COPY(ContinuationInfo, ARGS);
@@ -201,6 +208,34 @@ private:
         COMPARE(ContinuationInfo, ARGS);
         SERIALIZATION(ContinuationInfo, ARGS);
 
+#undef ARGS
+    };
+
+    // Note that this object must be default constructible and copyable to support serialization via boost::variants
+    class IncrementalInfo {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Data
+
+        // Requests before the current Request index have been applied; the
+        // remaining Requests are candidates for the next position.
+        RequestIndexesPtr                   Permutation;
+        size_t                              CandidateOffset;
+        Resource::ContinuationStatePtr      ContinuationState;
+        size_t                              EvaluationIndex;
+
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        IncrementalInfo(void) = default;
+
+#define ARGS                                MEMBERS(Permutation, CandidateOffset, ContinuationState, EvaluationIndex)
+
+        CONSTRUCTOR(IncrementalInfo, ARGS);
+        COPY(IncrementalInfo, ARGS);
+        MOVE(IncrementalInfo, ARGS);
+        COMPARE(IncrementalInfo, ARGS);
+        SERIALIZATION(IncrementalInfo, ARGS);
+
 #undef ARGS
     };
 
@@ -209,6 +244,7 @@ private:
     //      1) Permutations remain
     //      2) Requests remain in the current permutation
     //      3) There are additional evaluations left when applying the Request to the Resource
+    //      4) Candidates remain for the next Request in an incremental ordering
 
     using InitializedType                   = bool;
     using CompletedType                     = float;
@@ -222,9 +258,10 @@ private:
         boost::variant<
             InitializedType,                // Initializing
             ActivePermutationsInfo,         // (1)
-            RequestPtrsPtr,                 // (2)
+            RequestIndexesPtr,              // (2)
             ContinuationInfo,               // (3)
-            CompletedType                   // Completed
+            CompletedType,                  // Completed
+            IncrementalInfo                 // (4)
         >;
 
     // ----------------------------------------------------------------------
@@ -267,6 +304,8 @@ public:
 
     bool IsComplete(void) const override;
 
+    size_t GetApproximateSize(void) const override;
+
 private:
     // ----------------------------------------------------------------------
     // |  Relationships
@@ -292,7 +331,7 @@ private:
     // ----------------------------------------------------------------------
     void FinalConstruct(void);
 
-    SystemPtrs GenerateChildrenImpl(size_t maxNumChildren) override;
+    SystemPtrs GenerateChildrenImpl(size_t maxNumChildren, bool continueProcessingSystemsWithFailures) override;
 };
 
 } // namespace ConstrainedResource
@@ -18,17 +18,33 @@ function(Impl)
             DecisionEngineConstrainedResource
 
         FILES
+            ${_this_path}/../AdaptiveConditionOrderer.cpp
+            ${_this_path}/../AdaptiveConditionOrderer.h
             ${_this_path}/../CalculatedResultSystem.cpp
             ${_this_path}/../CalculatedResultSystem.h
             ${_this_path}/../CalculatedWorkingSystem.cpp
             ${_this_path}/../CalculatedWorkingSystem.h
             ${_this_path}/../Condition.cpp
             ${_this_path}/../Condition.h
+            ${_this_path}/../ConditionCache.cpp
+            ${_this_path}/../ConditionCache.h
+            ${_this_path}/../DistinctPermutationGenerator.cpp
+            ${_this_path}/../DistinctPermutationGenerator.h
             ${_this_path}/../ConstrainedResource.h
+            ${_this_path}/../HeuristicPermutationGenerator.cpp
+            ${_this_path}/../HeuristicPermutationGenerator.h
             ${_this_path}/../PermutationGenerator.cpp
             ${_this_path}/../PermutationGenerator.h
             ${_this_path}/../PermutationGeneratorFactory.cpp
             ${_this_path}/../PermutationGeneratorFactory.h
+            ${_this_path}/../PrecedencePermutationGenerator.cpp
+            ${_this_path}/../PrecedencePermutationGenerator.h
+            ${_this_path}/../ProblemSnapshot.cpp
+            ${_this_path}/../ProblemSnapshot.h
+            ${_this_path}/../RandomPermutationGenerator.cpp
+            ${_this_path}/../RandomPermutationGenerator.h
+            ${_this_path}/../RankedPermutationGenerator.cpp
+            ${_this_path}/../RankedPermutationGenerator.h
             ${_this_path}/../Request.cpp
             ${_this_path}/../Request.h
             ${_this_path}/../Resource.cpp
@@ -37,6 +53,8 @@ function(Impl)
             ${_this_path}/../ResultSystem.h
             ${_this_path}/../StandardPermutationGenerator.cpp
             ${_this_path}/../StandardPermutationGenerator.h
+            ${_this_path}/../StridedPermutationGenerator.cpp
+            ${_this_path}/../StridedPermutationGenerator.h
             ${_this_path}/../WorkingSystem.cpp
             ${_this_path}/../WorkingSystem.h
 
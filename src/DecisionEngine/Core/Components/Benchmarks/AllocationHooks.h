@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AllocationHooks.h
+///  \brief         Replaces the global allocation functions so that
+///                 benchmarks can count heap allocations
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:45:27
+///
+///  \note          Include this file in exactly one translation unit of a
+///                 benchmark executable; it must never be included in a
+///                 library.
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "BenchmarkHelpers.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+namespace Benchmarks {
+namespace Details {
+
+inline void * CountedAllocate(size_t size) {
+    g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+    g_numAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    void *                                  pResult(std::malloc(size ? size : 1));
+
+    if(pResult == nullptr)
+        throw std::bad_alloc();
+
+    return pResult;
+}
+
+inline bool const                           g_allocationHooksInitialized(
+    [](void) {
+        g_areAllocationsCounted = true;
+        return true;
+    }()
+);
+
+} // namespace Details
+} // namespace Benchmarks
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
+
+// Over-aligned allocations use the default implementation and are not counted
+void * operator new(size_t size) { return DecisionEngine::Core::Components::Benchmarks::Details::CountedAllocate(size); }
+void * operator new[](size_t size) { return DecisionEngine::Core::Components::Benchmarks::Details::CountedAllocate(size); }
+void operator delete(void *pData) noexcept { std::free(pData); }
+void operator delete[](void *pData) noexcept { std::free(pData); }
+void operator delete(void *pData, size_t) noexcept { std::free(pData); }
+void operator delete[](void *pData, size_t) noexcept { std::free(pData); }
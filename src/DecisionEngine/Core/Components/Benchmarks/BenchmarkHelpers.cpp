@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          BenchmarkHelpers.cpp
+///  \brief         See BenchmarkHelpers.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 12:08:32
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "BenchmarkHelpers.h"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if (defined _WIN32)
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+namespace Benchmarks {
+
+// ----------------------------------------------------------------------
+// |
+// |  Report
+// |
+// ----------------------------------------------------------------------
+void Report::Write(std::ostream &stream) const {
+    stream << "{\n    \"benchmark\": \"" << Escape(Benchmark) << "\",\n    \"results\": [";
+
+    for(size_t resultIndex = 0; resultIndex < _results.size(); ++resultIndex) {
+        Result const &                      result(_results[resultIndex]);
+
+        stream
+            << (resultIndex ? "," : "")
+            << "\n        {\n            \"name\": \"" << Escape(result.Name) << "\",\n            \"parameters\": {";
+
+        for(size_t index = 0; index < result.Params.size(); ++index)
+            stream << (index ? ", " : "") << "\"" << Escape(result.Params[index].first) << "\": \"" << Escape(result.Params[index].second) << "\"";
+
+        stream << "},\n            \"metrics\": [";
+
+        for(size_t metricIndex = 0; metricIndex < result.Values.size(); ++metricIndex) {
+            Metric const &                  metric(result.Values[metricIndex]);
+
+            stream
+                << (metricIndex ? "," : "")
+                << "\n                {\"name\": \"" << Escape(metric.Name)
+                << "\", \"unit\": \"" << Escape(metric.Unit)
+                << "\", \"better\": \"" << (metric.IsHigherBetter ? "higher" : "lower")
+                << "\", \"values\": [";
+
+            for(size_t index = 0; index < metric.Values.size(); ++index)
+                stream << (index ? ", " : "") << ToJsonNumber(metric.Values[index]);
+
+            stream << "]}";
+        }
+
+        stream << "\n            ]\n        }";
+    }
+
+    stream << "\n    ]\n}\n";
+}
+
+void Report::Write(std::string const &filename) const {
+    if(filename.empty()) {
+        Write(std::cout);
+        return;
+    }
+
+    std::ofstream                           stream(filename);
+
+    if(stream.is_open() == false)
+        throw std::runtime_error(boost::str(boost::format("Unable to open '%1%'") % filename));
+
+    Write(stream);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// static
+std::string Report::Escape(std::string const &value) {
+    std::string                             result;
+
+    for(char c : value) {
+        if(c == '"' || c == '\\')
+            result += '\\';
+
+        result += c;
+    }
+
+    return result;
+}
+
+// static
+std::string Report::ToJsonNumber(double value) {
+    // JSON doesn't support NaN or infinity
+    if(std::isfinite(value) == false)
+        return "null";
+
+    std::ostringstream                      out;
+
+    out << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    return out.str();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Public Methods
+// |
+// ----------------------------------------------------------------------
+size_t GetPeakRssBytes(void) {
+#if (defined _WIN32)
+    PROCESS_MEMORY_COUNTERS                 counters;
+
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == FALSE)
+        return 0;
+
+    return static_cast<size_t>(counters.PeakWorkingSetSize);
+#else
+    struct rusage                           usage;
+
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+#   if (defined __APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+#   else
+    // Linux reports the value in kilobytes
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#   endif
+#endif
+}
+
+bool ResetPeakRss(void) {
+#if (defined __linux__)
+    std::ofstream                           stream("/proc/self/clear_refs");
+
+    if(stream.is_open() == false)
+        return false;
+
+    stream << "5";
+    stream.flush();
+
+    return stream.good();
+#else
+    return false;
+#endif
+}
+
+} // namespace Benchmarks
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
@@ -0,0 +1,339 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          BenchmarkHelpers.h
+///  \brief         Functionality common to the DecisionEngine benchmarks
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:43:25
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \namespace     Benchmarks
+///  \brief         Command line parsing, measurement, and JSON reporting shared
+///                 by the benchmark executables.
+///
+///                 Every benchmark writes a report with the following structure,
+///                 which is consumed by the baseline comparison tool:
+///
+///                     {
+///                         "benchmark": "<name>",
+///                         "results": [
+///                             {
+///                                 "name": "<unique name for the parameters>",
+///                                 "parameters": { "<name>": "<value>", ... },
+///                                 "metrics": [
+///                                     {
+///                                         "name": "<name>",
+///                                         "unit": "<unit>",
+///                                         "better": "higher" | "lower",
+///                                         "values": [ <one value per repetition>, ... ]
+///                                     },
+///                                     ...
+///                                 ]
+///                             },
+///                             ...
+///                         ]
+///                     }
+///
+namespace Benchmarks {
+
+// ----------------------------------------------------------------------
+// |
+// |  Public Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Arguments
+///  \brief         Parses command line arguments in the form `--name=value`,
+///                 where values may be a comma-delimited list to define a
+///                 parameter sweep.
+///
+class Arguments {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    Arguments(int argc, char const * const *argv) {
+        for(int index = 1; index < argc; ++index) {
+            std::string const               arg(argv[index]);
+
+            if(arg.size() < 3 || arg[0] != '-' || arg[1] != '-')
+                throw std::invalid_argument(boost::str(boost::format("Invalid argument '%1%'") % arg));
+
+            std::string::size_type const    equal(arg.find('='));
+
+            if(equal == std::string::npos)
+                _values[arg.substr(2)] = "1";
+            else
+                _values[arg.substr(2, equal - 2)] = arg.substr(equal + 1);
+        }
+    }
+
+    /// Returns true if the argument was provided
+    bool Has(std::string const &name) {
+        _used.insert(name);
+        return _values.find(name) != _values.end();
+    }
+
+    /// Returns the comma-delimited values associated with the argument or `defaultValues` if the argument wasn't provided
+    template <typename T>
+    std::vector<T> GetValues(std::string const &name, std::vector<T> defaultValues) {
+        _used.insert(name);
+
+        std::map<std::string, std::string>::const_iterator const            iter(_values.find(name));
+
+        if(iter == _values.end())
+            return defaultValues;
+
+        std::vector<std::string>            strings;
+
+        boost::algorithm::split(strings, iter->second, [](char c) { return c == ','; });
+
+        std::vector<T>                      results;
+
+        results.reserve(strings.size());
+
+        for(std::string const &str : strings) {
+            try {
+                results.emplace_back(boost::lexical_cast<T>(str));
+            }
+            catch(boost::bad_lexical_cast const &) {
+                throw std::invalid_argument(boost::str(boost::format("Invalid value '%1%' for '--%2%'") % str % name));
+            }
+        }
+
+        return results;
+    }
+
+    /// Returns the value associated with the argument or `defaultValue` if the argument wasn't provided
+    template <typename T>
+    T GetValue(std::string const &name, T defaultValue) {
+        std::vector<T>                      values(GetValues<T>(name, std::vector<T>{ std::move(defaultValue) }));
+
+        if(values.size() != 1)
+            throw std::invalid_argument(boost::str(boost::format("A single value is expected for '--%1%'") % name));
+
+        return std::move(values.front());
+    }
+
+    /// Throws if any of the provided arguments were not queried (which usually indicates a typo)
+    void EnsureAllUsed(void) const {
+        for(auto const &kvp : _values) {
+            if(_used.find(kvp.first) == _used.end())
+                throw std::invalid_argument(boost::str(boost::format("Unrecognized argument '--%1%'") % kvp.first));
+        }
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::map<std::string, std::string>      _values;
+    std::set<std::string>                   _used;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         AllocationCounts
+///  \brief         Number of heap allocations made by the process; these values
+///                 are only updated when `AllocationHooks.h` is included in
+///                 the benchmark executable.
+///
+struct AllocationCounts {
+    std::uint64_t                           NumAllocations;
+    std::uint64_t                           NumBytes;
+
+    AllocationCounts operator-(AllocationCounts const &other) const {
+        return AllocationCounts{ NumAllocations - other.NumAllocations, NumBytes - other.NumBytes };
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Metric
+///  \brief         Measurements collected across multiple repetitions.
+///
+struct Metric {
+    std::string                             Name;
+    std::string                             Unit;
+    bool                                    IsHigherBetter;
+    std::vector<double>                     Values;
+};
+
+using Metrics                               = std::vector<Metric>;
+using Parameters                            = std::vector<std::pair<std::string, std::string>>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Report
+///  \brief         Collects results and writes them as JSON.
+///
+class Report {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::string const                       Benchmark;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    Report(std::string benchmark) :
+        Benchmark(std::move(benchmark))
+    {}
+
+    void Add(Parameters parameters, Metrics metrics) {
+        std::vector<std::string>            names;
+
+        for(auto const &parameter : parameters)
+            names.emplace_back(parameter.first + "=" + parameter.second);
+
+        _results.emplace_back(
+            Result{
+                boost::algorithm::join(names, ","),
+                std::move(parameters),
+                std::move(metrics)
+            }
+        );
+    }
+
+    void Write(std::ostream &stream) const;
+
+    /// Writes the report to the filename or to stdout if the filename is empty
+    void Write(std::string const &filename) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct Result {
+        std::string                         Name;
+        Parameters                          Params;
+        Metrics                             Values;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::vector<Result>                     _results;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static std::string Escape(std::string const &value);
+
+    static std::string ToJsonNumber(double value);
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Public Methods
+// |
+// ----------------------------------------------------------------------
+
+/// Returns the peak resident set size of the current process in bytes (or 0 if it can't be determined)
+size_t GetPeakRssBytes(void);
+
+/// Resets the peak resident set size so that it can be measured for a single configuration
+/// within a parameter sweep. Returns false if this isn't supported on the current platform,
+/// in which case `GetPeakRssBytes` is a high-water mark across the process lifetime.
+bool ResetPeakRss(void);
+
+namespace Details {
+
+inline std::atomic<std::uint64_t>           g_numAllocations(0);
+inline std::atomic<std::uint64_t>           g_numAllocatedBytes(0);
+inline std::atomic<bool>                    g_areAllocationsCounted(false);
+
+} // namespace Details
+
+/// Returns true if `AllocationHooks.h` has been included in the executable
+inline bool AreAllocationsCounted(void) {
+    return Details::g_areAllocationsCounted.load(std::memory_order_relaxed);
+}
+
+/// Returns the number of allocations made so far; take the difference of two
+/// calls to measure the allocations made by a block of code.
+inline AllocationCounts GetAllocationCounts(void) {
+    return AllocationCounts{
+        Details::g_numAllocations.load(std::memory_order_relaxed),
+        Details::g_numAllocatedBytes.load(std::memory_order_relaxed)
+    };
+}
+
+/// Returns the number of seconds between two time points
+inline double ToSeconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+}
+
+/// Invokes `func` with every combination of values (the cartesian product)
+template <typename T, typename FuncT>
+void ForEachCombination(std::vector<std::vector<T>> const &values, FuncT const &func) {
+    // ----------------------------------------------------------------------
+    using Indexes                           = std::vector<size_t>;
+    // ----------------------------------------------------------------------
+
+    if(values.empty() || std::any_of(values.begin(), values.end(), [](std::vector<T> const &v) { return v.empty(); }))
+        return;
+
+    Indexes                                 indexes(values.size(), 0);
+    std::vector<T>                          current;
+
+    current.reserve(values.size());
+
+    for(;;) {
+        current.clear();
+
+        for(size_t index = 0; index < values.size(); ++index)
+            current.emplace_back(values[index][indexes[index]]);
+
+        func(current);
+
+        // Increment the indexes (the last index varies fastest)
+        size_t                              index(values.size());
+
+        while(index) {
+            --index;
+
+            if(++indexes[index] != values[index].size())
+                break;
+
+            indexes[index] = 0;
+
+            if(index == 0)
+                return;
+        }
+    }
+}
+
+} // namespace Benchmarks
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
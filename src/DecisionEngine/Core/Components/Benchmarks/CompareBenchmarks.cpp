@@ -0,0 +1,411 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompareBenchmarks.cpp
+///  \brief         Compares benchmark results with a baseline and fails when
+///                 there is a statistically significant regression
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:49:20
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "BenchmarkHelpers.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <filesystem>
+#include <iostream>
+#include <random>
+
+namespace Benchmarks                        = DecisionEngine::Core::Components::Benchmarks;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MetricKey
+///  \brief         Uniquely identifies a metric across benchmark reports.
+///
+struct MetricKey {
+    std::string                             Benchmark;
+    std::string                             Result;
+    std::string                             Metric;
+
+    bool operator<(MetricKey const &other) const {
+        return std::tie(Benchmark, Result, Metric) < std::tie(other.Benchmark, other.Result, other.Metric);
+    }
+};
+
+using MetricMap                             = std::map<MetricKey, Benchmarks::Metric>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Comparison
+///  \brief         Comparison of a single metric with its baseline.
+///
+struct Comparison {
+    enum class StatusValue {
+        Unchanged,
+        Improved,
+        Regressed,
+        Missing,                            /// The metric is in the baseline but not in the current results
+        New                                 /// The metric is in the current results but not in the baseline
+    };
+
+    MetricKey                               Key;
+    StatusValue                             Status;
+    double                                  BaselineMedian;
+    double                                  CurrentMedian;
+    double                                  RatioLow;       /// Confidence interval for current / baseline
+    double                                  RatioHigh;
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+void Usage(void) {
+    std::cerr
+        << "Compares benchmark JSON results with a baseline. Returns 1 if any metric has\n"
+        << "regressed, where a regression is a change in the ratio of medians\n"
+        << "(current / baseline) whose entire bootstrap confidence interval is worse than\n"
+        << "the threshold. Also returns 1 if a baseline metric has no current values or a\n"
+        << "current file has no baseline, unless '--allow-missing' is provided.\n"
+        << "\n"
+        << "    --baseline=<file or directory>  Baseline results\n"
+        << "    --current=<file or directory>   Current results; when a directory, every '.json' file is compared\n"
+        << "                                    with the file of the same name in the baseline directory\n"
+        << "\n"
+        << "    --threshold=<ratio>             Changes smaller than this ratio are ignored [0.05]\n"
+        << "    --confidence=<0.0-1.0>          Confidence level of the interval [0.95]\n"
+        << "    --resamples=<n>                 Number of bootstrap resamples [2000]\n"
+        << "    --metrics=<name,...>            Only compare these metrics; all metrics are compared by default\n"
+        << "    --allow-missing                 Report missing metrics and baselines without failing\n"
+        << "    --update                        Copy the current results to the baseline rather than comparing\n"
+        << "\n";
+}
+
+MetricMap ReadReport(std::filesystem::path const &filename) {
+    boost::property_tree::ptree             root;
+
+    try {
+        boost::property_tree::read_json(filename.string(), root);
+    }
+    catch(boost::property_tree::json_parser_error const &ex) {
+        throw std::runtime_error(boost::str(boost::format("Unable to read '%1%': %2%") % filename.string() % ex.what()));
+    }
+
+    std::string const                       benchmark(root.get<std::string>("benchmark"));
+    MetricMap                               results;
+
+    for(auto const &resultKvp : root.get_child("results")) {
+        std::string const                   resultName(resultKvp.second.get<std::string>("name"));
+
+        for(auto const &metricKvp : resultKvp.second.get_child("metrics")) {
+            boost::property_tree::ptree const &         metric(metricKvp.second);
+            std::vector<double>                         values;
+
+            for(auto const &valueKvp : metric.get_child("values")) {
+                // NaN and infinity are written as null
+                boost::optional<double> const           value(valueKvp.second.get_value_optional<double>());
+
+                if(value)
+                    values.emplace_back(*value);
+            }
+
+            results.emplace(
+                MetricKey{ benchmark, resultName, metric.get<std::string>("name") },
+                Benchmarks::Metric{
+                    metric.get<std::string>("name"),
+                    metric.get<std::string>("unit"),
+                    metric.get<std::string>("better") == "higher",
+                    std::move(values)
+                }
+            );
+        }
+    }
+
+    return results;
+}
+
+double GetMedian(std::vector<double> values) {
+    assert(values.empty() == false);
+
+    size_t const                            middle(values.size() / 2);
+
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle), values.end());
+
+    if(values.size() % 2)
+        return values[middle];
+
+    double const                            upper(values[middle]);
+
+    return (*std::max_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle)) + upper) / 2.0;
+}
+
+/// Returns the bootstrap percentile confidence interval for the ratio of the
+/// current median to the baseline median.
+std::tuple<double, double> GetRatioConfidenceInterval(
+    std::vector<double> const &baseline,
+    std::vector<double> const &current,
+    double confidence,
+    size_t numResamples
+) {
+    // A fixed seed makes the results reproducible
+    std::mt19937_64                         generator(0);
+
+    auto const                              resampleFunc(
+        [&generator](std::vector<double> const &values, std::vector<double> &sample) {
+            std::uniform_int_distribution<size_t>       distribution(0, values.size() - 1);
+
+            sample.clear();
+
+            for(size_t index = 0; index < values.size(); ++index)
+                sample.emplace_back(values[distribution(generator)]);
+        }
+    );
+
+    std::vector<double>                     ratios;
+    std::vector<double>                     baselineSample;
+    std::vector<double>                     currentSample;
+
+    ratios.reserve(numResamples);
+
+    for(size_t index = 0; index < numResamples; ++index) {
+        resampleFunc(baseline, baselineSample);
+        resampleFunc(current, currentSample);
+
+        double const                        baselineMedian(GetMedian(baselineSample));
+
+        if(baselineMedian != 0.0)
+            ratios.emplace_back(GetMedian(currentSample) / baselineMedian);
+    }
+
+    if(ratios.empty())
+        return std::make_tuple(std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN());
+
+    std::sort(ratios.begin(), ratios.end());
+
+    double const                            tail((1.0 - confidence) / 2.0);
+    size_t const                            lowIndex(static_cast<size_t>(tail * static_cast<double>(ratios.size() - 1)));
+    size_t const                            highIndex(static_cast<size_t>((1.0 - tail) * static_cast<double>(ratios.size() - 1) + 0.5));
+
+    return std::make_tuple(ratios[lowIndex], ratios[highIndex]);
+}
+
+std::vector<Comparison> Compare(
+    MetricMap const &baseline,
+    MetricMap const &current,
+    std::set<std::string> const &metricNames,
+    double threshold,
+    double confidence,
+    size_t numResamples
+) {
+    // ----------------------------------------------------------------------
+    using StatusValue                       = Comparison::StatusValue;
+    // ----------------------------------------------------------------------
+
+    double const                            nan(std::numeric_limits<double>::quiet_NaN());
+    std::vector<Comparison>                 results;
+
+    auto const                              isIncludedFunc(
+        [&metricNames](MetricKey const &key) {
+            return metricNames.empty() || metricNames.find(key.Metric) != metricNames.end();
+        }
+    );
+
+    for(auto const &kvp : baseline) {
+        if(isIncludedFunc(kvp.first) == false)
+            continue;
+
+        MetricMap::const_iterator const     iter(current.find(kvp.first));
+
+        if(iter == current.end() || iter->second.Values.empty() || kvp.second.Values.empty()) {
+            results.emplace_back(Comparison{ kvp.first, StatusValue::Missing, nan, nan, nan, nan });
+            continue;
+        }
+
+        Benchmarks::Metric const &          baselineMetric(kvp.second);
+        Benchmarks::Metric const &          currentMetric(iter->second);
+        double const                        baselineMedian(GetMedian(baselineMetric.Values));
+        double const                        currentMedian(GetMedian(currentMetric.Values));
+
+        double                              ratioLow;
+        double                              ratioHigh;
+
+        std::tie(ratioLow, ratioHigh) = GetRatioConfidenceInterval(baselineMetric.Values, currentMetric.Values, confidence, numResamples);
+
+        StatusValue                         status(StatusValue::Unchanged);
+
+        if(std::isnan(ratioLow) == false) {
+            // Higher values are worse when lower is better (and vice versa)
+            bool const                      isWorse(baselineMetric.IsHigherBetter ? ratioHigh < 1.0 - threshold : ratioLow > 1.0 + threshold);
+            bool const                      isBetter(baselineMetric.IsHigherBetter ? ratioLow > 1.0 + threshold : ratioHigh < 1.0 - threshold);
+
+            if(isWorse)
+                status = StatusValue::Regressed;
+            else if(isBetter)
+                status = StatusValue::Improved;
+        }
+
+        results.emplace_back(Comparison{ kvp.first, status, baselineMedian, currentMedian, ratioLow, ratioHigh });
+    }
+
+    for(auto const &kvp : current) {
+        if(isIncludedFunc(kvp.first) && baseline.find(kvp.first) == baseline.end())
+            results.emplace_back(Comparison{ kvp.first, StatusValue::New, nan, kvp.second.Values.empty() ? nan : GetMedian(kvp.second.Values), nan, nan });
+    }
+
+    return results;
+}
+
+char const * ToString(Comparison::StatusValue status) {
+    switch(status) {
+    case Comparison::StatusValue::Unchanged:
+        return "ok";
+    case Comparison::StatusValue::Improved:
+        return "improved";
+    case Comparison::StatusValue::Regressed:
+        return "REGRESSED";
+    case Comparison::StatusValue::Missing:
+        return "missing";
+    case Comparison::StatusValue::New:
+        return "new";
+    }
+
+    assert(!"Invalid StatusValue");
+    return "";
+}
+
+/// Returns a list of (baseline, current) filenames to compare
+std::vector<std::tuple<std::filesystem::path, std::filesystem::path>> GetFilenames(std::filesystem::path const &baseline, std::filesystem::path const &current) {
+    std::vector<std::tuple<std::filesystem::path, std::filesystem::path>>  results;
+
+    if(std::filesystem::is_directory(current)) {
+        for(auto const &entry : std::filesystem::directory_iterator(current)) {
+            if(entry.is_regular_file() && entry.path().extension() == ".json")
+                results.emplace_back(baseline / entry.path().filename(), entry.path());
+        }
+
+        std::sort(results.begin(), results.end());
+    }
+    else if(std::filesystem::is_directory(baseline))
+        results.emplace_back(baseline / current.filename(), current);
+    else
+        results.emplace_back(baseline, current);
+
+    if(results.empty())
+        throw std::invalid_argument(boost::str(boost::format("No '.json' files were found in '%1%'") % current.string()));
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Entry Point
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    try {
+        Benchmarks::Arguments               args(argc, argv);
+
+        if(args.Has("help")) {
+            Usage();
+            return 0;
+        }
+
+        std::filesystem::path const         baseline(args.GetValue<std::string>("baseline", std::string()));
+        std::filesystem::path const         current(args.GetValue<std::string>("current", std::string()));
+        double const                        threshold(args.GetValue<double>("threshold", 0.05));
+        double const                        confidence(args.GetValue<double>("confidence", 0.95));
+        size_t const                        numResamples(args.GetValue<size_t>("resamples", 2000));
+        std::vector<std::string> const      metrics(args.GetValues<std::string>("metrics", {}));
+        bool const                          allowMissing(args.Has("allow-missing"));
+        bool const                          update(args.Has("update"));
+
+        args.EnsureAllUsed();
+
+        if(baseline.empty() || current.empty())
+            throw std::invalid_argument("'--baseline' and '--current' must be provided");
+
+        if(threshold < 0.0 || confidence <= 0.0 || confidence >= 1.0 || numResamples == 0)
+            throw std::invalid_argument("Invalid '--threshold', '--confidence', or '--resamples' value");
+
+        std::vector<std::tuple<std::filesystem::path, std::filesystem::path>> const    filenames(GetFilenames(baseline, current));
+
+        if(update) {
+            for(auto const &filenamePair : filenames) {
+                std::filesystem::path const &               baselineFilename(std::get<0>(filenamePair));
+                std::filesystem::path const &               currentFilename(std::get<1>(filenamePair));
+
+                // Validate the content before it becomes a baseline
+                ReadReport(currentFilename);
+
+                if(baselineFilename.has_parent_path())
+                    std::filesystem::create_directories(baselineFilename.parent_path());
+
+                std::filesystem::copy_file(currentFilename, baselineFilename, std::filesystem::copy_options::overwrite_existing);
+                std::cout << "Updated '" << baselineFilename.string() << "'\n";
+            }
+
+            return 0;
+        }
+
+        std::set<std::string> const         metricNames(metrics.begin(), metrics.end());
+        size_t                              numRegressions(0);
+        size_t                              numMissing(0);
+
+        std::cout << boost::format("%-60s %-30s %14s %14s %24s  %s\n") % "Result" % "Metric" % "Baseline" % "Current" % "Ratio CI" % "Status";
+
+        for(auto const &filenamePair : filenames) {
+            if(std::filesystem::exists(std::get<0>(filenamePair)) == false) {
+                std::cout << "No baseline for '" << std::get<1>(filenamePair).string() << "'\n";
+                ++numMissing;
+                continue;
+            }
+
+            for(Comparison const &comparison : Compare(ReadReport(std::get<0>(filenamePair)), ReadReport(std::get<1>(filenamePair)), metricNames, threshold, confidence, numResamples)) {
+                if(comparison.Status == Comparison::StatusValue::Regressed)
+                    ++numRegressions;
+                else if(comparison.Status == Comparison::StatusValue::Missing)
+                    ++numMissing;
+
+                std::cout
+                    << boost::format("%-60s %-30s %14.6g %14.6g %24s  %s\n")
+                        % (comparison.Key.Benchmark + ": " + comparison.Key.Result)
+                        % comparison.Key.Metric
+                        % comparison.BaselineMedian
+                        % comparison.CurrentMedian
+                        % boost::str(boost::format("[%.4f, %.4f]") % comparison.RatioLow % comparison.RatioHigh)
+                        % ToString(comparison.Status);
+            }
+        }
+
+        std::cout << "\n" << numRegressions << " regression(s), " << numMissing << " missing\n";
+
+        if(numMissing && allowMissing == false)
+            std::cout << "Missing metrics and baselines are errors; use '--allow-missing' to ignore them\n";
+
+        return numRegressions || (numMissing && allowMissing == false) ? 1 : 0;
+    }
+    catch(std::exception const &ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n\n";
+        Usage();
+        return -1;
+    }
+}
@@ -0,0 +1,463 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          Components_Benchmark.cpp
+///  \brief         Microbenchmarks for the innermost loops of the engine
+///                 (Score::Compare, Index::Compare, EngineImpl::Sorter, and
+///                 EngineImpl::Merge)
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:45:27
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "AllocationHooks.h"
+#include "BenchmarkHelpers.h"
+
+#include "../CompactArchive.h"
+#include "../EngineImpl.h"
+#include "../System.h"
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace Benchmarks                        = DecisionEngine::Core::Components::Benchmarks;
+namespace Components                        = DecisionEngine::Core::Components;
+namespace EngineImpl                        = DecisionEngine::Core::Components::EngineImpl;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+class BenchmarkSystem : public Components::System {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    BenchmarkSystem(Components::Score score, Components::Index index) :
+        Components::System(TypeValue::Working, CompletionValue::Concrete, std::move(score), std::move(index))
+    {}
+
+    ~BenchmarkSystem(void) override = default;
+
+    NON_COPYABLE(BenchmarkSystem);
+    MOVE(BenchmarkSystem, BASES(Components::System));
+    COMPARE(BenchmarkSystem, BASES(Components::System));
+    SERIALIZATION(BenchmarkSystem, BASES(Components::System), FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+    std::string ToString(void) const override { return "BenchmarkSystem"; }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(BenchmarkSystem);
+
+void RegisterBenchmarkSystem(void) {
+    Components::RegisterCompactSystem<BenchmarkSystem>(
+        "BenchmarkSystem",
+        [](Components::CompactOutputArchive &archive, BenchmarkSystem const &system) {
+            archive.Write(system.GetScore());
+            archive.Write(system.GetIndex());
+        },
+        [](Components::CompactInputArchive &archive) {
+            Components::Score               score(archive.ReadScore());
+            Components::Index               index(archive.ReadIndex());
+
+            return std::make_shared<BenchmarkSystem>(std::move(score), std::move(index));
+        }
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Population
+///  \brief         Systems organized into families of siblings that share a
+///                 parent, which is how the engine generates them. Siblings
+///                 share Score and Index data with their parent and differ
+///                 only in the final result and index value.
+///
+struct Population {
+    EngineImpl::SystemPtrs                  Systems;                        /// In random order
+};
+
+Population CreatePopulation(
+    std::mt19937_64 &generator,
+    size_t numSystems,
+    size_t depth,
+    size_t numGroups,
+    size_t numDistinctRatios,
+    size_t numSiblings
+) {
+    static Components::Condition::Result::ConditionPtr const                pCondition(Components::Condition::Create("Benchmark Condition", static_cast<unsigned short>(100)));
+
+    size_t const                            groupSize((depth + numGroups - 1) / numGroups);
+    std::uniform_int_distribution<size_t>   ratioDistribution(1, numDistinctRatios);
+    std::uniform_int_distribution<Components::Index::value_type>            indexDistribution(0, 1000);
+
+    auto const                              createRatio(
+        [&generator, &ratioDistribution, numDistinctRatios](void) {
+            return static_cast<float>(ratioDistribution(generator)) / static_cast<float>(numDistinctRatios);
+        }
+    );
+
+    Population                              result;
+
+    while(result.Systems.size() < numSystems) {
+        // Create the parent
+        std::unique_ptr<Components::Score>  pParentScore(std::make_unique<Components::Score>());
+        std::unique_ptr<Components::Index>  pParentIndex(std::make_unique<Components::Index>());
+
+        for(size_t step = 0; step + 1 < depth; ++step) {
+            bool const                      completesGroup((step + 1) % groupSize == 0);
+
+            pParentScore = std::make_unique<Components::Score>(Components::Score(*pParentScore, Components::Condition::Result(pCondition, createRatio()), completesGroup).Commit());
+            pParentIndex = std::make_unique<Components::Index>(Components::Index(*pParentIndex, indexDistribution(generator)).Commit());
+        }
+
+        // Create the siblings
+        for(size_t sibling = 0; sibling < numSiblings && result.Systems.size() < numSystems; ++sibling) {
+            result.Systems.emplace_back(
+                std::make_shared<BenchmarkSystem>(
+                    Components::Score(*pParentScore, Components::Condition::Result(pCondition, createRatio()), true).Commit(),
+                    Components::Index(*pParentIndex, static_cast<Components::Index::value_type>(sibling)).Commit()
+                )
+            );
+        }
+    }
+
+    std::shuffle(result.Systems.begin(), result.Systems.end(), generator);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Measurement
+///  \brief         Time and allocations for a block of code.
+///
+struct Measurement {
+    double                                  Seconds;
+    Benchmarks::AllocationCounts            Allocations;
+};
+
+template <typename FuncT>
+Measurement Measure(FuncT const &func) {
+    Benchmarks::AllocationCounts const      allocationsStart(Benchmarks::GetAllocationCounts());
+    std::chrono::steady_clock::time_point const         start(std::chrono::steady_clock::now());
+
+    func();
+
+    std::chrono::steady_clock::time_point const         end(std::chrono::steady_clock::now());
+
+    return Measurement{ Benchmarks::ToSeconds(end - start), Benchmarks::GetAllocationCounts() - allocationsStart };
+}
+
+// Prevents the compiler from removing comparisons whose results are otherwise unused
+volatile int                                g_sink;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+void Usage(void) {
+    std::cerr
+        << "Times Score::Compare, Index::Compare, EngineImpl::Sorter, EngineImpl::Merge, and\n"
+        << "serialization (boost binary archive vs. CompactArchive) in isolation and writes\n"
+        << "the results as JSON.\n"
+        << "\n"
+        << "Values may be comma-delimited to define a parameter sweep.\n"
+        << "\n"
+        << "    --systems=<n>                   Number of systems in the population [10000]\n"
+        << "    --depth=<n>                     Number of results in each Score and values in each Index [16]\n"
+        << "    --groups=<n>                    Number of result groups in each Score [4]\n"
+        << "    --distinct-ratios=<n>           Number of distinct condition ratios; smaller values create more ties [100]\n"
+        << "    --siblings=<n>                  Number of systems that share a parent [10]\n"
+        << "    --ways=<n>                      Number of sorted lists provided to Merge [8]\n"
+        << "\n"
+        << "    --compares=<n>                  Number of compare operations per repetition [1000000]\n"
+        << "    --repetitions=<n>               Number of times to run each configuration [5]\n"
+        << "    --seed=<n>                      Seed used to create the population [1]\n"
+        << "    --output=<filename>             Write JSON to a file rather than stdout\n"
+        << "\n";
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Entry Point
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    try {
+        Benchmarks::Arguments               args(argc, argv);
+
+        if(args.Has("help")) {
+            Usage();
+            return 0;
+        }
+
+        std::vector<std::vector<size_t>> const          sweep{
+            args.GetValues<size_t>("systems", { 10000 }),
+            args.GetValues<size_t>("depth", { 16 }),
+            args.GetValues<size_t>("groups", { 4 }),
+            args.GetValues<size_t>("distinct-ratios", { 100 }),
+            args.GetValues<size_t>("siblings", { 10 }),
+            args.GetValues<size_t>("ways", { 8 })
+        };
+
+        size_t const                        numCompares(args.GetValue<size_t>("compares", 1000000));
+        size_t const                        repetitions(args.GetValue<size_t>("repetitions", 5));
+        std::uint64_t const                 seed(args.GetValue<std::uint64_t>("seed", 1));
+        std::string const                   output(args.GetValue<std::string>("output", std::string()));
+
+        args.EnsureAllUsed();
+
+        if(repetitions == 0 || numCompares == 0)
+            throw std::invalid_argument("'--repetitions' and '--compares' must be greater than 0");
+
+        if(Benchmarks::AreAllocationsCounted() == false)
+            throw std::logic_error("Allocations are not being counted");
+
+        RegisterBenchmarkSystem();
+
+        Benchmarks::Report                  report("Components");
+
+        Benchmarks::ForEachCombination(
+            sweep,
+            [&](std::vector<size_t> const &values) {
+                size_t const                numSystems(values[0]);
+                size_t const                depth(values[1]);
+                size_t const                numGroups(values[2]);
+                size_t const                numDistinctRatios(values[3]);
+                size_t const                numSiblings(values[4]);
+                size_t const                numWays(values[5]);
+
+                if(numSystems < 2 || depth == 0 || numGroups == 0 || numDistinctRatios == 0 || numSiblings == 0 || numWays == 0)
+                    throw std::invalid_argument("'--systems' must be greater than 1 and all other parameters must be greater than 0");
+
+                std::mt19937_64             generator(seed);
+                Population const            population(CreatePopulation(generator, numSystems, depth, std::min(numGroups, depth), numDistinctRatios, numSiblings));
+
+                Benchmarks::Metric          scoreCompare{ "score_compare", "ns/op", false, {} };
+                Benchmarks::Metric          scoreCompareAllocations{ "score_compare_allocations", "allocations/op", false, {} };
+                Benchmarks::Metric          indexCompare{ "index_compare", "ns/op", false, {} };
+                Benchmarks::Metric          indexCompareAllocations{ "index_compare_allocations", "allocations/op", false, {} };
+                Benchmarks::Metric          sort{ "sort", "s", false, {} };
+                Benchmarks::Metric          sortAllocations{ "sort_allocations", "allocations", false, {} };
+                Benchmarks::Metric          merge{ "merge", "s", false, {} };
+                Benchmarks::Metric          mergeAllocations{ "merge_allocations", "allocations", false, {} };
+                Benchmarks::Metric          mergeAllocatedBytes{ "merge_allocated_bytes", "bytes", false, {} };
+                Benchmarks::Metric          boostWrite{ "boost_write", "s", false, {} };
+                Benchmarks::Metric          boostRead{ "boost_read", "s", false, {} };
+                Benchmarks::Metric          boostBytes{ "boost_bytes", "bytes", false, {} };
+                Benchmarks::Metric          compactWrite{ "compact_write", "s", false, {} };
+                Benchmarks::Metric          compactRead{ "compact_read", "s", false, {} };
+                Benchmarks::Metric          compactBytes{ "compact_bytes", "bytes", false, {} };
+
+                for(size_t repetition = 0; repetition < repetitions; ++repetition) {
+                    // Score::Compare and Index::Compare; adjacent systems are
+                    // compared so that memory access patterns are similar to
+                    // those encountered when sorting.
+                    Measurement const       scoreMeasurement(
+                        Measure(
+                            [&population, numCompares](void) {
+                                size_t const        numSystems(population.Systems.size());
+                                int                 result(0);
+
+                                for(size_t index = 0; index < numCompares; ++index)
+                                    result += Components::Score::Compare(population.Systems[index % numSystems]->GetScore(), population.Systems[(index + 1) % numSystems]->GetScore());
+
+                                g_sink = result;
+                            }
+                        )
+                    );
+
+                    scoreCompare.Values.emplace_back(scoreMeasurement.Seconds * 1e9 / static_cast<double>(numCompares));
+                    scoreCompareAllocations.Values.emplace_back(static_cast<double>(scoreMeasurement.Allocations.NumAllocations) / static_cast<double>(numCompares));
+
+                    Measurement const       indexMeasurement(
+                        Measure(
+                            [&population, numCompares](void) {
+                                size_t const        numSystems(population.Systems.size());
+                                int                 result(0);
+
+                                for(size_t index = 0; index < numCompares; ++index)
+                                    result += Components::Index::Compare(population.Systems[index % numSystems]->GetIndex(), population.Systems[(index + 1) % numSystems]->GetIndex());
+
+                                g_sink = result;
+                            }
+                        )
+                    );
+
+                    indexCompare.Values.emplace_back(indexMeasurement.Seconds * 1e9 / static_cast<double>(numCompares));
+                    indexCompareAllocations.Values.emplace_back(static_cast<double>(indexMeasurement.Allocations.NumAllocations) / static_cast<double>(numCompares));
+
+                    // Sorter
+                    EngineImpl::SystemPtrs  toSort(population.Systems);
+
+                    Measurement const       sortMeasurement(
+                        Measure(
+                            [&toSort](void) {
+                                std::sort(toSort.begin(), toSort.end(), EngineImpl::Sorter);
+                            }
+                        )
+                    );
+
+                    sort.Values.emplace_back(sortMeasurement.Seconds);
+                    sortAllocations.Values.emplace_back(static_cast<double>(sortMeasurement.Allocations.NumAllocations));
+
+                    // Merge
+                    EngineImpl::SystemPtrsContainer                 toMerge(std::min(numWays, numSystems));
+
+                    for(size_t index = 0; index < population.Systems.size(); ++index)
+                        toMerge[index % toMerge.size()].emplace_back(population.Systems[index]);
+
+                    for(auto &systems : toMerge)
+                        std::sort(systems.begin(), systems.end(), EngineImpl::Sorter);
+
+                    Measurement const       mergeMeasurement(
+                        Measure(
+                            [&toMerge, numSystems](void) {
+                                std::tuple<EngineImpl::SystemPtrs, EngineImpl::SystemPtrsContainer>     result(EngineImpl::Merge(numSystems, std::move(toMerge)));
+
+                                if(std::get<0>(result).size() != numSystems)
+                                    throw std::logic_error("Unexpected merge result");
+                            }
+                        )
+                    );
+
+                    merge.Values.emplace_back(mergeMeasurement.Seconds);
+                    mergeAllocations.Values.emplace_back(static_cast<double>(mergeMeasurement.Allocations.NumAllocations));
+                    mergeAllocatedBytes.Values.emplace_back(static_cast<double>(mergeMeasurement.Allocations.NumBytes));
+
+                    // Serialization (boost binary archive)
+                    std::string             boostData;
+
+                    Measurement const       boostWriteMeasurement(
+                        Measure(
+                            [&population, &boostData](void) {
+                                std::ostringstream  stream;
+
+                                {
+                                    boost::archive::binary_oarchive             archive(stream);
+
+                                    archive << population.Systems;
+                                }
+
+                                boostData = stream.str();
+                            }
+                        )
+                    );
+
+                    Measurement const       boostReadMeasurement(
+                        Measure(
+                            [&boostData, numSystems](void) {
+                                std::istringstream  stream(boostData);
+                                boost::archive::binary_iarchive                 archive(stream);
+                                EngineImpl::SystemPtrs                          systems;
+
+                                archive >> systems;
+
+                                if(systems.size() != numSystems)
+                                    throw std::logic_error("Unexpected boost archive result");
+                            }
+                        )
+                    );
+
+                    boostWrite.Values.emplace_back(boostWriteMeasurement.Seconds);
+                    boostRead.Values.emplace_back(boostReadMeasurement.Seconds);
+                    boostBytes.Values.emplace_back(static_cast<double>(boostData.size()));
+
+                    // Serialization (CompactArchive)
+                    std::string             compactData;
+
+                    Measurement const       compactWriteMeasurement(
+                        Measure(
+                            [&population, &compactData](void) {
+                                std::ostringstream  stream;
+
+                                {
+                                    Components::CompactOutputArchive            archive(stream);
+
+                                    archive.WriteVarint(population.Systems.size());
+
+                                    for(auto const &pSystem : population.Systems)
+                                        archive.Write(pSystem);
+
+                                    archive.Flush();
+                                }
+
+                                compactData = stream.str();
+                            }
+                        )
+                    );
+
+                    Measurement const       compactReadMeasurement(
+                        Measure(
+                            [&compactData, numSystems](void) {
+                                std::istringstream  stream(compactData);
+                                Components::CompactInputArchive             archive(stream);
+                                EngineImpl::SystemPtrs                      systems;
+                                std::uint64_t const numToRead(archive.ReadVarint());
+
+                                while(systems.size() < numToRead)
+                                    systems.emplace_back(archive.ReadSystem());
+
+                                if(systems.size() != numSystems)
+                                    throw std::logic_error("Unexpected compact archive result");
+                            }
+                        )
+                    );
+
+                    compactWrite.Values.emplace_back(compactWriteMeasurement.Seconds);
+                    compactRead.Values.emplace_back(compactReadMeasurement.Seconds);
+                    compactBytes.Values.emplace_back(static_cast<double>(compactData.size()));
+                }
+
+                report.Add(
+                    Benchmarks::Parameters{
+                        { "systems", std::to_string(numSystems) },
+                        { "depth", std::to_string(depth) },
+                        { "groups", std::to_string(numGroups) },
+                        { "distinct_ratios", std::to_string(numDistinctRatios) },
+                        { "siblings", std::to_string(numSiblings) },
+                        { "ways", std::to_string(numWays) }
+                    },
+                    Benchmarks::Metrics{
+                        std::move(scoreCompare),
+                        std::move(scoreCompareAllocations),
+                        std::move(indexCompare),
+                        std::move(indexCompareAllocations),
+                        std::move(sort),
+                        std::move(sortAllocations),
+                        std::move(merge),
+                        std::move(mergeAllocations),
+                        std::move(mergeAllocatedBytes),
+                        std::move(boostWrite),
+                        std::move(boostRead),
+                        std::move(boostBytes),
+                        std::move(compactWrite),
+                        std::move(compactRead),
+                        std::move(compactBytes)
+                    }
+                );
+            }
+        );
+
+        report.Write(output);
+        return 0;
+    }
+    catch(std::exception const &ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n\n";
+        Usage();
+        return -1;
+    }
+}
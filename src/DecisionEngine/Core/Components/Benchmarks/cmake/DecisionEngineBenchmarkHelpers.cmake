@@ -0,0 +1,38 @@
+cmake_minimum_required(VERSION 3.5.0)
+
+set(CMAKE_MODULE_PATH "$ENV{DEVELOPMENT_ENVIRONMENT_CMAKE_MODULE_PATH}")
+
+if(NOT WIN32)
+    string(REPLACE ":" ";" CMAKE_MODULE_PATH "${CMAKE_MODULE_PATH}")
+endif()
+
+include(BuildHelpers)
+
+function(Impl)
+    include(BoostHelpers)
+    include(CommonHelpers)
+
+    get_filename_component(_this_path ${CMAKE_CURRENT_LIST_FILE} DIRECTORY)
+
+    build_library(
+        NAME
+            DecisionEngineBenchmarkHelpers
+
+        FILES
+            ${_this_path}/../AllocationHooks.h
+            ${_this_path}/../BenchmarkHelpers.cpp
+            ${_this_path}/../BenchmarkHelpers.h
+
+        PRECOMPILED_HEADERS
+            ${_this_path}/../BenchmarkHelpers.h
+
+        PUBLIC_INCLUDE_DIRECTORIES
+            ${_this_path}/../../../../..
+
+        PUBLIC_LINK_LIBRARIES
+            BoostHelpers
+            CommonHelpers
+    )
+endfunction()
+
+Impl()
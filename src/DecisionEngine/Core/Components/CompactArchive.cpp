@@ -0,0 +1,680 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompactArchive.cpp
+///  \brief         See CompactArchive.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:04:45
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "CompactArchive.h"
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+using SaveSystemFunc                        = std::function<void (CompactOutputArchive &, System const &)>;
+using LoadSystemFunc                        = std::function<std::shared_ptr<System> (CompactInputArchive &)>;
+
+struct SystemRegistration {
+    std::string                             Name;
+    SaveSystemFunc                          Save;
+    LoadSystemFunc                          Load;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SystemRegistry
+///  \brief         `System` types registered via `RegisterCompactSystem`.
+///                 Registrations are never removed, so pointers returned by
+///                 the `Find` methods remain valid.
+///
+class SystemRegistry {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    static SystemRegistry & Get(void) {
+        static SystemRegistry               registry;
+
+        return registry;
+    }
+
+    void Register(std::type_index type, SystemRegistration registration) {
+        std::scoped_lock<decltype(_mutex)>  lock(_mutex); UNUSED(lock);
+
+        if(_names.find(registration.Name) != _names.end() || _types.find(type) != _types.end())
+            throw std::invalid_argument("The system type has already been registered");
+
+        SystemRegistration const &          inserted(_types.emplace(type, std::move(registration)).first->second);
+
+        _names.emplace(inserted.Name, &inserted);
+    }
+
+    SystemRegistration const * Find(std::type_index type) const {
+        std::scoped_lock<decltype(_mutex)>  lock(_mutex); UNUSED(lock);
+
+        auto const                          iter(_types.find(type));
+
+        return iter == _types.end() ? nullptr : &iter->second;
+    }
+
+    SystemRegistration const * Find(std::string const &name) const {
+        std::scoped_lock<decltype(_mutex)>  lock(_mutex); UNUSED(lock);
+
+        auto const                          iter(_names.find(name));
+
+        return iter == _names.end() ? nullptr : iter->second;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    mutable std::mutex                      _mutex;
+
+    std::unordered_map<std::type_index, SystemRegistration>                 _types;
+    std::unordered_map<std::string, SystemRegistration const *>             _names;
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Data
+// |
+// ----------------------------------------------------------------------
+char const                                  Header[] = { 'D', 'E', 'C', 'A' };
+std::uint64_t const                         Version = 1;
+
+size_t const                                BufferSize = 64 * 1024;
+
+} // anonymous namespace
+
+namespace Details {
+
+void RegisterCompactSystem(
+    std::type_index type,
+    std::string name,
+    std::function<void (CompactOutputArchive &, System const &)> saveFunc,
+    std::function<std::shared_ptr<System> (CompactInputArchive &)> loadFunc
+) {
+    ENSURE_ARGUMENT(name, name.empty() == false);
+    ENSURE_ARGUMENT(saveFunc);
+    ENSURE_ARGUMENT(loadFunc);
+
+    SystemRegistry::Get().Register(type, SystemRegistration{ std::move(name), std::move(saveFunc), std::move(loadFunc) });
+}
+
+} // namespace Details
+
+// ----------------------------------------------------------------------
+// |
+// |  CompactOutputArchive
+// |
+// ----------------------------------------------------------------------
+CompactOutputArchive::CompactOutputArchive(std::ostream &stream) :
+    _stream(stream),
+    _numFlushedBytes(0)
+{
+    _buffer.reserve(BufferSize);
+
+    WriteBytes(Header, sizeof(Header));
+    WriteVarint(Version);
+}
+
+CompactOutputArchive::~CompactOutputArchive(void) {
+    // Errors can't be reported here; call `Flush` explicitly to detect them
+    _stream.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+}
+
+void CompactOutputArchive::WriteBool(bool value) {
+    unsigned char const                     byte(value ? 1 : 0);
+
+    WriteBytes(&byte, 1);
+}
+
+void CompactOutputArchive::WriteVarint(std::uint64_t value) {
+    unsigned char                           bytes[10];
+    size_t                                  numBytes(0);
+
+    while(value >= 0x80) {
+        bytes[numBytes++] = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+
+    bytes[numBytes++] = static_cast<unsigned char>(value);
+
+    WriteBytes(bytes, numBytes);
+}
+
+void CompactOutputArchive::WriteFloat(float value) {
+    static_assert(sizeof(float) == sizeof(std::uint32_t));
+
+    std::uint32_t                           bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    unsigned char const                     bytes[] = {
+        static_cast<unsigned char>(bits),
+        static_cast<unsigned char>(bits >> 8),
+        static_cast<unsigned char>(bits >> 16),
+        static_cast<unsigned char>(bits >> 24)
+    };
+
+    WriteBytes(bytes, sizeof(bytes));
+}
+
+void CompactOutputArchive::WriteString(std::string const &value) {
+    WriteVarint(value.size());
+    WriteBytes(value.data(), value.size());
+}
+
+void CompactOutputArchive::Write(Index const &index) {
+    WriteShared(
+        index._pIndexes,
+        [](CompactOutputArchive &archive, Index::Indexes const &indexes) {
+            archive.WriteVarint(indexes.size());
+
+            for(Index::value_type value : indexes)
+                archive.WriteVarint(value);
+        }
+    );
+
+    WriteBool(static_cast<bool>(index._suffix));
+
+    if(index._suffix)
+        WriteVarint(*index._suffix);
+}
+
+void CompactOutputArchive::Write(Score const &score) {
+    auto const                              writeResult(
+        [](CompactOutputArchive &archive, Score::Result const &result) {
+            archive.Write(result);
+        }
+    );
+
+    WriteShared(
+        score._pResultGroups,
+        [&writeResult](CompactOutputArchive &archive, Score::ResultGroupPtrs const &groups) {
+            archive.WriteVarint(groups.size());
+
+            for(Score::ResultGroupPtr const &pGroup : groups) {
+                archive.WriteShared(
+                    pGroup,
+                    [&writeResult](CompactOutputArchive &groupArchive, Score::ResultGroup const &group) {
+                        groupArchive.WriteBool(group.IsSuccessful);
+                        groupArchive.WriteFloat(group.AverageScore);
+                        groupArchive.WriteVarint(group.NumResults);
+                        groupArchive.WriteVarint(group.NumFailures);
+                        groupArchive.WriteVarint(group.Results.size());
+
+                        for(Score::ResultPtr const &pResult : group.Results)
+                            groupArchive.WriteShared(pResult, writeResult);
+                    }
+                );
+            }
+        }
+    );
+
+    WriteShared(
+        score._pResults,
+        [&writeResult](CompactOutputArchive &archive, Score::ResultPtrs const &results) {
+            archive.WriteVarint(results.size());
+
+            for(Score::ResultPtr const &pResult : results)
+                archive.WriteShared(pResult, writeResult);
+        }
+    );
+
+    WriteBool(static_cast<bool>(score._suffix));
+
+    if(score._suffix) {
+        Write(score._suffix->GetResult());
+        WriteBool(score._suffix->CompletesGroup);
+    }
+}
+
+void CompactOutputArchive::Write(Score::Result const &result) {
+    auto const                              writeConditionResults(
+        [this](Score::Result::ConditionResults const &results) {
+            WriteVarint(results.size());
+
+            for(Condition::Result const &conditionResult : results)
+                Write(conditionResult);
+        }
+    );
+
+    writeConditionResults(result.ApplicabilityResults);
+    writeConditionResults(result.RequirementResults);
+    writeConditionResults(result.PreferenceResults);
+
+    WriteFloat(result.Score);
+    WriteBool(result.IsPartial);
+}
+
+void CompactOutputArchive::Write(Condition::Result const &result) {
+    // Conditions are rarely written and may be derived, so the boost binary
+    // archive is used (once per distinct `Condition`).
+    WriteShared(
+        result.Condition,
+        [&result](CompactOutputArchive &archive, Condition const &) {
+            std::ostringstream              stream;
+
+            {
+                boost::archive::binary_oarchive                 boostArchive(stream);
+
+                boostArchive << result.Condition;
+            }
+
+            archive.WriteString(stream.str());
+        }
+    );
+
+    WriteBool(result.IsSuccessful);
+    WriteFloat(result.Ratio);
+
+    WriteBool(result.Reason.empty() == false);
+
+    if(result.Reason.empty() == false)
+        WriteString(result.Reason.ToString());
+}
+
+void CompactOutputArchive::Write(SystemPtr const &pSystem) {
+    // Validate the type before anything is written so that the archive remains
+    // usable when the type hasn't been registered.
+    SystemRegistration const *              pRegistration(nullptr);
+
+    if(pSystem && _systemTypes.find(typeid(*pSystem)) == _systemTypes.end()) {
+        pRegistration = SystemRegistry::Get().Find(typeid(*pSystem));
+
+        if(pRegistration == nullptr)
+            throw std::invalid_argument("The system type has not been registered");
+    }
+
+    WriteShared(
+        pSystem,
+        [this, pRegistration](CompactOutputArchive &archive, System const &system) {
+            // 0: new type; n: reference to type n - 1
+            std::type_index const           type(typeid(system));
+            auto                            iter(_systemTypes.find(type));
+
+            if(iter == _systemTypes.end()) {
+                assert(pRegistration);
+
+                iter = _systemTypes.emplace(type, std::make_tuple(static_cast<std::uint64_t>(_systemTypes.size()), &pRegistration->Save)).first;
+
+                archive.WriteVarint(0);
+                archive.WriteString(pRegistration->Name);
+            }
+            else
+                archive.WriteVarint(std::get<0>(iter->second) + 1);
+
+            (*std::get<1>(iter->second))(archive, system);
+        }
+    );
+}
+
+void CompactOutputArchive::Flush(void) {
+    if(_buffer.empty())
+        return;
+
+    _stream.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+
+    if(!_stream)
+        throw std::runtime_error("Invalid compact archive stream");
+
+    _numFlushedBytes += _buffer.size();
+    _buffer.clear();
+}
+
+std::uint64_t CompactOutputArchive::GetNumBytes(void) const {
+    return _numFlushedBytes + _buffer.size();
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+void CompactOutputArchive::WriteBytes(void const *pData, size_t numBytes) {
+    if(_buffer.size() + numBytes > BufferSize)
+        Flush();
+
+    _buffer.append(static_cast<char const *>(pData), numBytes);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CompactInputArchive
+// |
+// ----------------------------------------------------------------------
+CompactInputArchive::CompactInputArchive(std::istream &stream) :
+    _stream(stream),
+    _buffer(BufferSize),
+    _offset(0),
+    _size(0)
+{
+    char                                    header[sizeof(Header)];
+
+    ReadBytes(header, sizeof(header));
+
+    if(std::memcmp(header, Header, sizeof(Header)) != 0 || ReadVarint() != Version)
+        throw std::runtime_error("Invalid compact archive");
+}
+
+bool CompactInputArchive::ReadBool(void) {
+    unsigned char const                     byte(ReadByte());
+
+    if(byte > 1)
+        throw std::runtime_error("Invalid compact archive");
+
+    return byte == 1;
+}
+
+std::uint64_t CompactInputArchive::ReadVarint(void) {
+    std::uint64_t                           result(0);
+
+    for(unsigned int shift = 0; shift < 64; shift += 7) {
+        unsigned char const                 byte(ReadByte());
+
+        result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+        if((byte & 0x80) == 0)
+            return result;
+    }
+
+    throw std::runtime_error("Invalid compact archive");
+}
+
+float CompactInputArchive::ReadFloat(void) {
+    unsigned char                           bytes[4];
+
+    ReadBytes(bytes, sizeof(bytes));
+
+    std::uint32_t const                     bits(
+        static_cast<std::uint32_t>(bytes[0])
+        | (static_cast<std::uint32_t>(bytes[1]) << 8)
+        | (static_cast<std::uint32_t>(bytes[2]) << 16)
+        | (static_cast<std::uint32_t>(bytes[3]) << 24)
+    );
+
+    float                                   result;
+
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+std::string CompactInputArchive::ReadString(void) {
+    std::uint64_t const                     size(ReadVarint());
+    std::string                             result;
+
+    // Read in blocks so that a corrupted size doesn't result in a huge allocation
+    while(result.size() < size) {
+        size_t const                        numBytes(static_cast<size_t>(std::min<std::uint64_t>(size - result.size(), BufferSize)));
+        size_t const                        offset(result.size());
+
+        result.resize(offset + numBytes);
+        ReadBytes(result.data() + offset, numBytes);
+    }
+
+    return result;
+}
+
+Index CompactInputArchive::ReadIndex(void) {
+    Index::IndexesPtr                       pIndexes(
+        ReadShared<Index::Indexes>(
+            [](CompactInputArchive &archive) {
+                std::uint64_t const         size(archive.ReadVarint());
+
+                if(size == 0)
+                    throw std::runtime_error("Invalid compact archive");
+
+                Index::Indexes              indexes;
+
+                while(indexes.size() < size)
+                    indexes.emplace_back(archive.ReadVarint());
+
+                return std::make_shared<Index::Indexes>(std::move(indexes));
+            }
+        )
+    );
+
+    boost::optional<Index::value_type>      suffix;
+
+    if(ReadBool())
+        suffix = ReadVarint();
+
+    if(!pIndexes)
+        return suffix ? Index(*suffix) : Index();
+
+    Index                                   result(std::move(pIndexes));
+
+    if(suffix)
+        return Index(result, *suffix);
+
+    return result;
+}
+
+Score CompactInputArchive::ReadScore(void) {
+    auto const                              readResult(
+        [](CompactInputArchive &archive) {
+            return std::make_shared<Score::Result>(archive.ReadScoreResult());
+        }
+    );
+
+    Score::ResultGroupPtrsPtr               pResultGroups(
+        ReadShared<Score::ResultGroupPtrs>(
+            [&readResult](CompactInputArchive &archive) {
+                std::uint64_t const         numGroups(archive.ReadVarint());
+                Score::ResultGroupPtrs      groups;
+
+                while(groups.size() < numGroups) {
+                    groups.emplace_back(
+                        archive.ReadShared<Score::ResultGroup>(
+                            [&readResult](CompactInputArchive &groupArchive) {
+                                bool const                      isSuccessful(groupArchive.ReadBool());
+                                float const                     averageScore(groupArchive.ReadFloat());
+                                unsigned long const             numResults(static_cast<unsigned long>(groupArchive.ReadVarint()));
+                                unsigned long const             numFailures(static_cast<unsigned long>(groupArchive.ReadVarint()));
+                                std::uint64_t const             size(groupArchive.ReadVarint());
+                                Score::ResultPtrs               results;
+
+                                while(results.size() < size) {
+                                    results.emplace_back(groupArchive.ReadShared<Score::Result>(readResult));
+
+                                    if(!results.back())
+                                        throw std::runtime_error("Invalid compact archive");
+                                }
+
+                                return std::make_shared<Score::ResultGroup>(std::move(results), isSuccessful, averageScore, numResults, numFailures);
+                            }
+                        )
+                    );
+
+                    if(!groups.back())
+                        throw std::runtime_error("Invalid compact archive");
+                }
+
+                return std::make_shared<Score::ResultGroupPtrs>(std::move(groups));
+            }
+        )
+    );
+
+    Score::ResultPtrsPtr                    pResults(
+        ReadShared<Score::ResultPtrs>(
+            [&readResult](CompactInputArchive &archive) {
+                std::uint64_t const         size(archive.ReadVarint());
+                Score::ResultPtrs           results;
+
+                while(results.size() < size) {
+                    results.emplace_back(archive.ReadShared<Score::Result>(readResult));
+
+                    if(!results.back())
+                        throw std::runtime_error("Invalid compact archive");
+                }
+
+                return std::make_shared<Score::ResultPtrs>(std::move(results));
+            }
+        )
+    );
+
+    std::unique_ptr<Score::SuffixInfo>      pSuffix;
+
+    if(ReadBool()) {
+        Score::Result                       result(ReadScoreResult());
+        bool const                          completesGroup(ReadBool());
+
+        pSuffix = std::make_unique<Score::SuffixInfo>(std::move(result), completesGroup);
+    }
+
+    return Score(std::move(pResultGroups), std::move(pResults), std::move(pSuffix));
+}
+
+Score::Result CompactInputArchive::ReadScoreResult(void) {
+    auto const                              readConditionResults(
+        [this](void) {
+            std::uint64_t const             size(ReadVarint());
+            Score::Result::ConditionResults results;
+
+            while(results.size() < size)
+                results.emplace_back(ReadConditionResult());
+
+            return results;
+        }
+    );
+
+    Score::Result::ConditionResults         applicabilityResults(readConditionResults());
+    Score::Result::ConditionResults         requirementResults(readConditionResults());
+    Score::Result::ConditionResults         preferenceResults(readConditionResults());
+
+    float const                             score(ReadFloat());
+    bool const                              isPartial(ReadBool());
+
+    Score::Result                           result(std::move(applicabilityResults), std::move(requirementResults), std::move(preferenceResults), isPartial);
+
+    result.Score = score;
+    return result;
+}
+
+Condition::Result CompactInputArchive::ReadConditionResult(void) {
+    Condition::Result::ConditionPtr         pCondition(
+        ReadShared<Condition>(
+            [](CompactInputArchive &archive) {
+                std::istringstream          stream(archive.ReadString());
+                Condition::Result::ConditionPtr             pResult;
+
+                try {
+                    boost::archive::binary_iarchive             boostArchive(stream);
+
+                    boostArchive >> pResult;
+                }
+                catch(boost::archive::archive_exception const &) {
+                    throw std::runtime_error("Invalid compact archive");
+                }
+
+                return pResult;
+            }
+        )
+    );
+
+    if(!pCondition)
+        throw std::runtime_error("Invalid compact archive");
+
+    bool const                              isSuccessful(ReadBool());
+    float const                             ratio(ReadFloat());
+    std::optional<std::string>              reason;
+
+    if(ReadBool())
+        reason = ReadString();
+
+    return Condition::Result(std::move(pCondition), isSuccessful, ratio, std::move(reason));
+}
+
+CompactInputArchive::SystemPtr CompactInputArchive::ReadSystem(void) {
+    return ReadShared<System>(
+        [](CompactInputArchive &archive) {
+            std::uint64_t const             tag(archive.ReadVarint());
+            LoadSystemFunc const *          pLoad(nullptr);
+
+            if(tag == 0) {
+                SystemRegistration const *  pRegistration(SystemRegistry::Get().Find(archive.ReadString()));
+
+                if(pRegistration == nullptr)
+                    throw std::runtime_error("Invalid compact archive (the system type has not been registered)");
+
+                pLoad = &pRegistration->Load;
+                archive._systemLoaders.emplace_back(pLoad);
+            }
+            else {
+                std::uint64_t const         index(tag - 1);
+
+                if(index >= archive._systemLoaders.size())
+                    throw std::runtime_error("Invalid compact archive");
+
+                pLoad = archive._systemLoaders[static_cast<size_t>(index)];
+            }
+
+            return (*pLoad)(archive);
+        }
+    );
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+unsigned char CompactInputArchive::ReadByte(void) {
+    if(_offset == _size) {
+        _stream.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+
+        _size = static_cast<size_t>(_stream.gcount());
+        _offset = 0;
+
+        if(_size == 0)
+            throw std::runtime_error("Invalid compact archive");
+    }
+
+    return static_cast<unsigned char>(_buffer[_offset++]);
+}
+
+void CompactInputArchive::ReadBytes(void *pData, size_t numBytes) {
+    char *                                  pDest(static_cast<char *>(pData));
+
+    while(numBytes) {
+        if(_offset == _size) {
+            *pDest++ = static_cast<char>(ReadByte());
+            --numBytes;
+            continue;
+        }
+
+        size_t const                        toCopy(std::min(numBytes, _size - _offset));
+
+        std::memcpy(pDest, _buffer.data() + _offset, toCopy);
+
+        _offset += toCopy;
+        pDest += toCopy;
+        numBytes -= toCopy;
+    }
+}
+
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
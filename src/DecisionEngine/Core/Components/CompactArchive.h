@@ -0,0 +1,358 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompactArchive.h
+///  \brief         Contains the CompactOutputArchive and CompactInputArchive objects
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:04:45
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Index.h"
+#include "Score.h"
+#include "System.h"
+
+#include <istream>
+#include <ostream>
+#include <typeindex>
+#include <unordered_map>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+
+class CompactInputArchive;
+class CompactOutputArchive;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            RegisterCompactSystem
+///  \brief         Registers functions that write and read a `System` type
+///                 with the compact archives. Writing a `System` whose type
+///                 has not been registered throws.
+///
+///                 The save function is responsible for writing all of the
+///                 information required to recreate the `System` (including
+///                 its `Score` and `Index`), and the load function reads that
+///                 information in the same order. Types should be registered
+///                 before any archive is created.
+///
+template <typename SystemT, typename SaveFuncT, typename LoadFuncT>
+// void (CompactOutputArchive &, SystemT const &);
+// std::shared_ptr<SystemT> (CompactInputArchive &);
+void RegisterCompactSystem(std::string name, SaveFuncT saveFunc, LoadFuncT loadFunc);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CompactOutputArchive
+///  \brief         Writes `System`, `Score`, `Index`, and `Condition::Result`
+///                 graphs in a compact binary format.
+///
+///                 Objects held by `std::shared_ptr` are written once and
+///                 referenced by identity afterwards, so prefixes shared by
+///                 sibling `Scores` and `Indexes` (and any other state written
+///                 via `WriteShared`) are only written once per archive.
+///                 Integers are varint encoded and floats are written as
+///                 little-endian IEEE 754 values, so archives are portable
+///                 across platforms.
+///
+///                 Data is buffered and written to the stream in blocks; call
+///                 `Flush` (or destroy the archive) to write any remaining data.
+///
+class CompactOutputArchive {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SystemPtr                         = std::shared_ptr<System>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    CompactOutputArchive(std::ostream &stream);
+    ~CompactOutputArchive(void);
+
+    NON_COPYABLE(CompactOutputArchive);
+    NON_MOVABLE(CompactOutputArchive);
+
+    void WriteBool(bool value);
+    void WriteVarint(std::uint64_t value);
+    void WriteFloat(float value);
+    void WriteString(std::string const &value);
+
+    void Write(Index const &index);
+    void Write(Score const &score);
+    void Write(Score::Result const &result);
+    void Write(Condition::Result const &result);
+
+    // Systems are written by identity; the System's type must have been
+    // registered via `RegisterCompactSystem`.
+    void Write(SystemPtr const &pSystem);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            WriteShared
+    ///  \brief         Writes the object via `func` the first time it is
+    ///                 encountered and a reference to that object every time
+    ///                 after that. Null pointers are supported.
+    ///
+    template <typename T, typename FuncT>
+    // void (CompactOutputArchive &, T const &);
+    void WriteShared(std::shared_ptr<T> const &ptr, FuncT const &func);
+
+    /// Writes all buffered data to the stream.
+    void Flush(void);
+
+    /// Returns the number of bytes written (including those that are buffered).
+    std::uint64_t GetNumBytes(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using SaveSystemFunc                    = std::function<void (CompactOutputArchive &, System const &)>;
+
+    struct ObjectKey {
+        void const *                        Ptr;
+        std::type_index                     Type;
+
+        bool operator==(ObjectKey const &other) const { return Ptr == other.Ptr && Type == other.Type; }
+    };
+
+    struct ObjectKeyHash {
+        size_t operator()(ObjectKey const &key) const { return std::hash<void const *>()(key.Ptr) ^ (key.Type.hash_code() * 31); }
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::ostream &                          _stream;
+    std::string                             _buffer;
+    std::uint64_t                           _numFlushedBytes;
+
+    // Objects are kept alive so that their addresses aren't reused while the
+    // archive exists.
+    std::vector<std::shared_ptr<void const>>                                _objects;
+    std::unordered_map<ObjectKey, std::uint64_t, ObjectKeyHash>             _objectIds;
+
+    // Registered system types that have been written, along with the id
+    // used to reference them.
+    std::unordered_map<std::type_index, std::tuple<std::uint64_t, SaveSystemFunc const *>>    _systemTypes;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void WriteBytes(void const *pData, size_t numBytes);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CompactInputArchive
+///  \brief         Reads data written by `CompactOutputArchive`. Values must
+///                 be read in the order in which they were written.
+///
+///                 Data is read from the stream in blocks, so the archive may
+///                 read past the end of the data written by the corresponding
+///                 `CompactOutputArchive`; it should be the only reader of the
+///                 stream.
+///
+class CompactInputArchive {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SystemPtr                         = std::shared_ptr<System>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    CompactInputArchive(std::istream &stream);
+    ~CompactInputArchive(void) = default;
+
+    NON_COPYABLE(CompactInputArchive);
+    NON_MOVABLE(CompactInputArchive);
+
+    bool ReadBool(void);
+    std::uint64_t ReadVarint(void);
+    float ReadFloat(void);
+    std::string ReadString(void);
+
+    Index ReadIndex(void);
+    Score ReadScore(void);
+    Score::Result ReadScoreResult(void);
+    Condition::Result ReadConditionResult(void);
+
+    SystemPtr ReadSystem(void);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            ReadShared
+    ///  \brief         Reads an object written by `WriteShared`, invoking `func`
+    ///                 only when the object hasn't been encountered before.
+    ///
+    template <typename T, typename FuncT>
+    // std::shared_ptr<T> (CompactInputArchive &);
+    std::shared_ptr<T> ReadShared(FuncT const &func);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using LoadSystemFunc                    = std::function<SystemPtr (CompactInputArchive &)>;
+
+    struct Object {
+        std::shared_ptr<void>               Ptr;
+        std::type_index                     Type;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::istream &                          _stream;
+    std::vector<char>                       _buffer;
+    size_t                                  _offset;
+    size_t                                  _size;
+
+    std::vector<Object>                     _objects;
+    std::vector<LoadSystemFunc const *>     _systemLoaders;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    unsigned char ReadByte(void);
+    void ReadBytes(void *pData, size_t numBytes);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+void RegisterCompactSystem(
+    std::type_index type,
+    std::string name,
+    std::function<void (CompactOutputArchive &, System const &)> saveFunc,
+    std::function<std::shared_ptr<System> (CompactInputArchive &)> loadFunc
+);
+
+} // namespace Details
+
+template <typename SystemT, typename SaveFuncT, typename LoadFuncT>
+// void (CompactOutputArchive &, SystemT const &);
+// std::shared_ptr<SystemT> (CompactInputArchive &);
+void RegisterCompactSystem(std::string name, SaveFuncT saveFunc, LoadFuncT loadFunc) {
+    static_assert(std::is_base_of_v<System, SystemT>);
+
+    Details::RegisterCompactSystem(
+        typeid(SystemT),
+        std::move(name),
+        [saveFunc=std::move(saveFunc)](CompactOutputArchive &archive, System const &system) {
+            saveFunc(archive, static_cast<SystemT const &>(system));
+        },
+        [loadFunc=std::move(loadFunc)](CompactInputArchive &archive) -> std::shared_ptr<System> {
+            return loadFunc(archive);
+        }
+    );
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CompactOutputArchive
+// |
+// ----------------------------------------------------------------------
+template <typename T, typename FuncT>
+// void (CompactOutputArchive &, T const &);
+void CompactOutputArchive::WriteShared(std::shared_ptr<T> const &ptr, FuncT const &func) {
+    // 0: null; 1: new object; n: reference to object n - 2
+    if(!ptr) {
+        WriteVarint(0);
+        return;
+    }
+
+    auto const                              result(_objectIds.emplace(ObjectKey{ ptr.get(), typeid(T) }, _objects.size()));
+
+    if(result.second == false) {
+        WriteVarint(result.first->second + 2);
+        return;
+    }
+
+    _objects.emplace_back(ptr);
+
+    WriteVarint(1);
+    func(*this, static_cast<T const &>(*ptr));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CompactInputArchive
+// |
+// ----------------------------------------------------------------------
+template <typename T, typename FuncT>
+// std::shared_ptr<T> (CompactInputArchive &);
+std::shared_ptr<T> CompactInputArchive::ReadShared(FuncT const &func) {
+    std::uint64_t const                     tag(ReadVarint());
+
+    if(tag == 0)
+        return std::shared_ptr<T>();
+
+    if(tag == 1) {
+        // The id is reserved before `func` is invoked to match the order used
+        // by `CompactOutputArchive` when writing nested objects.
+        size_t const                        index(_objects.size());
+
+        _objects.emplace_back(Object{ std::shared_ptr<void>(), typeid(T) });
+
+        std::shared_ptr<T>                  result(func(*this));
+
+        if(!result)
+            throw std::runtime_error("Invalid compact archive");
+
+        _objects[index].Ptr = std::const_pointer_cast<std::remove_const_t<T>>(result);
+        return result;
+    }
+
+    std::uint64_t const                     index(tag - 2);
+
+    if(index >= _objects.size() || _objects[static_cast<size_t>(index)].Type != typeid(T) || !_objects[static_cast<size_t>(index)].Ptr)
+        throw std::runtime_error("Invalid compact archive");
+
+    return std::static_pointer_cast<T>(_objects[static_cast<size_t>(index)].Ptr);
+}
+
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
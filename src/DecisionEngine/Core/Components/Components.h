@@ -47,6 +47,7 @@
 
 #include <boost/serialization/deque.hpp>
 #include <boost/serialization/optional.hpp>
+#include <boost/serialization/split_member.hpp>
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/variant.hpp>
 #include <boost/serialization/vector.hpp>
@@ -61,6 +62,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <variant>
 #include <vector>
 
 // This file must be included after all of the serialization helpers
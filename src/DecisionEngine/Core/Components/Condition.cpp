@@ -25,6 +25,107 @@ namespace DecisionEngine {
 namespace Core {
 namespace Components {
 
+// ----------------------------------------------------------------------
+// |
+// |  Condition::Result::LazyReason
+// |
+// ----------------------------------------------------------------------
+Condition::Result::LazyReason::LazyReason(std::string reason) :
+    _value(
+        std::move(
+            [&reason](void) -> std::string & {
+                ENSURE_ARGUMENT(reason, reason.empty() == false);
+                return reason;
+            }()
+        )
+    )
+{}
+
+Condition::Result::LazyReason::LazyReason(Functor func) :
+    _value(
+        std::move(
+            [&func](void) -> Functor & {
+                ENSURE_ARGUMENT(func);
+                return func;
+            }()
+        )
+    )
+{}
+
+// static
+int Condition::Result::LazyReason::Compare(LazyReason const &a, LazyReason const &b) {
+    if(static_cast<void const *>(&a) == static_cast<void const *>(&b))
+        return 0;
+
+    // Functors never produce empty reasons
+    if(a.empty() || b.empty())
+        return static_cast<int>(b.empty()) - static_cast<int>(a.empty());
+
+    std::string const * const               pA(std::get_if<std::string>(&a._value));
+    std::string const * const               pB(std::get_if<std::string>(&b._value));
+
+    if(pA && pB)
+        return pA->compare(*pB);
+
+    return a.ToString().compare(b.ToString());
+}
+
+bool Condition::Result::LazyReason::operator==(LazyReason const &other) const {
+    return Compare(*this, other) == 0;
+}
+
+bool Condition::Result::LazyReason::operator!=(LazyReason const &other) const {
+    return Compare(*this, other) != 0;
+}
+
+bool Condition::Result::LazyReason::operator <(LazyReason const &other) const {
+    return Compare(*this, other) < 0;
+}
+
+bool Condition::Result::LazyReason::operator<=(LazyReason const &other) const {
+    return Compare(*this, other) <= 0;
+}
+
+bool Condition::Result::LazyReason::operator >(LazyReason const &other) const {
+    return Compare(*this, other) > 0;
+}
+
+bool Condition::Result::LazyReason::operator>=(LazyReason const &other) const {
+    return Compare(*this, other) >= 0;
+}
+
+bool Condition::Result::LazyReason::operator==(std::string const &other) const {
+    return ToString() == other;
+}
+
+bool Condition::Result::LazyReason::operator!=(std::string const &other) const {
+    return ToString() != other;
+}
+
+bool Condition::Result::LazyReason::empty(void) const {
+    return std::holds_alternative<std::monostate>(_value);
+}
+
+bool Condition::Result::LazyReason::IsLazy(void) const {
+    return std::holds_alternative<Functor>(_value);
+}
+
+std::string Condition::Result::LazyReason::ToString(void) const {
+    if(std::string const * const pValue = std::get_if<std::string>(&_value))
+        return *pValue;
+
+    if(Functor const * const pFunc = std::get_if<Functor>(&_value)) {
+        std::string                         result((*pFunc)());
+
+        if(result.empty())
+            throw std::runtime_error("Invalid reason");
+
+        return result;
+    }
+
+    return std::string();
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Condition::Result
@@ -39,6 +140,40 @@ Condition::Result::Result(ConditionPtr pCondition, float ratio, std::optional<st
 {}
 
 Condition::Result::Result(ConditionPtr pCondition, bool isSuccessful, float ratio, std::optional<std::string> reason /*=std::nullopt*/) :
+    Result(
+        std::move(pCondition),
+        std::move(isSuccessful),
+        std::move(ratio),
+        [&reason](void) -> LazyReason {
+            if(reason)
+                return LazyReason(std::move(*reason));
+
+            return LazyReason();
+        }()
+    )
+{}
+
+Condition::Result::Result(ConditionPtr pCondition, bool isSuccessful, LazyReason::Functor reasonFunc) :
+    Result(std::move(pCondition), std::move(isSuccessful), isSuccessful ? 1.0f : 0.0f, std::move(reasonFunc))
+{}
+
+Condition::Result::Result(ConditionPtr pCondition, float ratio, LazyReason::Functor reasonFunc) :
+    Result(std::move(pCondition), ratio > 0.0f, std::move(ratio), std::move(reasonFunc))
+{}
+
+Condition::Result::Result(ConditionPtr pCondition, bool isSuccessful, float ratio, LazyReason::Functor reasonFunc) :
+    Result(
+        std::move(pCondition),
+        std::move(isSuccessful),
+        std::move(ratio),
+        [&reasonFunc](void) -> LazyReason {
+            ENSURE_ARGUMENT(reasonFunc);
+            return LazyReason(std::move(reasonFunc));
+        }()
+    )
+{}
+
+Condition::Result::Result(ConditionPtr pCondition, bool isSuccessful, float ratio, LazyReason reason) :
     Condition(
         std::move(
             [&pCondition](void) -> ConditionPtr & {
@@ -56,18 +191,54 @@ Condition::Result::Result(ConditionPtr pCondition, bool isSuccessful, float rati
             }()
         )
     ),
-    Reason(
-        [&reason](void) -> std::string {
-            if(reason) {
-                ENSURE_ARGUMENT(reason, reason->empty() == false);
-                return std::move(*reason);
-            }
-
-            return std::string();
-        }()
-    )
+    Reason(std::move(reason))
 {}
 
+// static
+int Condition::Result::Compare(Result const &a, Result const &b) {
+    if(static_cast<void const *>(&a) == static_cast<void const *>(&b))
+        return 0;
+
+    if(a.Condition != b.Condition) {
+        int const                           result(Components::Condition::Compare(*a.Condition, *b.Condition));
+
+        if(result != 0)
+            return result;
+    }
+
+    if(a.IsSuccessful != b.IsSuccessful)
+        return a.IsSuccessful ? 1 : -1;
+
+    if(a.Ratio != b.Ratio)
+        return a.Ratio < b.Ratio ? -1 : 1;
+
+    return LazyReason::Compare(a.Reason, b.Reason);
+}
+
+bool Condition::Result::operator==(Result const &other) const {
+    return Compare(*this, other) == 0;
+}
+
+bool Condition::Result::operator!=(Result const &other) const {
+    return Compare(*this, other) != 0;
+}
+
+bool Condition::Result::operator <(Result const &other) const {
+    return Compare(*this, other) < 0;
+}
+
+bool Condition::Result::operator<=(Result const &other) const {
+    return Compare(*this, other) <= 0;
+}
+
+bool Condition::Result::operator >(Result const &other) const {
+    return Compare(*this, other) > 0;
+}
+
+bool Condition::Result::operator>=(Result const &other) const {
+    return Compare(*this, other) >= 0;
+}
+
 } // namespace Components
 } // namespace Core
 } // namespace DecisionEngine
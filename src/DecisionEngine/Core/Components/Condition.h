@@ -57,12 +57,99 @@ public:
         // |  Public Types
         using ConditionPtr                  = std::shared_ptr<Condition>;
 
+        /////////////////////////////////////////////////////////////////////////
+        ///  \class         LazyReason
+        ///  \brief         The reason associated with a `Result`, provided either
+        ///                 as a string or as a functor that creates the string.
+        ///
+        ///                 Reasons are rarely inspected during a search (they are
+        ///                 used when displaying or persisting results), so a
+        ///                 functor allows a `Condition` to defer formatting until
+        ///                 the string is actually requested via `ToString` or
+        ///                 serialization. The functor is invoked every time the
+        ///                 string is requested and must be thread safe.
+        ///
+        ///                 Any objects captured by the functor must outlive the
+        ///                 `Result`; Results may be cached or persisted long after
+        ///                 the `Request` and `Resource` used to create them have
+        ///                 been destroyed, so capture values (or shared pointers)
+        ///                 rather than references.
+        ///
+        ///                 A subset of the `std::string` interface is provided so
+        ///                 that code written against the string version of `Reason`
+        ///                 continues to work.
+        ///
+        class LazyReason {
+        public:
+            // ----------------------------------------------------------------------
+            // |  Public Types
+            using Functor                   = std::function<std::string (void)>;
+
+            // ----------------------------------------------------------------------
+            // |  Public Methods
+            LazyReason(void) = default;
+            explicit LazyReason(std::string reason);
+            explicit LazyReason(Functor func);
+
+#define ARGS                                MEMBERS(_value)
+
+            COPY(LazyReason, ARGS);
+            MOVE(LazyReason, ARGS);
+
+#undef ARGS
+
+            // Comparison is based on the materialized strings; empty reasons are
+            // compared without invoking functors.
+            static int Compare(LazyReason const &a, LazyReason const &b);
+
+            bool operator==(LazyReason const &other) const;
+            bool operator!=(LazyReason const &other) const;
+            bool operator <(LazyReason const &other) const;
+            bool operator<=(LazyReason const &other) const;
+            bool operator >(LazyReason const &other) const;
+            bool operator>=(LazyReason const &other) const;
+
+            bool operator==(std::string const &other) const;
+            bool operator!=(std::string const &other) const;
+
+            /// Returns true if a reason was not provided; the functor is not invoked.
+            bool empty(void) const;
+
+            /// Returns true if the reason will be created on demand.
+            bool IsLazy(void) const;
+
+            /// Materializes the reason (invoking the functor if necessary).
+            std::string ToString(void) const;
+
+        private:
+            // ----------------------------------------------------------------------
+            // |  Relationships
+            friend class boost::serialization::access;
+
+            // ----------------------------------------------------------------------
+            // |  Private Data
+            std::variant<std::monostate, std::string, Functor>  _value;
+
+            // ----------------------------------------------------------------------
+            // |  Private Methods
+
+            // Lazy reasons are materialized when serialized; they are always
+            // deserialized as strings.
+            template <typename ArchiveT>
+            void save(ArchiveT &ar, unsigned int const /*version*/) const;
+
+            template <typename ArchiveT>
+            void load(ArchiveT &ar, unsigned int const /*version*/);
+
+            BOOST_SERIALIZATION_SPLIT_MEMBER();
+        };
+
         // ----------------------------------------------------------------------
         // |  Public Data
         ConditionPtr const                  Condition;
         bool const                          IsSuccessful;
         float const                         Ratio;
-        std::string const                   Reason;
+        LazyReason const                    Reason;
 
         // ----------------------------------------------------------------------
         // |  Public Methods
@@ -70,14 +157,33 @@ public:
         Result(ConditionPtr pCondition, float ratio, std::optional<std::string> reason=std::nullopt);
         Result(ConditionPtr pCondition, bool isSuccessful, float ratio, std::optional<std::string> reason=std::nullopt);
 
+        // The functor is invoked only when the reason is requested; see
+        // `LazyReason` for lifetime requirements.
+        Result(ConditionPtr pCondition, bool isSuccessful, LazyReason::Functor reasonFunc);
+        Result(ConditionPtr pCondition, float ratio, LazyReason::Functor reasonFunc);
+        Result(ConditionPtr pCondition, bool isSuccessful, float ratio, LazyReason::Functor reasonFunc);
+
+        // Creates a Result from an existing reason without materializing it.
+        Result(ConditionPtr pCondition, bool isSuccessful, float ratio, LazyReason reason);
+
 #define ARGS                                MEMBERS(Condition, IsSuccessful, Ratio, Reason)
 
         NON_COPYABLE(Result);
         MOVE(Result, ARGS);
-        COMPARE(Result, ARGS);
         SERIALIZATION(Result, ARGS);
 
 #undef ARGS
+
+        // Reasons are compared last (and only when everything else is equal), as
+        // comparing lazy reasons materializes them.
+        static int Compare(Result const &a, Result const &b);
+
+        bool operator==(Result const &other) const;
+        bool operator!=(Result const &other) const;
+        bool operator <(Result const &other) const;
+        bool operator<=(Result const &other) const;
+        bool operator >(Result const &other) const;
+        bool operator>=(Result const &other) const;
     };
 
     // ----------------------------------------------------------------------
@@ -119,6 +225,25 @@ public:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+template <typename ArchiveT>
+void Condition::Result::LazyReason::save(ArchiveT &ar, unsigned int const /*version*/) const {
+    std::string const                       value(ToString());
+
+    ar << boost::serialization::make_nvp("value", value);
+}
+
+template <typename ArchiveT>
+void Condition::Result::LazyReason::load(ArchiveT &ar, unsigned int const /*version*/) {
+    std::string                             value;
+
+    ar >> boost::serialization::make_nvp("value", value);
+
+    if(value.empty())
+        _value = std::monostate();
+    else
+        _value = std::move(value);
+}
+
 template <typename PrivateConstructorTagT>
 Condition::Condition(PrivateConstructorTagT tag, std::string name, unsigned short maxScore) :
     BoostHelpers::SharedObject(tag),
@@ -35,10 +35,87 @@ namespace EngineImpl {
 
 // ----------------------------------------------------------------------
 // |
-// |  Internal Function Prototypes
+// |  Statistics
 // |
 // ----------------------------------------------------------------------
-bool Sorter(SystemPtr const &p1, SystemPtr const &p2);
+Statistics::Statistics(void) :
+    PhaseNanoseconds{},
+    PhaseCounts{},
+    NumRounds(0),
+    NumTasks(0),
+    NumIterations(0),
+    NumGeneratedSystems(0),
+    NumResultSystems(0),
+    NumFailedSystems(0),
+    NumFingerprintedSystems(0)
+{}
+
+Statistics & Statistics::operator+=(Statistics const &other) {
+    for(size_t index = 0; index < NumPhases; ++index) {
+        PhaseNanoseconds[index] += other.PhaseNanoseconds[index];
+        PhaseCounts[index] += other.PhaseCounts[index];
+    }
+
+    NumRounds += other.NumRounds;
+    NumTasks += other.NumTasks;
+    NumIterations += other.NumIterations;
+    NumGeneratedSystems += other.NumGeneratedSystems;
+    NumResultSystems += other.NumResultSystems;
+    NumFailedSystems += other.NumFailedSystems;
+    NumFingerprintedSystems += other.NumFingerprintedSystems;
+
+    return *this;
+}
+
+std::uint64_t Statistics::GetNanoseconds(PhaseValue phase) const {
+    return PhaseNanoseconds[static_cast<size_t>(phase)];
+}
+
+std::uint64_t Statistics::GetCount(PhaseValue phase) const {
+    return PhaseCounts[static_cast<size_t>(phase)];
+}
+
+// static
+char const * Statistics::ToString(PhaseValue phase) {
+    switch(phase) {
+    case PhaseValue::Commit: return "Commit";
+    case PhaseValue::GenerateChildren: return "GenerateChildren";
+    case PhaseValue::Sort: return "Sort";
+    case PhaseValue::Fingerprint: return "Fingerprint";
+    case PhaseValue::ResultCommit: return "ResultCommit";
+    case PhaseValue::Merge: return "Merge";
+    }
+
+    throw std::logic_error("Invalid PhaseValue");
+}
+
+std::string Statistics::ToString(void) const {
+    std::vector<std::string>                phases;
+
+    phases.reserve(NumPhases);
+
+    for(size_t index = 0; index < NumPhases; ++index)
+        phases.emplace_back(
+            boost::str(
+                boost::format("%1%(%2%,%3%)")
+                    % ToString(static_cast<PhaseValue>(index))
+                    % PhaseCounts[index]
+                    % PhaseNanoseconds[index]
+            )
+        );
+
+    return boost::str(
+        boost::format("Statistics(%1%,%2%,%3%,%4%,%5%,%6%,%7%,%8%)")
+            % NumRounds
+            % NumTasks
+            % NumIterations
+            % NumGeneratedSystems
+            % NumResultSystems
+            % NumFailedSystems
+            % NumFingerprintedSystems
+            % boost::algorithm::join(phases, ",")
+    );
+}
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -51,20 +128,34 @@ SystemPtrs ExecuteTask(
     size_t maxNumIterations,
     bool continueProcessingSystemsWithFailures,
     WorkingSystemPtr pInitial,
-    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo
+    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo/*=std::nullopt*/,
+    Statistics *pStatistics/*=nullptr*/
 ) {
+    UNUSED(pStatistics);
+
     ENSURE_ARGUMENT(maxNumPendingSystems);
     ENSURE_ARGUMENT(maxNumChildrenPerGeneration);
     ENSURE_ARGUMENT(maxNumIterations);
     ENSURE_ARGUMENT(pInitial);
 
+    // Events that the observer isn't interested in are skipped
+    EventFlagValue const                    eventFlags(observer.GetEventFlags());
+    bool const                              notifyIteration(IsSet(eventFlags, EventFlagValue::Iteration));
+    bool const                              notifyGenerate(IsSet(eventFlags, EventFlagValue::IterationGenerate));
+    bool const                              notifyMerge(IsSet(eventFlags, EventFlagValue::IterationMerge));
+    bool const                              notifyFailedSystems(IsSet(eventFlags, EventFlagValue::IterationFailedSystems));
+
     auto const                              processResultsAndFailuresFunc(
         [
             &fingerprinter,
             &observer,
             maxNumIterations,
-            continueProcessingSystemsWithFailures
+            continueProcessingSystemsWithFailures,
+            notifyFailedSystems,
+            pStatistics
         ](size_t iteration, SystemPtrs &systems) {
+            UNUSED(pStatistics);
+
             // Remove all of the failures at the end of the queue
             if(
                 continueProcessingSystemsWithFailures == false
@@ -88,8 +179,11 @@ SystemPtrs ExecuteTask(
                 assert(std::all_of(systems.cbegin(), iFirstFailure, [](SystemPtr const &ptr) { return ptr->GetScore().IsSuccessful; }));
                 assert(std::all_of(iFirstFailure, systems.cend(), [](SystemPtr const &ptr) { return ptr->GetScore().IsSuccessful == false; }));
 
+                DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumFailedSystems, std::distance(iFirstFailure, systems.cend()));
+
                 bool const                  shouldContinue(
-                    observer.OnFailedSystems(
+                    notifyFailedSystems == false
+                    || observer.OnFailedSystems(
                         iteration,
                         maxNumIterations,
                         iFirstFailure,
@@ -113,25 +207,31 @@ SystemPtrs ExecuteTask(
                 SystemPtrs::iterator const              iEnd(iter);
                 Observer::ResultSystemUniquePtrs        results;
 
-                for(iter = systems.begin(); iter != iEnd; ++iter) {
-                    assert(dynamic_cast<CalculatedResultSystem *>((*iter).get()));
-                    CalculatedResultSystem &            result(static_cast<CalculatedResultSystem &>(**iter));
+                {
+                    DECISION_ENGINE_STATISTICS_PHASE(pStatistics, ResultCommit);
+
+                    for(iter = systems.begin(); iter != iEnd; ++iter) {
+                        assert(dynamic_cast<CalculatedResultSystem *>((*iter).get()));
+                        CalculatedResultSystem &        result(static_cast<CalculatedResultSystem &>(**iter));
 
-                    if(fingerprinter.ShouldProcess(result) == false)
-                        continue;
+                        if(fingerprinter.ShouldProcess(result) == false)
+                            continue;
 
-                    Observer::ResultSystemUniquePtr     pResult(result.Commit());
+                        Observer::ResultSystemUniquePtr pResult(result.Commit());
 
-                    assert(pResult);
+                        assert(pResult);
 
-                    if(fingerprinter.ShouldProcess(*pResult) == false)
-                        continue;
+                        if(fingerprinter.ShouldProcess(*pResult) == false)
+                            continue;
 
-                    results.emplace_back(std::move(pResult));
+                        results.emplace_back(std::move(pResult));
+                    }
                 }
 
                 systems.erase(systems.begin(), iEnd);
 
+                DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumResultSystems, results.size());
+
                 if(results.empty() == false)
                     return observer.OnSuccessfulSystems(
                         iteration,
@@ -147,10 +247,10 @@ SystemPtrs ExecuteTask(
     SystemPtrs                              pending;
 
     for(size_t iteration = 0; iteration < maxNumIterations; ++iteration) {
-        if(observer.OnBegin(iteration, maxNumIterations) == false)
+        if(notifyIteration && observer.OnBegin(iteration, maxNumIterations) == false)
             break;
 
-        FINALLY([&observer, &iteration, &maxNumIterations](void) { observer.OnEnd(iteration, maxNumIterations); });
+        FINALLY([&observer, &iteration, &maxNumIterations, notifyIteration](void) { if(notifyIteration) observer.OnEnd(iteration, maxNumIterations); });
 
         // Get the initial WorkingSystem
         while(!pInitial && pending.empty() == false) {
@@ -171,6 +271,8 @@ SystemPtrs ExecuteTask(
                     assert(dynamic_cast<CalculatedWorkingSystem *>(&system));
                     assert(fingerprinter.ShouldProcess(system));
 
+                    DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Commit);
+
                     pInitial = static_cast<CalculatedWorkingSystem &>(system).Commit();
                 }
                 else
@@ -191,20 +293,36 @@ SystemPtrs ExecuteTask(
             continue;
 
         // Generate the work
-        if(observer.OnGeneratingWork(iteration, maxNumIterations, *pInitial) == false)
+        if(notifyGenerate && observer.OnGeneratingWork(iteration, maxNumIterations, *pInitial) == false)
             break;
 
-        SystemPtrs                          generated(pInitial->GenerateChildren(maxNumChildrenPerGeneration));
+        DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumIterations, 1);
+
+        SystemPtrs                          generated(
+            [&pInitial, &maxNumChildrenPerGeneration, &continueProcessingSystemsWithFailures, &pStatistics](void) {
+                UNUSED(pStatistics);
+                DECISION_ENGINE_STATISTICS_PHASE(pStatistics, GenerateChildren);
+
+                return pInitial->GenerateChildren(maxNumChildrenPerGeneration, continueProcessingSystemsWithFailures);
+            }()
+        );
 
         assert(generated.empty() == false);
         assert(generated.size() <= maxNumChildrenPerGeneration);
 
-        observer.OnGeneratedWork(iteration, maxNumIterations, *pInitial, generated);
+        DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumGeneratedSystems, generated.size());
+
+        if(notifyGenerate)
+            observer.OnGeneratedWork(iteration, maxNumIterations, *pInitial, generated);
 
         if(pInitial->IsComplete() == false)
             generated.emplace_back(pInitial);
 
-        std::sort(generated.begin(), generated.end(), Sorter);
+        {
+            DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Sort);
+
+            std::sort(generated.begin(), generated.end(), Sorter);
+        }
 
         // Process systems and failures
         if(processResultsAndFailuresFunc(iteration, generated) == false)
@@ -215,13 +333,19 @@ SystemPtrs ExecuteTask(
 
         // Remove by fingerprinter
         if(dynamic_cast<NoopFingerprinter *>(&fingerprinter) == nullptr) {
-            SystemPtrs::const_iterator  iter(generated.begin());
+            {
+                DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Fingerprint);
 
-            while(iter != generated.end()) {
-                if(fingerprinter.ShouldProcess(**iter) == false)
-                    iter = generated.erase(iter);
-                else
-                    ++iter;
+                SystemPtrs::const_iterator  iter(generated.begin());
+
+                while(iter != generated.end()) {
+                    if(fingerprinter.ShouldProcess(**iter) == false) {
+                        iter = generated.erase(iter);
+                        DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumFingerprintedSystems, 1);
+                    }
+                    else
+                        ++iter;
+                }
             }
 
             if(generated.empty())
@@ -229,7 +353,17 @@ SystemPtrs ExecuteTask(
         }
 
         // Merge the generated work with the pending work
-        {
+        if(notifyMerge == false) {
+            pending = std::get<0>(
+                Merge(
+                    maxNumPendingSystems,
+                    SystemPtrsContainer{ std::move(generated), std::move(pending) },
+                    dynamicScoreInfo,
+                    pStatistics
+                )
+            );
+        }
+        else {
             SystemPtrsContainer             removed;
 
             if(observer.OnMergingWork(iteration, maxNumIterations, *pInitial, generated, pending) == false)
@@ -241,7 +375,8 @@ SystemPtrs ExecuteTask(
             std::tie(pending, removed) = Merge(
                 maxNumPendingSystems,
                 SystemPtrsContainer{ std::move(generated), std::move(pending) },
-                dynamicScoreInfo
+                dynamicScoreInfo,
+                pStatistics
             );
         }
     }
@@ -252,8 +387,11 @@ SystemPtrs ExecuteTask(
 std::tuple<SystemPtrs, SystemPtrsContainer> Merge(
     size_t maxNumSystems,
     SystemPtrsContainer items,
-    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo/*=std::nullopt*/
+    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo/*=std::nullopt*/,
+    Statistics *pStatistics/*=nullptr*/
 ) {
+    UNUSED(pStatistics);
+
     // ----------------------------------------------------------------------
     struct Internal {
         static bool AreValidItems(SystemPtrsContainer const &items) {
@@ -298,6 +436,8 @@ std::tuple<SystemPtrs, SystemPtrsContainer> Merge(
     ENSURE_ARGUMENT(maxNumSystems);
     ENSURE_ARGUMENT(items, Internal::AreValidItems(items));
 
+    DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Merge);
+
     if(dynamicScoreInfo) {
         // ----------------------------------------------------------------------
         struct DynamicScoreInternal {
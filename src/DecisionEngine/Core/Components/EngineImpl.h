@@ -23,6 +23,9 @@
 
 #include "Components.h"
 
+#include <array>
+#include <chrono>
+
 namespace DecisionEngine {
 namespace Core {
 namespace Components {
@@ -49,6 +52,45 @@ using SystemPtrsContainer                   = std::vector<SystemPtrs>;
 using ResultSystemUniquePtr                 = std::unique_ptr<ResultSystem>;
 using WorkingSystemPtr                      = std::shared_ptr<WorkingSystem>;
 
+/////////////////////////////////////////////////////////////////////////
+///  \enum          EventFlagValue
+///  \brief         Groups of observer events. Observers return the groups that
+///                 they are interested in via `GetEventFlags`, and the engine
+///                 will not invoke (or build the arguments for) events in groups
+///                 that were not requested. Result events are always delivered.
+///
+///                 The flags are a performance hint; an observer that forwards
+///                 events to other observers may still receive events that it
+///                 did not request.
+///
+enum class EventFlagValue : std::uint32_t {
+    None = 0,
+    Round = 1 << 0,                         /// OnRoundBegin, OnRoundEnd
+    RoundMerge = 1 << 1,                    /// OnRoundMergingWork, OnRoundMergedWork
+    Task = 1 << 2,                          /// OnTaskBegin, OnTaskEnd
+    TaskError = 1 << 3,                     /// OnTaskError
+    Iteration = 1 << 4,                     /// OnBegin, OnEnd (OnIterationBegin, OnIterationEnd)
+    IterationGenerate = 1 << 5,             /// OnGeneratingWork, OnGeneratedWork
+    IterationMerge = 1 << 6,                /// OnMergingWork, OnMergedWork
+    IterationFailedSystems = 1 << 7,        /// OnFailedSystems
+    Statistics = 1 << 8,                    /// OnStatistics (LocalExecution observers only)
+
+    All = (1 << 9) - 1
+};
+
+inline EventFlagValue constexpr operator|(EventFlagValue a, EventFlagValue b) {
+    return static_cast<EventFlagValue>(static_cast<std::uint32_t>(a) | static_cast<std::uint32_t>(b));
+}
+
+inline EventFlagValue constexpr operator&(EventFlagValue a, EventFlagValue b) {
+    return static_cast<EventFlagValue>(static_cast<std::uint32_t>(a) & static_cast<std::uint32_t>(b));
+}
+
+/// Returns true if `flag` is set within `flags`
+inline bool constexpr IsSet(EventFlagValue flags, EventFlagValue flag) {
+    return (flags & flag) != EventFlagValue::None;
+}
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         Observer
 ///  \brief         Observes events generated during `ExecuteTask`.
@@ -69,6 +111,9 @@ public:
     // |  Public Methods
     virtual ~Observer(void) = default;
 
+    /// Events that should be delivered to this observer; all events are delivered by default.
+    virtual EventFlagValue GetEventFlags(void) const { return EventFlagValue::All; }
+
     virtual bool OnBegin(size_t iteration, size_t maxIterations) = 0;
     virtual void OnEnd(size_t iteration, size_t maxIterations) = 0;
 
@@ -90,10 +135,119 @@ public:
 ///
 using DynamicScoreFunctor                   = std::function<Score (System const &, Score const &)>;
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         Statistics
+///  \brief         Counters and nanosecond timings for each phase of execution.
+///
+///                 Values are only collected when `DECISION_ENGINE_ENABLE_STATISTICS`
+///                 is defined; otherwise, the instrumentation compiles to nothing
+///                 and all values remain 0. An instance is never shared across
+///                 threads - each task populates its own instance and the caller
+///                 combines them once the task has completed.
+///
+class Statistics {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    enum class PhaseValue : unsigned char {
+        Commit = 0,                         /// Committing `CalculatedWorkingSystems`
+        GenerateChildren,                   /// `WorkingSystem::GenerateChildren`
+        Sort,                               /// Sorting generated systems
+        Fingerprint,                        /// Removing generated systems via the `Fingerprinter`
+        ResultCommit,                       /// Committing `CalculatedResultSystems`
+        Merge                               /// Merging generated systems with pending systems
+    };
+
+    static size_t constexpr                 NumPhases = static_cast<size_t>(PhaseValue::Merge) + 1;
+
+    using PhaseValues                       = std::array<std::uint64_t, NumPhases>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+#if (defined DECISION_ENGINE_ENABLE_STATISTICS)
+    static bool constexpr                   IsEnabled = true;
+#else
+    static bool constexpr                   IsEnabled = false;
+#endif
+
+    PhaseValues                             PhaseNanoseconds;
+    PhaseValues                             PhaseCounts;
+
+    std::uint64_t                           NumRounds;
+    std::uint64_t                           NumTasks;
+    std::uint64_t                           NumIterations;
+    std::uint64_t                           NumGeneratedSystems;
+    std::uint64_t                           NumResultSystems;
+    std::uint64_t                           NumFailedSystems;
+    std::uint64_t                           NumFingerprintedSystems; /// Systems removed by the `Fingerprinter`
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    Statistics(void);
+
+    Statistics & operator+=(Statistics const &other);
+
+    std::uint64_t GetNanoseconds(PhaseValue phase) const;
+    std::uint64_t GetCount(PhaseValue phase) const;
+
+    static char const * ToString(PhaseValue phase);
+    std::string ToString(void) const;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ScopedPhaseTimer
+///  \brief         Adds the time spent within a scope to a `Statistics` phase.
+///                 Use `DECISION_ENGINE_STATISTICS_PHASE` rather than this
+///                 class directly so that the timer is compiled out when
+///                 statistics are disabled.
+///
+class ScopedPhaseTimer {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    ScopedPhaseTimer(Statistics *pStatistics, Statistics::PhaseValue phase);
+    ~ScopedPhaseTimer(void);
+
+    NON_COPYABLE(ScopedPhaseTimer);
+    NON_MOVABLE(ScopedPhaseTimer);
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    Statistics * const                      _pStatistics;
+    size_t const                            _phaseIndex;
+    std::chrono::steady_clock::time_point const         _start;
+};
+
+#if (defined DECISION_ENGINE_ENABLE_STATISTICS)
+#   define DECISION_ENGINE_STATISTICS_PHASE_IMPL2(pStatistics, Phase, Line)       ::DecisionEngine::Core::Components::EngineImpl::ScopedPhaseTimer const _phaseTimer##Line(pStatistics, ::DecisionEngine::Core::Components::EngineImpl::Statistics::PhaseValue::Phase)
+#   define DECISION_ENGINE_STATISTICS_PHASE_IMPL(pStatistics, Phase, Line)        DECISION_ENGINE_STATISTICS_PHASE_IMPL2(pStatistics, Phase, Line)
+
+    /// Times the remainder of the current scope
+#   define DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Phase)                   DECISION_ENGINE_STATISTICS_PHASE_IMPL(pStatistics, Phase, __LINE__)
+
+    /// Adds a value to a `Statistics` counter
+#   define DECISION_ENGINE_STATISTICS_ADD(pStatistics, Member, Value)             do { if(pStatistics) (pStatistics)->Member += static_cast<std::uint64_t>(Value); } while(false)
+#else
+#   define DECISION_ENGINE_STATISTICS_PHASE(pStatistics, Phase)                   static_cast<void>(0)
+#   define DECISION_ENGINE_STATISTICS_ADD(pStatistics, Member, Value)             static_cast<void>(0)
+#endif
+
 /////////////////////////////////////////////////////////////////////////
 ///  \fn            ExecuteTask
 ///  \brief         Executes a round of System generation, where the number of
-///                 iterations is specified by the caller.
+///                 iterations is specified by the caller. Statistics are added
+///                 to `pStatistics` (if provided), which must not be shared
+///                 with a concurrent `ExecuteTask` or `Merge` call.
 ///
 SystemPtrs ExecuteTask(
     Fingerprinter &fingerprinter,
@@ -103,13 +257,15 @@ SystemPtrs ExecuteTask(
     size_t maxNumIterations,
     bool continueProcessingSystemWithFailures,
     WorkingSystemPtr pInitial,
-    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo=std::nullopt
+    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo=std::nullopt,
+    Statistics *pStatistics=nullptr
 );
 
 /////////////////////////////////////////////////////////////////////////
 ///  \fn            Merge
 ///  \brief         Merges systems into a sorted lists, limiting the result
-///                 size to a maximum number of items.
+///                 size to a maximum number of items. `pStatistics` must not
+///                 be shared with a concurrent `ExecuteTask` or `Merge` call.
 ///
 ///  \returns       std::tuple<
 ///                     Sorted items,
@@ -119,9 +275,49 @@ SystemPtrs ExecuteTask(
 std::tuple<SystemPtrs, SystemPtrsContainer> Merge(
     size_t maxNumsystems,
     SystemPtrsContainer items,
-    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo=std::nullopt
+    std::optional<std::tuple<ThreadPool &, DynamicScoreFunctor const &>> const &dynamicScoreInfo=std::nullopt,
+    Statistics *pStatistics=nullptr
 );
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Sorter
+///  \brief         Returns true if the first system should be processed before
+///                 the second; this is the order of the lists produced by
+///                 `ExecuteTask` and `Merge`.
+///
+bool Sorter(SystemPtr const &p1, SystemPtr const &p2);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  ScopedPhaseTimer
+// |
+// ----------------------------------------------------------------------
+inline ScopedPhaseTimer::ScopedPhaseTimer(Statistics *pStatistics, Statistics::PhaseValue phase) :
+    _pStatistics(pStatistics),
+    _phaseIndex(static_cast<size_t>(phase)),
+    _start(pStatistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+{}
+
+inline ScopedPhaseTimer::~ScopedPhaseTimer(void) {
+    if(_pStatistics == nullptr)
+        return;
+
+    _pStatistics->PhaseNanoseconds[_phaseIndex] += static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count()
+    );
+    ++_pStatistics->PhaseCounts[_phaseIndex];
+}
+
 } // namespace EngineImpl
 } // namespace Components
 } // namespace Core
@@ -25,6 +25,21 @@ namespace DecisionEngine {
 namespace Core {
 namespace Components {
 
+// ----------------------------------------------------------------------
+// |
+// |  Fingerprinter
+// |
+// ----------------------------------------------------------------------
+// virtual
+void Fingerprinter::SaveState(std::ostream &) const {
+    throw std::runtime_error("Checkpoint not supported");
+}
+
+// virtual
+void Fingerprinter::LoadState(std::istream &) {
+    throw std::runtime_error("Checkpoint not supported");
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  NoopFingerprinter
@@ -34,6 +49,14 @@ bool NoopFingerprinter::ShouldProcess(System const &) /*override*/ {
     return true;
 }
 
+void NoopFingerprinter::SaveState(std::ostream &) const /*override*/ {
+    // No state
+}
+
+void NoopFingerprinter::LoadState(std::istream &) /*override*/ {
+    // No state
+}
+
 } // namespace Components
 } // namespace Core
 } // namespace DecisionEngine
@@ -24,6 +24,9 @@
 
 #include "Components.h"
 
+#include <istream>
+#include <ostream>
+
 namespace DecisionEngine {
 namespace Core {
 namespace Components {
@@ -56,6 +59,17 @@ public:
     virtual ~Fingerprinter(void) = default;
 
     virtual bool ShouldProcess(System const &system) = 0;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            SaveState / LoadState
+    ///  \brief         Persists the information used to identify Systems that have
+    ///                 already been processed so that it survives a checkpoint.
+    ///                 The default implementations throw, so that a Fingerprinter
+    ///                 with state can't silently lose it when a search is resumed;
+    ///                 Fingerprinters without state override them as no-ops.
+    ///
+    virtual void SaveState(std::ostream &stream) const;
+    virtual void LoadState(std::istream &stream);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -72,6 +86,9 @@ public:
     ~NoopFingerprinter(void) override = default;
 
     bool ShouldProcess(System const &system) override;
+
+    void SaveState(std::ostream &stream) const override;
+    void LoadState(std::istream &stream) override;
 };
 
 } // namespace Components
@@ -208,6 +208,15 @@ Index Index::Copy(void) const {
     return Index(_pIndexes);
 }
 
+size_t Index::GetApproximateSize(void) const {
+    size_t                                  result(sizeof(Index));
+
+    if(_pIndexes)
+        result += (sizeof(Indexes) + _pIndexes->capacity() * sizeof(value_type)) / static_cast<size_t>(_pIndexes.use_count());
+
+    return result;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
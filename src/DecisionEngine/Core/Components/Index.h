@@ -103,7 +103,23 @@ public:
     // This method should only be called when the object was created without a suffix
     Index Copy(void) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetApproximateSize
+    ///  \brief         Returns the approximate number of bytes used by this
+    ///                 object. Data shared with other `Indexes` is divided
+    ///                 evenly among the objects that share it.
+    ///
+    size_t GetApproximateSize(void) const;
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Relationships
+    // |
+    // ----------------------------------------------------------------------
+    friend class CompactInputArchive;
+    friend class CompactOutputArchive;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -0,0 +1,415 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PendingSystemStore.cpp
+///  \brief         See PendingSystemStore.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:29:00
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "PendingSystemStore.h"
+#include "System.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <fstream>
+#include <streambuf>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MemoryStreamBuffer
+///  \brief         Read-only stream buffer over a memory mapped region.
+///
+class MemoryStreamBuffer : public std::streambuf {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MemoryStreamBuffer(char const *pData, size_t numBytes) {
+        char * const                        pBegin(const_cast<char *>(pData));
+
+        setg(pBegin, pBegin, pBegin + numBytes);
+    }
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+bool Sorter(PendingSystemStore::SystemPtr const &p1, PendingSystemStore::SystemPtr const &p2) {
+    return *p1 > *p2;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  PendingSystemStore
+// |
+// ----------------------------------------------------------------------
+PendingSystemStore::PendingSystemStore(size_t maxNumBytes, size_t maxNumSystems, std::filesystem::path const &spillDirectory) :
+    MaxNumBytes(
+        std::move(
+            [&maxNumBytes](void) -> size_t & {
+                ENSURE_ARGUMENT(maxNumBytes);
+                return maxNumBytes;
+            }()
+        )
+    ),
+    MaxNumSystems(
+        std::move(
+            [&maxNumSystems](void) -> size_t & {
+                ENSURE_ARGUMENT(maxNumSystems);
+                return maxNumSystems;
+            }()
+        )
+    ),
+    Filename(
+        [&spillDirectory](void) {
+            ENSURE_ARGUMENT(spillDirectory, std::filesystem::is_directory(spillDirectory));
+
+            return spillDirectory / (
+                "DecisionEngine.PendingSystems."
+                + boost::uuids::to_string(boost::uuids::random_generator()())
+                + ".bin"
+            );
+        }()
+    ),
+    _fileSize(0),
+    _numSpilledSystems(0),
+    _numSpillOperations(0),
+    _numRestoreOperations(0),
+    _numCompactOperations(0)
+{}
+
+PendingSystemStore::~PendingSystemStore(void) {
+    std::error_code                         ec;
+
+    std::filesystem::remove(Filename, ec);
+}
+
+void PendingSystemStore::Spill(SystemPtrs &pending) {
+    SpillRun(pending);
+    Trim(pending);
+}
+
+void PendingSystemStore::Restore(SystemPtrs &pending, size_t numRequired) {
+    ENSURE_ARGUMENT(numRequired);
+
+    while(_runs.empty() == false) {
+        // Find the run with the best head
+        RunInfos::iterator                  iRun(
+            std::min_element(
+                _runs.begin(),
+                _runs.end(),
+                [](RunInfo const &a, RunInfo const &b) {
+                    return Sorter(a.pHead, b.pHead);
+                }
+            )
+        );
+
+        if(pending.size() >= numRequired && Sorter(iRun->pHead, pending[numRequired - 1]) == false)
+            break;
+
+        SystemPtrs                          restored(Load(*iRun));
+        SystemPtrs                          merged;
+
+        std::merge(
+            std::make_move_iterator(pending.begin()),
+            std::make_move_iterator(pending.end()),
+            std::make_move_iterator(restored.begin()),
+            std::make_move_iterator(restored.end()),
+            std::back_inserter(merged),
+            Sorter
+        );
+
+        pending = std::move(merged);
+
+        _numSpilledSystems -= iRun->NumSystems;
+        ++_numRestoreOperations;
+
+        _runs.erase(iRun);
+    }
+
+    Compact();
+}
+
+void PendingSystemStore::EnumSpilledSystems(std::function<void (SystemPtrs)> const &func) const {
+    ENSURE_ARGUMENT(func);
+
+    for(RunInfo const &run : _runs)
+        func(Load(run));
+}
+
+bool PendingSystemStore::empty(void) const {
+    return _runs.empty();
+}
+
+size_t PendingSystemStore::GetNumSpilledSystems(void) const {
+    return _numSpilledSystems;
+}
+
+size_t PendingSystemStore::GetNumSpillOperations(void) const {
+    return _numSpillOperations;
+}
+
+size_t PendingSystemStore::GetNumRestoreOperations(void) const {
+    return _numRestoreOperations;
+}
+
+size_t PendingSystemStore::GetNumCompactOperations(void) const {
+    return _numCompactOperations;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+void PendingSystemStore::SpillRun(SystemPtrs &pending) {
+    if(pending.size() < 2)
+        return;
+
+    size_t const                            lowWaterMark(MaxNumBytes / 4 * 3);
+    size_t                                  numBytes(0);
+    std::optional<size_t>                   lowWaterMarkIndex;
+
+    for(size_t index = 0; index < pending.size(); ++index) {
+        numBytes += pending[index]->GetApproximateSize();
+
+        if(!lowWaterMarkIndex && numBytes > lowWaterMark)
+            lowWaterMarkIndex = index;
+    }
+
+    if(numBytes <= MaxNumBytes)
+        return;
+
+    assert(lowWaterMarkIndex);
+
+    // Always keep at least one system in memory so that progress can be made
+    SystemPtrs::iterator const              iSpill(pending.begin() + static_cast<std::ptrdiff_t>(std::max(*lowWaterMarkIndex, static_cast<size_t>(1))));
+
+    SystemPtrs                              toSpill(
+        std::make_move_iterator(iSpill),
+        std::make_move_iterator(pending.end())
+    );
+
+    pending.erase(iSpill, pending.end());
+
+    // Write the run
+    {
+        std::ofstream                       stream(Filename, std::ios::binary | std::ios::app);
+
+        if(stream.is_open() == false)
+            throw std::runtime_error("Invalid spill file");
+
+        Write(stream, toSpill);
+
+        stream.flush();
+
+        if(stream.good() == false)
+            throw std::runtime_error("Invalid spill file");
+
+        size_t const                        newFileSize(static_cast<size_t>(stream.tellp()));
+
+        assert(newFileSize > _fileSize);
+
+        _runs.emplace_back(
+            RunInfo{
+                toSpill.front(),
+                toSpill.back(),
+                toSpill.size(),
+                toSpill.size(),
+                _fileSize,
+                newFileSize - _fileSize
+            }
+        );
+
+        _fileSize = newFileSize;
+    }
+
+    _numSpilledSystems += toSpill.size();
+    ++_numSpillOperations;
+}
+
+void PendingSystemStore::Trim(SystemPtrs &pending) {
+    size_t const                            numSystems(pending.size() + _numSpilledSystems);
+
+    if(numSystems <= MaxNumSystems)
+        return;
+
+    size_t                                  numToRemove(numSystems - MaxNumSystems);
+
+    // Runs are only loaded when they contain the lowest-ranked systems, and at
+    // most once.
+    std::vector<std::optional<SystemPtrs>>  loadedRuns(_runs.size());
+
+    while(numToRemove--) {
+        RunInfos::iterator const            iRun(
+            std::max_element(
+                _runs.begin(),
+                _runs.end(),
+                [](RunInfo const &a, RunInfo const &b) {
+                    return Sorter(a.pTail, b.pTail);
+                }
+            )
+        );
+
+        if(pending.empty() == false && (iRun == _runs.end() || Sorter(pending.back(), iRun->pTail) == false)) {
+            pending.pop_back();
+            continue;
+        }
+
+        assert(iRun != _runs.end());
+
+        std::optional<SystemPtrs> &         loadedRun(loadedRuns[static_cast<size_t>(iRun - _runs.begin())]);
+
+        if(!loadedRun)
+            loadedRun = Load(*iRun);
+
+        --iRun->NumSystems;
+        --_numSpilledSystems;
+
+        if(iRun->NumSystems == 0) {
+            loadedRuns.erase(loadedRuns.begin() + (iRun - _runs.begin()));
+            _runs.erase(iRun);
+            continue;
+        }
+
+        loadedRun->pop_back();
+        iRun->pTail = loadedRun->back();
+    }
+
+    Compact();
+}
+
+void PendingSystemStore::Compact(void) {
+    if(_runs.empty()) {
+        if(_fileSize) {
+            std::filesystem::resize_file(Filename, 0);
+            _fileSize = 0;
+        }
+
+        return;
+    }
+
+    // Approximate the number of bytes used by systems that are still pending
+    size_t                                  numLiveBytes(0);
+
+    for(RunInfo const &run : _runs)
+        numLiveBytes += run.NumBytes / run.NumSerializedSystems * run.NumSystems;
+
+    if(_fileSize <= numLiveBytes * 2)
+        return;
+
+    // Runs that are intact are copied as-is; truncated runs are rewritten
+    std::filesystem::path                   tempFilename(Filename);
+
+    tempFilename += ".tmp";
+
+    RunInfos                                runs(_runs);
+    size_t                                  fileSize(0);
+
+    {
+        std::ifstream                       input(Filename, std::ios::binary);
+        std::ofstream                       output(tempFilename, std::ios::binary | std::ios::trunc);
+
+        if(input.is_open() == false || output.is_open() == false)
+            throw std::runtime_error("Invalid spill file");
+
+        std::vector<char>                   buffer;
+
+        for(RunInfo &run : runs) {
+            if(run.NumSystems == run.NumSerializedSystems) {
+                buffer.resize(run.NumBytes);
+
+                input.seekg(static_cast<std::streamoff>(run.Offset));
+                input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            }
+            else {
+                Write(output, Load(run));
+                run.NumSerializedSystems = run.NumSystems;
+            }
+
+            size_t const                    newFileSize(static_cast<size_t>(output.tellp()));
+
+            run.Offset = fileSize;
+            run.NumBytes = newFileSize - fileSize;
+
+            fileSize = newFileSize;
+        }
+
+        output.flush();
+
+        if(input.good() == false || output.good() == false)
+            throw std::runtime_error("Invalid spill file");
+    }
+
+    std::filesystem::rename(tempFilename, Filename);
+
+    _runs = std::move(runs);
+    _fileSize = fileSize;
+
+    ++_numCompactOperations;
+}
+
+PendingSystemStore::SystemPtrs PendingSystemStore::Load(RunInfo const &run) const {
+    boost::interprocess::file_mapping       mapping(Filename.string().c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region      region(mapping, boost::interprocess::read_only, static_cast<boost::interprocess::offset_t>(run.Offset), run.NumBytes);
+
+    MemoryStreamBuffer                      buffer(static_cast<char const *>(region.get_address()), region.get_size());
+    std::istream                            stream(&buffer);
+    SystemPtrs                              result;
+
+    {
+        boost::archive::binary_iarchive     archive(stream);
+
+        archive >> result;
+    }
+
+    if(result.size() != run.NumSerializedSystems)
+        throw std::runtime_error("Invalid spill file");
+
+    result.resize(run.NumSystems);
+
+    return result;
+}
+
+// static
+void PendingSystemStore::Write(std::ostream &stream, SystemPtrs const &systems) {
+    boost::archive::binary_oarchive         archive(stream);
+
+    archive << systems;
+}
+
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
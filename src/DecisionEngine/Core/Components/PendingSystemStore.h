@@ -0,0 +1,183 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PendingSystemStore.h
+///  \brief         Contains the PendingSystemStore object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:29:00
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Components.h"
+
+#include <filesystem>
+
+namespace DecisionEngine {
+namespace Core {
+namespace Components {
+
+// ----------------------------------------------------------------------
+// |  Forward Declarations
+class System;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PendingSystemStore
+///  \brief         Enforces a memory budget on pending systems.
+///
+///                 Pending systems are sorted from best to worst. When the
+///                 approximate size of the in-memory systems exceeds the
+///                 budget, the lowest-ranked systems are serialized to a
+///                 spill file as a sorted run. The best system in each run
+///                 remains in memory so that runs can be paged back in
+///                 (via a memory mapping of the spill file) once they would
+///                 rank among the systems that are about to be processed.
+///
+///                 Spilled systems count toward the maximum number of
+///                 pending systems; when the limit is exceeded, the
+///                 lowest-ranked systems (in memory or spilled) are
+///                 discarded. Space used by runs that have been restored or
+///                 truncated is reclaimed by compacting the spill file once
+///                 it exceeds the space used by the remaining systems.
+///
+///                 Each run is written to its own archive, so sub-objects
+///                 shared by systems in the same run (for example, the
+///                 result groups of a Score) remain shared when the run is
+///                 restored. Sharing with systems in other runs or with
+///                 systems that remained in memory is not restored; the
+///                 approximate size of restored systems reflects this, so
+///                 the budget continues to hold.
+///
+class PendingSystemStore {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SystemPtr                         = std::shared_ptr<System>;
+    using SystemPtrs                        = std::deque<SystemPtr>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            MaxNumBytes;
+    size_t const                            MaxNumSystems;
+    std::filesystem::path const             Filename;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    PendingSystemStore(size_t maxNumBytes, size_t maxNumSystems, std::filesystem::path const &spillDirectory);
+    ~PendingSystemStore(void);
+
+    NON_COPYABLE(PendingSystemStore);
+    NON_MOVABLE(PendingSystemStore);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Spill
+    ///  \brief         Spills the lowest-ranked systems in `pending` (which must be
+    ///                 sorted) if their approximate size exceeds the budget. Systems
+    ///                 are spilled until the remaining systems fit within 3/4 of the
+    ///                 budget to avoid spilling a handful of systems every round. At
+    ///                 least one system always remains in memory (unless the
+    ///                 maximum number of systems requires otherwise).
+    ///
+    ///                 Systems are then discarded (from the end of `pending` or
+    ///                 from the end of spilled runs) until the total number of
+    ///                 pending systems is within `MaxNumSystems`. Discarded
+    ///                 systems are not reported.
+    ///
+    void Spill(SystemPtrs &pending);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Restore
+    ///  \brief         Pages spilled runs back into `pending` (which must be sorted)
+    ///                 while the best system in a run would rank among the first
+    ///                 `numRequired` systems.
+    ///
+    void Restore(SystemPtrs &pending, size_t numRequired);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            EnumSpilledSystems
+    ///  \brief         Invokes `func` with each spilled run (sorted from best to
+    ///                 worst) without restoring it; only one run is loaded into
+    ///                 memory at a time.
+    ///
+    void EnumSpilledSystems(std::function<void (SystemPtrs)> const &func) const;
+
+    /// Returns true if there are no spilled systems.
+    bool empty(void) const;
+
+    size_t GetNumSpilledSystems(void) const;
+    size_t GetNumSpillOperations(void) const;
+    size_t GetNumRestoreOperations(void) const;
+    size_t GetNumCompactOperations(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct RunInfo {
+        SystemPtr                           pHead;
+        SystemPtr                           pTail;
+
+        /// The number of systems that are still pending; systems beyond this
+        /// point were discarded after the run was written.
+        size_t                              NumSystems;
+        size_t                              NumSerializedSystems;
+
+        size_t                              Offset;
+        size_t                              NumBytes;
+    };
+
+    using RunInfos                          = std::vector<RunInfo>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    RunInfos                                _runs;
+    size_t                                  _fileSize;
+
+    size_t                                  _numSpilledSystems;
+    size_t                                  _numSpillOperations;
+    size_t                                  _numRestoreOperations;
+    size_t                                  _numCompactOperations;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void SpillRun(SystemPtrs &pending);
+    void Trim(SystemPtrs &pending);
+    void Compact(void);
+
+    SystemPtrs Load(RunInfo const &run) const;
+
+    static void Write(std::ostream &stream, SystemPtrs const &systems);
+};
+
+} // namespace Components
+} // namespace Core
+} // namespace DecisionEngine
@@ -61,6 +61,27 @@ int CompareGroups(GroupLikeAT const &a, GroupLikeBT const &b) {
     return 0;
 }
 
+size_t GetApproximateResultSize(Score::Result const &result) {
+    return sizeof(Score::Result)
+        + (
+            result.ApplicabilityResults.capacity()
+            + result.RequirementResults.capacity()
+            + result.PreferenceResults.capacity()
+        ) * sizeof(Condition::Result);
+}
+
+// Results shared with other objects are divided evenly among the objects that share them
+size_t GetApproximateResultPtrsSize(std::vector<std::shared_ptr<Score::Result>> const &resultPtrs) {
+    size_t                                  result(sizeof(resultPtrs) + resultPtrs.capacity() * sizeof(std::shared_ptr<Score::Result>));
+
+    for(auto const &pResult : resultPtrs) {
+        if(pResult)
+            result += GetApproximateResultSize(*pResult) / static_cast<size_t>(pResult.use_count());
+    }
+
+    return result;
+}
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------
@@ -68,17 +89,26 @@ int CompareGroups(GroupLikeAT const &a, GroupLikeBT const &b) {
 // |  Score::Result
 // |
 // ----------------------------------------------------------------------
+Score::Result::Result(void) :
+    IsApplicable(false), // Placeholder
+    IsSuccessful(false), // Placeholder
+    Score(0.0f), // Placeholder
+    IsPartial(false) // Placeholder
+{}
+
 Score::Result::Result(
     ConditionResults applicabilityResults,
     ConditionResults requirementResults,
-    ConditionResults preferenceResults
+    ConditionResults preferenceResults,
+    bool isPartial/*=false*/
 ) :
     IsApplicable(false), // Placeholder
     IsSuccessful(false), // Placeholder
     Score(0.0f), // Placeholder
     ApplicabilityResults(std::move(applicabilityResults)),
     RequirementResults(std::move(requirementResults)),
-    PreferenceResults(std::move(preferenceResults))
+    PreferenceResults(std::move(preferenceResults)),
+    IsPartial(isPartial)
 {
     // ----------------------------------------------------------------------
     struct Internal {
@@ -108,6 +138,9 @@ Score::Result::Result(
     // The result is successful if all of the requirements are successful
     make_mutable(IsSuccessful) = std::all_of(RequirementResults.cbegin(), RequirementResults.cend(), [](Condition::Result const &cr) { return cr.IsSuccessful; });
 
+    // Evaluation only stops early when a requirement fails
+    ENSURE_ARGUMENT(isPartial, IsPartial == false || IsSuccessful == false);
+
     // Calculate the final score based on the requirement and preference results.
     // Take special care to ensure that the preferences are never treated as more
     // important than the requirements.
@@ -345,6 +378,13 @@ Score::Result const & Score::SuffixInfo::GetResult(void) const {
     return _result;
 }
 
+size_t Score::SuffixInfo::GetApproximateSize(void) const {
+    if(_isMoved)
+        return sizeof(SuffixInfo);
+
+    return sizeof(SuffixInfo) - sizeof(Result) + GetApproximateResultSize(_result);
+}
+
 std::string Score::SuffixInfo::ToString(void) const {
     return boost::str(
         boost::format("Suffix(%s,%d)")
@@ -592,6 +632,27 @@ Score Score::Copy(void) const {
     return Score();
 }
 
+size_t Score::GetApproximateSize(void) const {
+    size_t                                  result(sizeof(Score));
+
+    if(_pResultGroups) {
+        size_t                              groupsSize(sizeof(ResultGroupPtrs) + _pResultGroups->capacity() * sizeof(ResultGroupPtr));
+
+        for(ResultGroupPtr const &pResultGroup : *_pResultGroups)
+            groupsSize += (sizeof(ResultGroup) - sizeof(ResultPtrs) + GetApproximateResultPtrsSize(pResultGroup->Results)) / static_cast<size_t>(pResultGroup.use_count());
+
+        result += groupsSize / static_cast<size_t>(_pResultGroups.use_count());
+    }
+
+    if(_pResults)
+        result += GetApproximateResultPtrsSize(*_pResults) / static_cast<size_t>(_pResults.use_count());
+
+    if(_suffix)
+        result += _suffix->GetApproximateSize();
+
+    return result;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -23,6 +23,8 @@
 
 #include "Condition.h"
 
+#include <boost/serialization/version.hpp>
+
 namespace DecisionEngine {
 namespace Core {
 namespace Components {
@@ -67,19 +69,23 @@ public:
         ConditionResults const              RequirementResults;
         ConditionResults const              PreferenceResults;
 
+        // True if evaluation stopped once the result was known to be
+        // unsuccessful, in which case some Conditions were not applied.
+        bool const                          IsPartial;
+
         // ----------------------------------------------------------------------
         // |  Public Methods
         Result(
             ConditionResults applicabilityResults,
             ConditionResults requirementResults,
-            ConditionResults preferenceResults
+            ConditionResults preferenceResults,
+            bool isPartial=false
         );
 
-#define ARGS                                MEMBERS(IsApplicable, IsSuccessful, Score, ApplicabilityResults, RequirementResults, PreferenceResults)
+#define ARGS                                MEMBERS(IsApplicable, IsSuccessful, Score, ApplicabilityResults, RequirementResults, PreferenceResults, IsPartial)
 
         NON_COPYABLE(Result);
         MOVE(Result, ARGS);
-        SERIALIZATION(Result, ARGS);
 
         // Comparison doesn't depend on the specific ConditionResults
         COMPARE(Result, MEMBERS(IsApplicable, IsSuccessful, Score));
@@ -87,6 +93,27 @@ public:
 #undef ARGS
 
         std::string ToString(void) const;
+
+    private:
+        // ----------------------------------------------------------------------
+        // |  Relationships
+        friend class boost::serialization::access;
+
+        // ----------------------------------------------------------------------
+        // |  Private Methods
+
+        // Used during deserialization
+        Result(void);
+
+        // `IsPartial` was added in version 1; it is false when loading
+        // archives created before then.
+        template <typename ArchiveT>
+        void save(ArchiveT &ar, unsigned int const version) const;
+
+        template <typename ArchiveT>
+        void load(ArchiveT &ar, unsigned int const version);
+
+        BOOST_SERIALIZATION_SPLIT_MEMBER();
     };
 
     /////////////////////////////////////////////////////////////////////////
@@ -242,6 +269,8 @@ private:
         Result const & GetResult(void) const;
 
         std::string ToString(void) const;
+
+        size_t GetApproximateSize(void) const;
     };
 
     // ----------------------------------------------------------------------
@@ -308,7 +337,23 @@ public:
     // This method should only be called when the object was created without a suffix
     Score Copy(void) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetApproximateSize
+    ///  \brief         Returns the approximate number of bytes used by this
+    ///                 object. Data shared with other `Scores` is divided
+    ///                 evenly among the objects that share it.
+    ///
+    size_t GetApproximateSize(void) const;
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Relationships
+    // |
+    // ----------------------------------------------------------------------
+    friend class CompactInputArchive;
+    friend class CompactOutputArchive;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -328,6 +373,42 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Score::Result
+// |
+// ----------------------------------------------------------------------
+template <typename ArchiveT>
+void Score::Result::save(ArchiveT &ar, unsigned int const /*version*/) const {
+    ar << boost::serialization::make_nvp("IsApplicable", IsApplicable);
+    ar << boost::serialization::make_nvp("IsSuccessful", IsSuccessful);
+    ar << boost::serialization::make_nvp("Score", Score);
+    ar << boost::serialization::make_nvp("ApplicabilityResults", ApplicabilityResults);
+    ar << boost::serialization::make_nvp("RequirementResults", RequirementResults);
+    ar << boost::serialization::make_nvp("PreferenceResults", PreferenceResults);
+    ar << boost::serialization::make_nvp("IsPartial", IsPartial);
+}
+
+template <typename ArchiveT>
+void Score::Result::load(ArchiveT &ar, unsigned int const version) {
+    ar >> boost::serialization::make_nvp("IsApplicable", make_mutable(IsApplicable));
+    ar >> boost::serialization::make_nvp("IsSuccessful", make_mutable(IsSuccessful));
+    ar >> boost::serialization::make_nvp("Score", Score);
+    ar >> boost::serialization::make_nvp("ApplicabilityResults", make_mutable(ApplicabilityResults));
+    ar >> boost::serialization::make_nvp("RequirementResults", make_mutable(RequirementResults));
+    ar >> boost::serialization::make_nvp("PreferenceResults", make_mutable(PreferenceResults));
+
+    if(version >= 1)
+        ar >> boost::serialization::make_nvp("IsPartial", make_mutable(IsPartial));
+    else
+        make_mutable(IsPartial) = false;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Score
+// |
+// ----------------------------------------------------------------------
 template <typename FunctionT>
 // bool (ResultGroup const &);
 bool Score::EnumResultGroups(FunctionT const &func) const {
@@ -382,3 +463,5 @@ bool Score::EnumAllResults(FunctionT const &func) const {
 } // namespace Components
 } // namespace Core
 } // namespace DecisionEngine
+
+BOOST_CLASS_VERSION(DecisionEngine::Core::Components::Score::Result, 1);
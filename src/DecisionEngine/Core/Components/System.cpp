@@ -70,6 +70,13 @@ Index const & System::GetIndex(void) const {
     return _index;
 }
 
+// virtual
+size_t System::GetApproximateSize(void) const {
+    return sizeof(System) - sizeof(Score) - sizeof(Index)
+        + _score.GetApproximateSize()
+        + _index.GetApproximateSize();
+}
+
 } // namespace Components
 } // namespace Core
 } // namespace DecisionEngine
@@ -92,6 +92,15 @@ public:
     Score const & GetScore(void) const;
     Index const & GetIndex(void) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetApproximateSize
+    ///  \brief         Returns the approximate number of bytes used by this
+    ///                 object; used when enforcing memory budgets. Derived
+    ///                 classes should override this method to account for
+    ///                 their own data.
+    ///
+    virtual size_t GetApproximateSize(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |  Relationships
@@ -75,7 +75,7 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    SystemPtrs GenerateChildrenImpl(size_t) override {
+    SystemPtrs GenerateChildrenImpl(size_t, bool) override {
         return SystemPtrs();
     }
 };
@@ -0,0 +1,397 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompactArchive_UnitTest.cpp
+///  \brief         Unit test for CompactArchive.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:04:45
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../CompactArchive.h"
+#include <catch.hpp>
+
+#include <sstream>
+
+namespace NS                                = DecisionEngine::Core::Components;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+
+NS::Condition::Result::ConditionPtr const   g_pCondition(NS::Condition::Create("Global Condition", static_cast<unsigned short>(100)));
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+class RegisteredSystem : public NS::System {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    RegisteredSystem(NS::Score score, NS::Index index) :
+        NS::System(TypeValue::Working, CompletionValue::Concrete, std::move(score), std::move(index))
+    {}
+
+    ~RegisteredSystem(void) override = default;
+
+    NON_COPYABLE(RegisteredSystem);
+    MOVE(RegisteredSystem, BASES(NS::System));
+    COMPARE(RegisteredSystem, BASES(NS::System));
+    SERIALIZATION(RegisteredSystem, BASES(NS::System), FLAGS(SERIALIZATION_POLYMORPHIC(NS::System)));
+
+    std::string ToString(void) const override { return "RegisteredSystem"; }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(RegisteredSystem);
+
+class UnregisteredSystem : public NS::System {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    UnregisteredSystem(NS::Score score, NS::Index index) :
+        NS::System(TypeValue::Working, CompletionValue::Concrete, std::move(score), std::move(index))
+    {}
+
+    ~UnregisteredSystem(void) override = default;
+
+    NON_COPYABLE(UnregisteredSystem);
+    MOVE(UnregisteredSystem, BASES(NS::System));
+    COMPARE(UnregisteredSystem, BASES(NS::System));
+    SERIALIZATION(UnregisteredSystem, BASES(NS::System), FLAGS(SERIALIZATION_POLYMORPHIC(NS::System)));
+
+    std::string ToString(void) const override { return "UnregisteredSystem"; }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(UnregisteredSystem);
+
+bool const                                  g_registered(
+    [](void) {
+        NS::RegisterCompactSystem<RegisteredSystem>(
+            "RegisteredSystem",
+            [](NS::CompactOutputArchive &archive, RegisteredSystem const &system) {
+                archive.Write(system.GetScore());
+                archive.Write(system.GetIndex());
+            },
+            [](NS::CompactInputArchive &archive) {
+                NS::Score                   score(archive.ReadScore());
+                NS::Index                   index(archive.ReadIndex());
+
+                return std::make_shared<RegisteredSystem>(std::move(score), std::move(index));
+            }
+        );
+
+        return true;
+    }()
+);
+
+NS::Score CreateScore(size_t depth) {
+    std::unique_ptr<NS::Score>              pScore(std::make_unique<NS::Score>());
+
+    for(size_t step = 0; step < depth; ++step)
+        pScore = std::make_unique<NS::Score>(NS::Score(*pScore, NS::Condition::Result(g_pCondition, step % 3 != 0, static_cast<float>(step % 10) / 10.0f), step % 2 == 1).Commit());
+
+    return std::move(*pScore);
+}
+
+NS::Index CreateIndex(size_t depth) {
+    std::unique_ptr<NS::Index>              pIndex(std::make_unique<NS::Index>());
+
+    for(size_t step = 0; step < depth; ++step)
+        pIndex = std::make_unique<NS::Index>(NS::Index(*pIndex, static_cast<NS::Index::value_type>(step * 1000)).Commit());
+
+    return std::move(*pIndex);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CompactArchive
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("Primitives") {
+    std::stringstream                       stream;
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+        std::uint64_t const                 initialBytes(archive.GetNumBytes());
+
+        archive.WriteVarint(0);
+        archive.WriteVarint(127);
+        CHECK(archive.GetNumBytes() == initialBytes + 2);
+
+        archive.WriteVarint(128);
+        CHECK(archive.GetNumBytes() == initialBytes + 4);
+
+        archive.WriteVarint(std::numeric_limits<std::uint64_t>::max());
+        CHECK(archive.GetNumBytes() == initialBytes + 14);
+
+        archive.WriteBool(true);
+        archive.WriteBool(false);
+        archive.WriteFloat(0.5f);
+        archive.WriteFloat(-1234.5f);
+        archive.WriteString("");
+        archive.WriteString("A string value");
+    }
+
+    NS::CompactInputArchive                 archive(stream);
+
+    CHECK(archive.ReadVarint() == 0);
+    CHECK(archive.ReadVarint() == 127);
+    CHECK(archive.ReadVarint() == 128);
+    CHECK(archive.ReadVarint() == std::numeric_limits<std::uint64_t>::max());
+    CHECK(archive.ReadBool());
+    CHECK(archive.ReadBool() == false);
+    CHECK(archive.ReadFloat() == 0.5f);
+    CHECK(archive.ReadFloat() == -1234.5f);
+    CHECK(archive.ReadString().empty());
+    CHECK(archive.ReadString() == "A string value");
+    CHECK_THROWS_MATCHES(archive.ReadVarint(), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid compact archive"));
+}
+
+TEST_CASE("Index") {
+    std::stringstream                       stream;
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+
+        archive.Write(NS::Index());
+        archive.Write(NS::Index(10));
+        archive.Write(CreateIndex(5));
+        archive.Write(NS::Index(CreateIndex(5), 20));
+    }
+
+    NS::CompactInputArchive                 archive(stream);
+
+    CHECK(archive.ReadIndex() == NS::Index());
+    CHECK(archive.ReadIndex() == NS::Index(10));
+    CHECK(archive.ReadIndex() == CreateIndex(5));
+
+    NS::Index const                         index(archive.ReadIndex());
+
+    CHECK(index.HasSuffix());
+    CHECK(index == NS::Index(CreateIndex(5), 20));
+}
+
+TEST_CASE("Score") {
+    std::stringstream                       stream;
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+
+        archive.Write(NS::Score());
+        archive.Write(NS::Score(NS::Condition::Result(g_pCondition, true, 0.25f, "reason"), false));
+        archive.Write(CreateScore(10));
+        archive.Write(NS::Score(CreateScore(10), NS::Condition::Result(g_pCondition, false, [](void) { return std::string("lazy reason"); }), true));
+    }
+
+    NS::CompactInputArchive                 archive(stream);
+
+    CHECK(archive.ReadScore() == NS::Score());
+
+    NS::Score const                         score(archive.ReadScore());
+
+    CHECK(score == NS::Score(NS::Condition::Result(g_pCondition, true, 0.25f, "reason"), false));
+    CHECK(score.HasSuffix());
+
+    score.EnumResults(
+        [](NS::Score::Result const &result) {
+            REQUIRE(result.ApplicabilityResults.size() + result.RequirementResults.size() + result.PreferenceResults.size() == 1);
+
+            NS::Condition::Result const &   conditionResult(result.RequirementResults.empty() ? result.PreferenceResults[0] : result.RequirementResults[0]);
+
+            CHECK(conditionResult.Reason == "reason");
+            CHECK(conditionResult.Ratio == 0.25f);
+            CHECK(*conditionResult.Condition == *g_pCondition);
+            return true;
+        }
+    );
+
+    CHECK(archive.ReadScore() == CreateScore(10));
+
+    NS::Score const                         lazyScore(archive.ReadScore());
+
+    CHECK(lazyScore == NS::Score(CreateScore(10), NS::Condition::Result(g_pCondition, false), true));
+    CHECK(lazyScore.HasSuffix());
+}
+
+TEST_CASE("Shared prefixes") {
+    NS::Score const                         parentScore(CreateScore(20));
+    NS::Index const                         parentIndex(CreateIndex(20));
+
+    std::stringstream                       stream;
+    std::uint64_t                           parentBytes(0);
+    std::uint64_t                           childBytes(0);
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+        std::uint64_t                       bytes(archive.GetNumBytes());
+
+        archive.Write(parentScore);
+        archive.Write(parentIndex);
+
+        parentBytes = archive.GetNumBytes() - bytes;
+        bytes = archive.GetNumBytes();
+
+        // The children share everything but their suffixes with the parent,
+        // which has already been written.
+        archive.Write(NS::Score(parentScore, NS::Condition::Result(g_pCondition, false), true));
+        archive.Write(NS::Index(parentIndex, 2));
+        archive.Write(NS::Score(parentScore, NS::Condition::Result(g_pCondition, true), false));
+        archive.Write(NS::Index(parentIndex, 3));
+
+        childBytes = archive.GetNumBytes() - bytes;
+    }
+
+    CHECK(childBytes * 4 < parentBytes);
+
+    NS::CompactInputArchive                 archive(stream);
+
+    CHECK(archive.ReadScore() == parentScore);
+    CHECK(archive.ReadIndex() == parentIndex);
+    CHECK(archive.ReadScore() == NS::Score(parentScore, NS::Condition::Result(g_pCondition, false), true));
+    CHECK(archive.ReadIndex() == NS::Index(parentIndex, 2));
+    CHECK(archive.ReadScore() == NS::Score(parentScore, NS::Condition::Result(g_pCondition, true), false));
+    CHECK(archive.ReadIndex() == NS::Index(parentIndex, 3));
+}
+
+TEST_CASE("Systems") {
+    std::shared_ptr<NS::System> const       pRegistered1(std::make_shared<RegisteredSystem>(CreateScore(3), CreateIndex(3)));
+    std::shared_ptr<NS::System> const       pRegistered2(std::make_shared<RegisteredSystem>(CreateScore(4), CreateIndex(4)));
+    std::shared_ptr<NS::System> const       pUnregistered(std::make_shared<UnregisteredSystem>(CreateScore(5), CreateIndex(5)));
+
+    std::stringstream                       stream;
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+
+        archive.Write(pRegistered1);
+        archive.Write(pRegistered2);
+
+        // Unregistered types are not written
+        CHECK_THROWS_MATCHES(archive.Write(pUnregistered), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("The system type has not been registered"));
+
+        archive.Write(pRegistered1);
+        archive.Write(std::shared_ptr<NS::System>());
+    }
+
+    NS::CompactInputArchive                 archive(stream);
+
+    std::shared_ptr<NS::System> const       pSystem1(archive.ReadSystem());
+    std::shared_ptr<NS::System> const       pSystem2(archive.ReadSystem());
+    std::shared_ptr<NS::System> const       pSystem3(archive.ReadSystem());
+
+    REQUIRE(dynamic_cast<RegisteredSystem const *>(pSystem1.get()));
+    CHECK(static_cast<RegisteredSystem const &>(*pSystem1) == static_cast<RegisteredSystem const &>(*pRegistered1));
+
+    REQUIRE(dynamic_cast<RegisteredSystem const *>(pSystem2.get()));
+    CHECK(static_cast<RegisteredSystem const &>(*pSystem2) == static_cast<RegisteredSystem const &>(*pRegistered2));
+
+    CHECK(pSystem3 == pSystem1);
+    CHECK(!archive.ReadSystem());
+}
+
+TEST_CASE("Large archives") {
+    // Exceed the internal buffer size so that data is written and read in
+    // multiple blocks.
+    size_t const                            numIndexes(20000);
+    std::stringstream                       stream;
+
+    {
+        NS::CompactOutputArchive            archive(stream);
+
+        for(size_t index = 0; index < numIndexes; ++index)
+            archive.Write(NS::Index(static_cast<NS::Index::value_type>(index * 100000)));
+
+        archive.WriteString(std::string(200000, 'x'));
+        archive.Flush();
+
+        CHECK(static_cast<std::uint64_t>(stream.str().size()) == archive.GetNumBytes());
+    }
+
+    NS::CompactInputArchive                 archive(stream);
+
+    for(size_t index = 0; index < numIndexes; ++index)
+        CHECK(archive.ReadIndex() == NS::Index(static_cast<NS::Index::value_type>(index * 100000)));
+
+    CHECK(archive.ReadString() == std::string(200000, 'x'));
+}
+
+TEST_CASE("Errors") {
+    SECTION("Invalid header") {
+        std::stringstream                   stream("Not an archive");
+
+        CHECK_THROWS_MATCHES(NS::CompactInputArchive(stream), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid compact archive"));
+    }
+
+    SECTION("Empty") {
+        std::stringstream                   stream;
+
+        CHECK_THROWS_MATCHES(NS::CompactInputArchive(stream), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid compact archive"));
+    }
+
+    SECTION("Truncated") {
+        std::stringstream                   stream;
+
+        {
+            NS::CompactOutputArchive        archive(stream);
+
+            archive.Write(CreateScore(5));
+        }
+
+        std::string                         content(stream.str());
+
+        content.resize(content.size() - 1);
+
+        std::stringstream                   truncated(content);
+        NS::CompactInputArchive             archive(truncated);
+
+        CHECK_THROWS_MATCHES(archive.ReadScore(), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid compact archive"));
+    }
+
+    SECTION("Invalid reference") {
+        std::stringstream                   stream;
+
+        {
+            NS::CompactOutputArchive        archive(stream);
+
+            archive.WriteVarint(10);
+        }
+
+        NS::CompactInputArchive             archive(stream);
+
+        CHECK_THROWS_MATCHES(archive.ReadIndex(), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid compact archive"));
+    }
+
+    SECTION("Duplicate registration") {
+        CHECK(g_registered);
+
+        CHECK_THROWS_AS(
+            NS::RegisterCompactSystem<RegisteredSystem>(
+                "RegisteredSystem",
+                [](NS::CompactOutputArchive &, RegisteredSystem const &) {},
+                [](NS::CompactInputArchive &) { return std::shared_ptr<RegisteredSystem>(); }
+            ),
+            std::invalid_argument
+        );
+    }
+}
@@ -197,6 +197,72 @@ TEST_CASE("Result construction - full ctor") {
     }
 }
 
+TEST_CASE("Result construction - lazy reason") {
+    NS::Condition::Result::ConditionPtr const           pCondition(NS::Condition::Create("Condition", static_cast<unsigned short>(1)));
+    int                                                 numCalls(0);
+    NS::Condition::Result::LazyReason::Functor const    func(
+        [&numCalls](void) {
+            ++numCalls;
+            return std::string("The reason");
+        }
+    );
+
+    SECTION("bool ctor") {
+        NS::Condition::Result const         r(pCondition, false, func);
+
+        CHECK(numCalls == 0);
+        CHECK(r.Condition.get() == pCondition.get());
+        CHECK(r.IsSuccessful == false);
+        CHECK(r.Ratio == 0.0f);
+        CHECK(r.Reason.IsLazy());
+        CHECK(r.Reason.empty() == false);
+        CHECK(numCalls == 0);
+
+        CHECK(r.Reason == "The reason");
+        CHECK(numCalls == 1);
+
+        CHECK(r.Reason.ToString() == "The reason");
+        CHECK(numCalls == 2);
+    }
+
+    SECTION("ratio ctor") {
+        NS::Condition::Result const         r(pCondition, 0.5f, func);
+
+        CHECK(numCalls == 0);
+        CHECK(r.IsSuccessful);
+        CHECK(r.Ratio == 0.5f);
+        CHECK(r.Reason.IsLazy());
+        CHECK(r.Reason == "The reason");
+        CHECK(numCalls == 1);
+    }
+
+    SECTION("full ctor") {
+        NS::Condition::Result const         r(pCondition, true, 0.0f, func);
+
+        CHECK(numCalls == 0);
+        CHECK(r.IsSuccessful);
+        CHECK(r.Ratio == 0.0f);
+        CHECK(r.Reason.IsLazy());
+        CHECK(r.Reason == "The reason");
+        CHECK(numCalls == 1);
+    }
+
+    SECTION("string reasons are not lazy") {
+        CHECK(NS::Condition::Result(pCondition, true, "The reason").Reason.IsLazy() == false);
+        CHECK(NS::Condition::Result(pCondition, true).Reason.IsLazy() == false);
+    }
+}
+
+TEST_CASE("Result construction - lazy reason errors") {
+    NS::Condition::Result::ConditionPtr const           pCondition(NS::Condition::Create("Condition", static_cast<unsigned short>(1)));
+
+    CHECK_THROWS_MATCHES(NS::Condition::Result(pCondition, true, 1.0f, NS::Condition::Result::LazyReason::Functor()), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("reasonFunc"));
+
+    NS::Condition::Result const                         r(pCondition, true, 1.0f, [](void) { return std::string(); });
+
+    CHECK_THROWS_MATCHES(r.Reason.ToString(), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid reason"));
+}
+
 TEST_CASE("Result construction - errors") {
     CHECK_THROWS_MATCHES(NS::Condition::Result(NS::Condition::Result::ConditionPtr(), true, 1.0f), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("pCondition"));
 
@@ -228,10 +294,38 @@ TEST_CASE("Result - compare") {
     CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Condition::Result(pCondition1, true, 1.0f), NS::Condition::Result(pCondition1, true, 1.0f, "reason")) == 0);
     CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Condition::Result(pCondition1, true, 1.0f, "0"), NS::Condition::Result(pCondition1, true, 1.0f, "1")) == 0);
     CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Condition::Result(pCondition1, true, 1.0f, "0"), NS::Condition::Result(pCondition1, true, 1.0f, "0"), true) == 0);
+    CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Condition::Result(pCondition1, true, 1.0f, "0"), NS::Condition::Result(pCondition1, true, 1.0f, [](void) { return std::string("1"); })) == 0);
+    CHECK(CommonHelpers::TestHelpers::CompareTest(NS::Condition::Result(pCondition1, true, 1.0f, "0"), NS::Condition::Result(pCondition1, true, 1.0f, [](void) { return std::string("0"); }), true) == 0);
+}
+
+TEST_CASE("Result - compare lazy reasons") {
+    NS::Condition::Result::ConditionPtr const           pCondition1(NS::Condition::Create("1", static_cast<unsigned short>(1)));
+    NS::Condition::Result::ConditionPtr const           pCondition2(NS::Condition::Create("2", static_cast<unsigned short>(1)));
+    int                                                 numCalls(0);
+    NS::Condition::Result::LazyReason::Functor const    func(
+        [&numCalls](void) {
+            ++numCalls;
+            return std::string("The reason");
+        }
+    );
+
+    // Reasons aren't materialized when the other values differ
+    CHECK(NS::Condition::Result(pCondition1, true, func) < NS::Condition::Result(pCondition2, true, func));
+    CHECK(NS::Condition::Result(pCondition1, false, func) < NS::Condition::Result(pCondition1, true, func));
+    CHECK(NS::Condition::Result(pCondition1, true, 0.5f, func) < NS::Condition::Result(pCondition1, true, 1.0f, func));
+    CHECK(numCalls == 0);
+
+    // Empty reasons are compared without materializing lazy reasons
+    CHECK(NS::Condition::Result(pCondition1, true) < NS::Condition::Result(pCondition1, true, func));
+    CHECK(numCalls == 0);
+
+    CHECK(NS::Condition::Result(pCondition1, true, func) == NS::Condition::Result(pCondition1, true, "The reason"));
+    CHECK(numCalls == 1);
 }
 
 TEST_CASE("Result - serialization") {
     NS::Condition::Result::ConditionPtr const           pCondition(NS::Condition::Create("Condition", static_cast<unsigned short>(1)));
 
     CHECK(BoostHelpers::TestHelpers::SerializeTest(NS::Condition::Result(pCondition, true, 1.0f, "reason")) == 0);
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(NS::Condition::Result(pCondition, true, 1.0f, [](void) { return std::string("reason"); })) == 0);
 }
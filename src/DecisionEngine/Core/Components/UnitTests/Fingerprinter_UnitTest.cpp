@@ -24,6 +24,8 @@
 #include "../Fingerprinter.h"
 #include <catch.hpp>
 
+#include <sstream>
+
 namespace DecisionEngine {
 namespace Core {
 namespace Components {
@@ -41,3 +43,29 @@ TEST_CASE("NoopFingerprinter") {
 
     CHECK(f.ShouldProcess(NS::System()));
 }
+
+TEST_CASE("NoopFingerprinter - State") {
+    NS::NoopFingerprinter                   f;
+    std::stringstream                       stream;
+
+    f.SaveState(stream);
+    CHECK(stream.str().empty());
+
+    f.LoadState(stream);
+    CHECK(f.ShouldProcess(NS::System()));
+}
+
+TEST_CASE("Fingerprinter - State not supported") {
+    // ----------------------------------------------------------------------
+    class MyFingerprinter : public NS::Fingerprinter {
+    public:
+        bool ShouldProcess(System const &) override { return true; }
+    };
+    // ----------------------------------------------------------------------
+
+    MyFingerprinter                         f;
+    std::stringstream                       stream;
+
+    CHECK_THROWS_MATCHES(f.SaveState(stream), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Checkpoint not supported"));
+    CHECK_THROWS_MATCHES(f.LoadState(stream), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Checkpoint not supported"));
+}
@@ -180,3 +180,18 @@ TEST_CASE("Serialization") {
         ) == 0
     );
 }
+
+TEST_CASE("GetApproximateSize") {
+    CHECK(NS::Index().GetApproximateSize() == sizeof(NS::Index));
+
+    NS::Index const                         index(NS::Index(1).Commit());
+    size_t const                            size(index.GetApproximateSize());
+
+    CHECK(size > sizeof(NS::Index));
+
+    // Shared data is divided among the objects that share it
+    NS::Index const                         copy(index.Copy());
+
+    CHECK(index.GetApproximateSize() < size);
+    CHECK(copy.GetApproximateSize() == index.GetApproximateSize());
+}
@@ -0,0 +1,301 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          PendingSystemStore_UnitTest.cpp
+///  \brief         Unit test for PendingSystemStore.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:29:00
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../PendingSystemStore.h"
+#include <catch.hpp>
+
+#include "../System.h"
+
+namespace NS                                = DecisionEngine::Core::Components;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MySystem : public NS::System {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MySystem(NS::Index::value_type index) :
+        NS::System(
+            NS::System::TypeValue::Working,
+            NS::System::CompletionValue::Concrete,
+            NS::Score(),
+            NS::Index(index).Commit()
+        )
+    {}
+
+    ~MySystem(void) override = default;
+
+    NON_COPYABLE(MySystem);
+    MOVE(MySystem, BASES(NS::System));
+    COMPARE(MySystem, BASES(NS::System));
+    SERIALIZATION(MySystem, BASES(NS::System), FLAGS(SERIALIZATION_POLYMORPHIC(NS::System)));
+
+    std::string ToString(void) const override { return "MySystem"; }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MySystem);
+
+NS::PendingSystemStore::SystemPtrs CreateSystems(size_t numSystems) {
+    NS::PendingSystemStore::SystemPtrs      results;
+
+    for(size_t index = 0; index < numSystems; ++index)
+        results.emplace_back(std::make_shared<MySystem>(static_cast<NS::Index::value_type>(index)));
+
+    std::sort(
+        results.begin(),
+        results.end(),
+        [](NS::PendingSystemStore::SystemPtr const &p1, NS::PendingSystemStore::SystemPtr const &p2) {
+            return *p1 > *p2;
+        }
+    );
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  PendingSystemStore
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("Construct") {
+    NS::PendingSystemStore const            store(1000, 100, std::filesystem::temp_directory_path());
+
+    CHECK(store.MaxNumBytes == 1000);
+    CHECK(store.MaxNumSystems == 100);
+    CHECK(store.Filename.parent_path() == std::filesystem::temp_directory_path());
+    CHECK(store.empty());
+    CHECK(store.GetNumSpilledSystems() == 0);
+    CHECK(store.GetNumSpillOperations() == 0);
+    CHECK(store.GetNumRestoreOperations() == 0);
+    CHECK(store.GetNumCompactOperations() == 0);
+}
+
+TEST_CASE("Construct - Errors") {
+    CHECK_THROWS_MATCHES(NS::PendingSystemStore(0, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path()), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("maxNumBytes"));
+    CHECK_THROWS_MATCHES(NS::PendingSystemStore(1000, 0, std::filesystem::temp_directory_path()), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("maxNumSystems"));
+    CHECK_THROWS_MATCHES(NS::PendingSystemStore(1000, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path() / "__does_not_exist__"), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("spillDirectory"));
+}
+
+TEST_CASE("Within budget") {
+    NS::PendingSystemStore::SystemPtrs      pending(CreateSystems(10));
+    size_t const                            systemSize(pending.front()->GetApproximateSize());
+    NS::PendingSystemStore                  store(systemSize * 10, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path());
+
+    store.Spill(pending);
+
+    CHECK(pending.size() == 10);
+    CHECK(store.empty());
+    CHECK(store.GetNumSpillOperations() == 0);
+    CHECK(std::filesystem::exists(store.Filename) == false);
+}
+
+TEST_CASE("Spill and Restore") {
+    NS::PendingSystemStore::SystemPtrs const            original(CreateSystems(10));
+    NS::PendingSystemStore::SystemPtrs                  pending(original);
+    size_t const                                        systemSize(pending.front()->GetApproximateSize());
+    NS::PendingSystemStore                              store(systemSize * 4, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path());
+
+    // Systems are spilled until the remaining systems fit within 3/4 of the budget
+    store.Spill(pending);
+
+    CHECK(pending.size() == 3);
+    CHECK(store.empty() == false);
+    CHECK(store.GetNumSpilledSystems() == 7);
+    CHECK(store.GetNumSpillOperations() == 1);
+    CHECK(std::filesystem::exists(store.Filename));
+
+    for(size_t index = 0; index < pending.size(); ++index)
+        CHECK(pending[index].get() == original[index].get());
+
+    SECTION("Not required") {
+        store.Restore(pending, 3);
+
+        CHECK(pending.size() == 3);
+        CHECK(store.GetNumSpilledSystems() == 7);
+        CHECK(store.GetNumRestoreOperations() == 0);
+    }
+
+    SECTION("Required") {
+        pending.pop_front();
+
+        store.Restore(pending, 3);
+
+        CHECK(pending.size() == 9);
+        CHECK(store.empty());
+        CHECK(store.GetNumSpilledSystems() == 0);
+        CHECK(store.GetNumRestoreOperations() == 1);
+        CHECK(std::filesystem::file_size(store.Filename) == 0);
+
+        for(size_t index = 0; index < pending.size(); ++index)
+            CHECK(pending[index]->GetIndex() == original[index + 1]->GetIndex());
+    }
+
+    SECTION("Multiple runs") {
+        pending.pop_front();
+        pending.pop_front();
+        pending.pop_front();
+
+        store.Restore(pending, 1);
+
+        CHECK(pending.size() == 7);
+
+        // Spill the restored systems again
+        store.Spill(pending);
+
+        CHECK(pending.size() == 3);
+        CHECK(store.GetNumSpilledSystems() == 4);
+        CHECK(store.GetNumSpillOperations() == 2);
+
+        pending.clear();
+        store.Restore(pending, 1);
+
+        CHECK(pending.size() == 4);
+        CHECK(store.empty());
+
+        for(size_t index = 0; index < pending.size(); ++index)
+            CHECK(pending[index]->GetIndex() == original[index + 6]->GetIndex());
+    }
+
+    SECTION("Enumerate") {
+        std::vector<size_t>                             runSizes;
+
+        store.EnumSpilledSystems(
+            [&runSizes, &original](NS::PendingSystemStore::SystemPtrs systems) {
+                for(size_t index = 0; index < systems.size(); ++index)
+                    CHECK(systems[index]->GetIndex() == original[index + 3]->GetIndex());
+
+                runSizes.emplace_back(systems.size());
+            }
+        );
+
+        CHECK(runSizes == std::vector<size_t>{ 7 });
+
+        // The systems remain spilled
+        CHECK(store.GetNumSpilledSystems() == 7);
+        CHECK(store.GetNumRestoreOperations() == 0);
+    }
+}
+
+TEST_CASE("At least one system remains in memory") {
+    NS::PendingSystemStore::SystemPtrs      pending(CreateSystems(3));
+    NS::PendingSystemStore                  store(1, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path());
+
+    store.Spill(pending);
+
+    CHECK(pending.size() == 1);
+    CHECK(store.GetNumSpilledSystems() == 2);
+}
+
+TEST_CASE("Spilled systems count toward the maximum number of systems") {
+    NS::PendingSystemStore::SystemPtrs const            original(CreateSystems(10));
+    NS::PendingSystemStore::SystemPtrs                  pending(original);
+    size_t const                                        systemSize(pending.front()->GetApproximateSize());
+
+    SECTION("Discarded from runs") {
+        NS::PendingSystemStore                          store(systemSize * 4, 8, std::filesystem::temp_directory_path());
+
+        store.Spill(pending);
+
+        CHECK(pending.size() == 3);
+        CHECK(store.GetNumSpilledSystems() == 5);
+
+        pending.clear();
+        store.Restore(pending, 1);
+
+        CHECK(pending.size() == 5);
+
+        for(size_t index = 0; index < pending.size(); ++index)
+            CHECK(pending[index]->GetIndex() == original[index + 3]->GetIndex());
+    }
+
+    SECTION("Discarded from memory") {
+        NS::PendingSystemStore                          store(systemSize * 4, 9, std::filesystem::temp_directory_path());
+
+        store.Spill(pending);
+
+        CHECK(pending.size() == 3);
+        CHECK(store.GetNumSpilledSystems() == 6);
+
+        // Add a system that ranks below all of the others
+        pending.emplace_back(original.back());
+        store.Spill(pending);
+
+        CHECK(pending.size() == 3);
+        CHECK(store.GetNumSpilledSystems() == 6);
+
+        for(size_t index = 0; index < pending.size(); ++index)
+            CHECK(pending[index].get() == original[index].get());
+    }
+}
+
+TEST_CASE("Compact") {
+    NS::PendingSystemStore::SystemPtrs const            original(CreateSystems(20));
+    size_t const                                        systemSize(original.front()->GetApproximateSize());
+    NS::PendingSystemStore                              store(systemSize * 4, std::numeric_limits<size_t>::max(), std::filesystem::temp_directory_path());
+
+    // Spill the worst systems
+    NS::PendingSystemStore::SystemPtrs                  pending(original.begin() + 10, original.begin() + 20);
+
+    pending.emplace_front(original.front());
+
+    store.Spill(pending);
+
+    CHECK(pending.size() == 3);
+    CHECK(store.GetNumSpilledSystems() == 8);
+
+    // Spill systems that rank above the first run
+    pending.insert(pending.begin() + 1, original.begin() + 1, original.begin() + 10);
+
+    store.Spill(pending);
+
+    CHECK(pending.size() == 3);
+    CHECK(store.GetNumSpilledSystems() == 17);
+    CHECK(store.GetNumSpillOperations() == 2);
+
+    size_t const                                        fileSize(std::filesystem::file_size(store.Filename));
+
+    // Restoring the second run leaves the file mostly unused
+    pending.clear();
+    store.Restore(pending, 1);
+
+    CHECK(pending.size() == 9);
+    CHECK(store.GetNumRestoreOperations() == 1);
+    CHECK(store.GetNumCompactOperations() == 1);
+    CHECK(std::filesystem::file_size(store.Filename) < fileSize);
+
+    for(size_t index = 0; index < pending.size(); ++index)
+        CHECK(pending[index]->GetIndex() == original[index + 3]->GetIndex());
+
+    // The first run is still available
+    pending.clear();
+    store.Restore(pending, 1);
+
+    CHECK(pending.size() == 8);
+    CHECK(store.empty());
+
+    for(size_t index = 0; index < pending.size(); ++index)
+        CHECK(pending[index]->GetIndex() == original[index + 12]->GetIndex());
+}
@@ -32,6 +32,8 @@
 
 #include <BoostHelpers/TestHelpers.h>
 
+#include <sstream>
+
 namespace NS                                = DecisionEngine::Core::Components;
 
 // ----------------------------------------------------------------------
@@ -597,6 +599,98 @@ TEST_CASE("Score::Result - Serialization") {
     );
 }
 
+TEST_CASE("Score::Result - Serialization - Partial") {
+    CHECK(
+        BoostHelpers::TestHelpers::SerializeTest(
+            NS::Score::Result(
+                CommonHelpers::Stl::CreateVector<NS::Condition::Result>(
+                    NS::Condition::Result(g_pCondition, true)
+                ),
+                CommonHelpers::Stl::CreateVector<NS::Condition::Result>(
+                    NS::Condition::Result(g_pCondition, false)
+                ),
+                NS::Score::Result::ConditionResults{},
+                true
+            ),
+            [](std::string const &output) {
+                UNSCOPED_INFO(output);
+
+                // Required to display the content
+                CHECK(true);
+            }
+        ) == 0
+    );
+}
+
+/// Score::Result as it was serialized before `IsPartial` was added (version 0)
+struct LegacyResult {
+    bool                                    IsApplicable;
+    bool                                    IsSuccessful;
+    float                                   Score;
+
+    NS::Score::Result::ConditionResults     ApplicabilityResults;
+    NS::Score::Result::ConditionResults     RequirementResults;
+    NS::Score::Result::ConditionResults     PreferenceResults;
+
+    template <typename ArchiveT>
+    void serialize(ArchiveT &ar, unsigned int const /*version*/) {
+        ar & boost::serialization::make_nvp("IsApplicable", IsApplicable);
+        ar & boost::serialization::make_nvp("IsSuccessful", IsSuccessful);
+        ar & boost::serialization::make_nvp("Score", Score);
+        ar & boost::serialization::make_nvp("ApplicabilityResults", ApplicabilityResults);
+        ar & boost::serialization::make_nvp("RequirementResults", RequirementResults);
+        ar & boost::serialization::make_nvp("PreferenceResults", PreferenceResults);
+    }
+};
+
+TEST_CASE("Score::Result - Serialization - Version 0") {
+    std::stringstream                       stream;
+
+    {
+        LegacyResult const                  legacy{
+            true,
+            false,
+            0.0f,
+            CommonHelpers::Stl::CreateVector<NS::Condition::Result>(
+                NS::Condition::Result(g_pCondition, true)
+            ),
+            CommonHelpers::Stl::CreateVector<NS::Condition::Result>(
+                NS::Condition::Result(g_pCondition, false)
+            ),
+            NS::Score::Result::ConditionResults{}
+        };
+        boost::archive::text_oarchive       archive(stream);
+
+        archive << legacy;
+    }
+
+    // Start with a partial result to ensure that the value is reset
+    NS::Score::Result                       result(
+        NS::Score::Result::ConditionResults{},
+        CommonHelpers::Stl::CreateVector<NS::Condition::Result>(
+            NS::Condition::Result(g_pCondition, false)
+        ),
+        NS::Score::Result::ConditionResults{},
+        true
+    );
+
+    CHECK(result.IsPartial);
+
+    {
+        boost::archive::text_iarchive       archive(stream);
+
+        archive >> result;
+    }
+
+    CHECK(result.IsApplicable);
+    CHECK(result.IsSuccessful == false);
+    CHECK(result.ApplicabilityResults.size() == 1);
+    CHECK(result.RequirementResults.size() == 1);
+    CHECK(result.RequirementResults[0].IsSuccessful == false);
+    CHECK(result.PreferenceResults.empty());
+    CHECK(result.IsPartial == false);
+}
+
 NS::Score::Result CreateResult(
     bool isSuccessful,
     std::optional<float> ratio=std::nullopt,
@@ -1379,3 +1473,24 @@ TEST_CASE("Score - Serialization") {
         ) == 0
     );
 }
+
+TEST_CASE("Score - GetApproximateSize") {
+    size_t const                            emptySize(NS::Score().GetApproximateSize());
+
+    CHECK(emptySize >= sizeof(NS::Score));
+
+    NS::Score                               pending(NS::Condition::Result(g_pCondition, true), false);
+
+    CHECK(pending.GetApproximateSize() > emptySize);
+
+    NS::Score const                         committed(pending.Commit());
+    size_t const                            committedSize(committed.GetApproximateSize());
+
+    CHECK(committedSize > emptySize);
+
+    // Shared data is divided among the objects that share it
+    NS::Score const                         copy(committed.Copy());
+
+    CHECK(committed.GetApproximateSize() < committedSize);
+    CHECK(copy.GetApproximateSize() == committed.GetApproximateSize());
+}
@@ -60,7 +60,7 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    SystemPtrs GenerateChildrenImpl(size_t) override {
+    SystemPtrs GenerateChildrenImpl(size_t, bool) override {
         SystemPtrs                          results;
 
         while(results.size() < NumResults) {
@@ -43,10 +43,10 @@ WorkingSystem::WorkingSystem(Score score, Index index) :
     )
 {}
 
-WorkingSystem::SystemPtrs WorkingSystem::GenerateChildren(size_t maxNumChildren) {
+WorkingSystem::SystemPtrs WorkingSystem::GenerateChildren(size_t maxNumChildren, bool continueProcessingSystemsWithFailures/*=true*/) {
     ENSURE_ARGUMENT(maxNumChildren);
 
-    SystemPtrs                              results(GenerateChildrenImpl(maxNumChildren));
+    SystemPtrs                              results(GenerateChildrenImpl(maxNumChildren, continueProcessingSystemsWithFailures));
 
     if(
         results.empty()
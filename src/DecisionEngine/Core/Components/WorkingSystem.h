@@ -64,7 +64,10 @@ public:
 
 #undef ARGS
 
-    SystemPtrs GenerateChildren(size_t maxNumChildren);
+    /// When `continueProcessingSystemsWithFailures` is false, unsuccessful
+    /// children will be discarded, so their Scores may be partial (see
+    /// `Score::Result::IsPartial`).
+    SystemPtrs GenerateChildren(size_t maxNumChildren, bool continueProcessingSystemsWithFailures=true);
     virtual bool IsComplete(void) const = 0;
 
 protected:
@@ -107,7 +110,7 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    virtual SystemPtrs GenerateChildrenImpl(size_t maxNumChildren) = 0;
+    virtual SystemPtrs GenerateChildrenImpl(size_t maxNumChildren, bool continueProcessingSystemsWithFailures) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -8,6 +8,12 @@ endif()
 
 include(BuildHelpers)
 
+option(
+    DecisionEngine_ENABLE_STATISTICS
+    "Collect per-phase counters and timings during execution (see EngineImpl::Statistics)."
+    OFF
+)
+
 function(Impl)
     include(BoostHelpers)
     include(CommonHelpers)
@@ -23,6 +29,8 @@ function(Impl)
             ${_this_path}/../CalculatedResultSystem.h
             ${_this_path}/../CalculatedWorkingSystem.cpp
             ${_this_path}/../CalculatedWorkingSystem.h
+            ${_this_path}/../CompactArchive.cpp
+            ${_this_path}/../CompactArchive.h
             ${_this_path}/../Components.h
             ${_this_path}/../Condition.cpp
             ${_this_path}/../Condition.h
@@ -32,6 +40,8 @@ function(Impl)
             ${_this_path}/../Fingerprinter.h
             ${_this_path}/../Index.cpp
             ${_this_path}/../Index.h
+            ${_this_path}/../PendingSystemStore.cpp
+            ${_this_path}/../PendingSystemStore.h
             ${_this_path}/../ResultSystem.cpp
             ${_this_path}/../ResultSystem.h
             ${_this_path}/../Score.cpp
@@ -51,6 +61,10 @@ function(Impl)
             BoostHelpers
             CommonHelpers
     )
+
+    if(DecisionEngine_ENABLE_STATISTICS)
+        target_compile_definitions(DecisionEngineCoreComponents PUBLIC DECISION_ENGINE_ENABLE_STATISTICS)
+    endif()
 endfunction()
 
 Impl()
@@ -0,0 +1,262 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AnytimeObserver.cpp
+///  \brief         See AnytimeObserver.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:53:16
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "AnytimeObserver.h"
+
+#include <DecisionEngine/Core/Components/ResultSystem.h>
+
+#include <fstream>
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+std::string EscapeCsv(std::string const &value) {
+    std::string                             result;
+
+    result.reserve(value.size() + 2);
+    result += '"';
+
+    for(char c : value) {
+        if(c == '"')
+            result += '"';
+
+        result += c;
+    }
+
+    result += '"';
+    return result;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  AnytimeObserver
+// |
+// ----------------------------------------------------------------------
+AnytimeObserver::AnytimeObserver(Engine::ResultObserver &observer) :
+    _observer(observer),
+    _start(std::chrono::steady_clock::now()),
+    _numExpandedSystems(0)
+{}
+
+// static
+double AnytimeObserver::GetQuality(Score const &score) {
+    if(score.IsSuccessful == false)
+        return 0.0;
+
+    double                                  total(0.0);
+    size_t                                  numResults(0);
+
+    score.EnumAllResults(
+        [&total, &numResults](Score::Result const &result) {
+            total += static_cast<double>(result.Score) / static_cast<double>(Components::MaxScore);
+            ++numResults;
+
+            return true;
+        }
+    );
+
+    return numResults ? total / static_cast<double>(numResults) : 0.0;
+}
+
+AnytimeObserver::Improvements const & AnytimeObserver::GetImprovements(void) const {
+    return _improvements;
+}
+
+AnytimeObserver::RoundInfos const & AnytimeObserver::GetRounds(void) const {
+    return _rounds;
+}
+
+double AnytimeObserver::GetAreaUnderCurve(double endSeconds) const {
+    ENSURE_ARGUMENT(endSeconds, endSeconds > 0.0);
+
+    double                                  area(0.0);
+    double                                  prevSeconds(0.0);
+    double                                  prevQuality(0.0);
+
+    for(Improvement const &improvement : _improvements) {
+        double const                        seconds(std::min(improvement.Seconds, endSeconds));
+
+        area += (seconds - prevSeconds) * prevQuality;
+
+        prevSeconds = seconds;
+        prevQuality = improvement.Quality;
+    }
+
+    area += (endSeconds - prevSeconds) * prevQuality;
+
+    return area / endSeconds;
+}
+
+void AnytimeObserver::WriteImprovements(std::filesystem::path const &filename) const {
+    std::ofstream                           stream(filename, std::ios::trunc);
+
+    if(stream.is_open() == false)
+        throw std::runtime_error("Invalid csv file");
+
+    stream << "seconds,round,quality,score\n";
+
+    for(Improvement const &improvement : _improvements)
+        stream << boost::format("%.9f,%d,%.9f,%s\n") % improvement.Seconds % improvement.Round % improvement.Quality % EscapeCsv(improvement.Score);
+
+    stream.flush();
+
+    if(stream.good() == false)
+        throw std::runtime_error("Invalid csv file");
+}
+
+void AnytimeObserver::WriteRounds(std::filesystem::path const &filename) const {
+    std::ofstream                           stream(filename, std::ios::trunc);
+
+    if(stream.is_open() == false)
+        throw std::runtime_error("Invalid csv file");
+
+    stream << "round,seconds,expanded_systems,pending_systems\n";
+
+    for(RoundInfo const &round : _rounds)
+        stream << boost::format("%d,%.9f,%d,%d\n") % round.Round % round.Seconds % round.NumExpandedSystems % round.NumPendingSystems;
+
+    stream.flush();
+
+    if(stream.good() == false)
+        throw std::runtime_error("Invalid csv file");
+}
+
+// Observer Methods
+AnytimeObserver::EventFlagValue AnytimeObserver::GetEventFlags(void) const /*override*/ {
+    // Round and generation events are needed to count expanded systems
+    return _observer.GetEventFlags() | EventFlagValue::Round | EventFlagValue::IterationGenerate;
+}
+
+bool AnytimeObserver::OnRoundBegin(size_t round, SystemPtrs const &pending) /*override*/ {
+    return _observer.OnRoundBegin(round, pending);
+}
+
+void AnytimeObserver::OnRoundEnd(size_t round, SystemPtrs const &pending) /*override*/ {
+    _rounds.emplace_back(
+        RoundInfo{
+            round,
+            GetElapsedSeconds(),
+            _numExpandedSystems.exchange(0),
+            pending.size()
+        }
+    );
+
+    _observer.OnRoundEnd(round, pending);
+}
+
+bool AnytimeObserver::OnRoundMergingWork(size_t round, SystemPtrsContainer const &pending) /*override*/ {
+    return _observer.OnRoundMergingWork(round, pending);
+}
+
+void AnytimeObserver::OnRoundMergedWork(size_t round, SystemPtrs const &pending, SystemPtrsContainer removed) /*override*/ {
+    _observer.OnRoundMergedWork(round, pending, std::move(removed));
+}
+
+bool AnytimeObserver::OnTaskBegin(size_t round, size_t task, size_t numTasks) /*override*/ {
+    return _observer.OnTaskBegin(round, task, numTasks);
+}
+
+void AnytimeObserver::OnTaskEnd(size_t round, size_t task, size_t numTasks) /*override*/ {
+    _observer.OnTaskEnd(round, task, numTasks);
+}
+
+void AnytimeObserver::OnTaskError(size_t round, size_t task, size_t numTasks, std::exception const &ex) /*override*/ {
+    _observer.OnTaskError(round, task, numTasks, ex);
+}
+
+bool AnytimeObserver::OnIterationBegin(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) /*override*/ {
+    return _observer.OnIterationBegin(round, task, numTasks, iteration, numIterations);
+}
+
+void AnytimeObserver::OnIterationEnd(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) /*override*/ {
+    _observer.OnIterationEnd(round, task, numTasks, iteration, numIterations);
+}
+
+bool AnytimeObserver::OnIterationGeneratingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active) /*override*/ {
+    if(_observer.OnIterationGeneratingWork(round, task, numTasks, iteration, numIterations, active) == false)
+        return false;
+
+    // The active system will be expanded
+    _numExpandedSystems.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void AnytimeObserver::OnIterationGeneratedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated) /*override*/ {
+    _observer.OnIterationGeneratedWork(round, task, numTasks, iteration, numIterations, active, generated);
+}
+
+bool AnytimeObserver::OnIterationMergingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated, SystemPtrs const &pending) /*override*/ {
+    return _observer.OnIterationMergingWork(round, task, numTasks, iteration, numIterations, active, generated, pending);
+}
+
+void AnytimeObserver::OnIterationMergedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &pending, SystemPtrsContainer removed) /*override*/ {
+    _observer.OnIterationMergedWork(round, task, numTasks, iteration, numIterations, active, pending, std::move(removed));
+}
+
+bool AnytimeObserver::OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) /*override*/ {
+    return _observer.OnIterationFailedSystems(round, task, numTasks, iteration, numIterations, begin, end);
+}
+
+void AnytimeObserver::OnStatistics(Statistics const &statistics) /*override*/ {
+    _observer.OnStatistics(statistics);
+}
+
+// ResultObserver methods
+bool AnytimeObserver::OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs results) /*override*/ {
+    double const                            seconds(GetElapsedSeconds());
+
+    {
+        std::scoped_lock<decltype(_improvementsMutex)>  lock(_improvementsMutex); UNUSED(lock);
+
+        for(auto const &pResult : results) {
+            Score const &                   score(pResult->GetScore());
+
+            if(_pBestScore && score <= *_pBestScore)
+                continue;
+
+            _pBestScore = std::make_unique<Score>(score.Copy());
+            _improvements.emplace_back(Improvement{ seconds, round, GetQuality(score), score.ToString() });
+        }
+    }
+
+    return _observer.OnIterationResultSystems(round, task, numTasks, iteration, numIterations, std::move(results));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+double AnytimeObserver::GetElapsedSeconds(void) const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+}
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
@@ -0,0 +1,168 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AnytimeObserver.h
+///  \brief         Contains the AnytimeObserver object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:53:16
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Engine.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         AnytimeObserver
+///  \brief         `ResultObserver` that records how quickly the best result
+///                 improves over wall time before forwarding events to another
+///                 `ResultObserver`. It records the time of every improvement
+///                 to the best `Score` and, for each round, the number of
+///                 systems expanded and the number of pending systems.
+///
+///                 Use this information when tuning values such as
+///                 `GetMaxNumChildrenPerGeneration` and `GetMaxNumPendingSystems`,
+///                 where the rate of improvement is often more important than
+///                 the total execution time.
+///
+class AnytimeObserver : public Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Score                             = Components::Score;
+
+    struct Improvement {
+        double                              Seconds;        /// Relative to the construction of the AnytimeObserver
+        size_t                              Round;
+        double                              Quality;        /// See `GetQuality`
+        std::string                         Score;
+    };
+
+    struct RoundInfo {
+        size_t                              Round;
+        double                              Seconds;        /// Relative to the construction of the AnytimeObserver
+        std::uint64_t                       NumExpandedSystems;
+        size_t                              NumPendingSystems;
+    };
+
+    using Improvements                      = std::vector<Improvement>;
+    using RoundInfos                        = std::vector<RoundInfo>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    AnytimeObserver(Engine::ResultObserver &observer);
+    ~AnytimeObserver(void) override = default;
+
+    NON_COPYABLE(AnytimeObserver);
+    NON_MOVABLE(AnytimeObserver);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetQuality
+    ///  \brief         Returns a value between 0.0 and 1.0 that summarizes a
+    ///                 `Score` so that it can be plotted over time. The value
+    ///                 is the average of all result scores relative to
+    ///                 `MaxScore`; unsuccessful `Scores` are 0.0.
+    ///
+    static double GetQuality(Score const &score);
+
+    // The following methods must not be called while events are being recorded.
+    Improvements const & GetImprovements(void) const;
+    RoundInfos const & GetRounds(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetAreaUnderCurve
+    ///  \brief         Returns the area under the best-quality-over-time step
+    ///                 function from 0 to `endSeconds`, normalized to a value
+    ///                 between 0.0 and 1.0. Higher values indicate that good
+    ///                 results were found sooner.
+    ///
+    double GetAreaUnderCurve(double endSeconds) const;
+
+    /// Writes the improvements as CSV.
+    void WriteImprovements(std::filesystem::path const &filename) const;
+
+    /// Writes the round information as CSV.
+    void WriteRounds(std::filesystem::path const &filename) const;
+
+    // Observer Methods
+    EventFlagValue GetEventFlags(void) const override;
+
+    bool OnRoundBegin(size_t round, SystemPtrs const &pending) override;
+    void OnRoundEnd(size_t round, SystemPtrs const &pending) override;
+
+    bool OnRoundMergingWork(size_t round, SystemPtrsContainer const &pending) override;
+    void OnRoundMergedWork(size_t round, SystemPtrs const &pending, SystemPtrsContainer removed) override;
+
+    bool OnTaskBegin(size_t round, size_t task, size_t numTasks) override;
+    void OnTaskEnd(size_t round, size_t task, size_t numTasks) override;
+
+    void OnTaskError(size_t round, size_t task, size_t numTasks, std::exception const &ex) override;
+
+    bool OnIterationBegin(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) override;
+    void OnIterationEnd(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) override;
+
+    bool OnIterationGeneratingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active) override;
+    void OnIterationGeneratedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated) override;
+
+    bool OnIterationMergingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated, SystemPtrs const &pending) override;
+    void OnIterationMergedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &pending, SystemPtrsContainer removed) override;
+
+    bool OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) override;
+
+    void OnStatistics(Statistics const &statistics) override;
+
+    // ResultObserver methods
+    bool OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs results) override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    Engine::ResultObserver &                _observer;
+    std::chrono::steady_clock::time_point const         _start;
+
+    std::atomic<std::uint64_t>              _numExpandedSystems;            /// Reset at the end of each round
+
+    std::mutex                              _improvementsMutex;
+    std::unique_ptr<Score>                  _pBestScore;
+    Improvements                            _improvements;
+
+    RoundInfos                              _rounds;                        /// Rounds are only modified by the engine's main thread
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    double GetElapsedSeconds(void) const;
+};
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
@@ -0,0 +1,512 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          Engine_Benchmark.cpp
+///  \brief         Benchmark for Engine.h using synthetic problems
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:43:25
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "../Engine.h"
+
+#include <DecisionEngine/Core/Components/Benchmarks/BenchmarkHelpers.h>
+#include <DecisionEngine/Core/Components/Condition.h>
+
+#include <atomic>
+#include <iostream>
+
+namespace Benchmarks                        = DecisionEngine::Core::Components::Benchmarks;
+namespace Components                        = DecisionEngine::Core::Components;
+namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SyntheticCondition
+///  \brief         Condition whose results are a deterministic function of the
+///                 seed and the Index, so that every run with the same
+///                 parameters explores the same tree.
+///
+class SyntheticCondition : public Components::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::uint64_t const                     Seed;
+    float const                             FailureRatio;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(SyntheticCondition);
+
+    template <typename PrivateConstructorTagT>
+    SyntheticCondition(PrivateConstructorTagT tag, std::uint64_t seed, float failureRatio) :
+        Components::Condition(tag, "SyntheticCondition", 10000),
+        Seed(seed),
+        FailureRatio(
+            std::move(
+                [&failureRatio](void) -> float & {
+                    ENSURE_ARGUMENT(failureRatio, failureRatio >= 0.0f && failureRatio <= 1.0f);
+                    return failureRatio;
+                }()
+            )
+        )
+    {}
+
+#define ARGS                                MEMBERS(Seed, FailureRatio), BASES(Components::Condition)
+
+    NON_COPYABLE(SyntheticCondition);
+    MOVE(SyntheticCondition, ARGS);
+    COMPARE(SyntheticCondition, ARGS);
+    SERIALIZATION(SyntheticCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+
+#undef ARGS
+
+    Result Apply(Components::Index const &index) const {
+        std::uint64_t                       hash(Seed);
+
+        index.Enumerate(
+            [&hash](Components::Index::value_type value) {
+                hash = Mix(hash ^ (value + 0x9E3779B97F4A7C15ULL));
+                return true;
+            }
+        );
+
+        // Use different bits for the failure decision and the ratio
+        float const                         failureValue(static_cast<float>(hash & 0xFFFF) / 65536.0f);
+        float const                         ratio(static_cast<float>((hash >> 16) & 0xFFFF) / 65535.0f);
+
+        if(failureValue < FailureRatio)
+            return Result(SharedFromThis(), false, 0.0f);
+
+        return Result(SharedFromThis(), true, ratio);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static std::uint64_t Mix(std::uint64_t value) {
+        // splitmix64 finalizer
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(SyntheticCondition);
+
+class SyntheticResultSystem : public Components::ResultSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::ResultSystem::ResultSystem;
+
+#define ARGS                                BASES(Components::ResultSystem)
+
+    NON_COPYABLE(SyntheticResultSystem);
+    MOVE(SyntheticResultSystem, ARGS);
+    COMPARE(SyntheticResultSystem, ARGS);
+    SERIALIZATION(SyntheticResultSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(boost::format("SyntheticResultSystem(%s,%s)") % GetScore().ToString() % GetIndex().ToString());
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(SyntheticResultSystem);
+
+class SyntheticCalculatedResultSystem : public Components::CalculatedResultSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::CalculatedResultSystem::CalculatedResultSystem;
+
+#define ARGS                                BASES(Components::CalculatedResultSystem)
+
+    NON_COPYABLE(SyntheticCalculatedResultSystem);
+    MOVE(SyntheticCalculatedResultSystem, ARGS);
+    COMPARE(SyntheticCalculatedResultSystem, ARGS);
+    SERIALIZATION(SyntheticCalculatedResultSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(boost::format("SyntheticCalculatedResultSystem(%s,%s)") % GetScore().ToString() % GetIndex().ToString());
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    ResultSystemUniquePtr CommitImpl(Score score, Index index) override {
+        return std::make_unique<SyntheticResultSystem>(std::move(score), std::move(index));
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(SyntheticCalculatedResultSystem);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SyntheticWorkingSystem
+///  \brief         Generates `BranchingFactor` children until `Depth` is
+///                 reached, at which point the children are results.
+///
+class SyntheticWorkingSystem : public Components::WorkingSystem {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+    size_t                                  _childIndex;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using SyntheticConditionPtr             = std::shared_ptr<SyntheticCondition>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            Depth;
+    size_t const                            BranchingFactor;
+    SyntheticConditionPtr const             Condition;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    SyntheticWorkingSystem(size_t depth, size_t branchingFactor, SyntheticConditionPtr pCondition, Components::Score score=Components::Score(), Components::Index index=Components::Index()) :
+        Components::WorkingSystem(std::move(score), std::move(index)),
+        _childIndex(0),
+        Depth(
+            std::move(
+                [&depth](void) -> size_t & {
+                    ENSURE_ARGUMENT(depth);
+                    return depth;
+                }()
+            )
+        ),
+        BranchingFactor(
+            std::move(
+                [&branchingFactor](void) -> size_t & {
+                    ENSURE_ARGUMENT(branchingFactor);
+                    return branchingFactor;
+                }()
+            )
+        ),
+        Condition(
+            std::move(
+                [&pCondition](void) -> SyntheticConditionPtr & {
+                    ENSURE_ARGUMENT(pCondition);
+                    return pCondition;
+                }()
+            )
+        )
+    {}
+
+#define ARGS                                MEMBERS(_childIndex, Depth, BranchingFactor, Condition), BASES(Components::WorkingSystem)
+
+    NON_COPYABLE(SyntheticWorkingSystem);
+    MOVE(SyntheticWorkingSystem, ARGS);
+    COMPARE(SyntheticWorkingSystem, ARGS);
+    SERIALIZATION(SyntheticWorkingSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(boost::format("SyntheticWorkingSystem(%s,%s)") % GetScore().ToString() % GetIndex().ToString());
+    }
+
+    bool IsComplete(void) const override {
+        return _childIndex == BranchingFactor;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    SystemPtrs GenerateChildrenImpl(size_t maxNumChildren, bool) override {
+        size_t                              toGenerate(std::min(BranchingFactor - _childIndex, maxNumChildren));
+        bool const                          isFinal(GetIndex().Depth() + 1 == Depth);
+        SystemPtrs                          results;
+
+        assert(toGenerate);
+
+        while(toGenerate--) {
+            Components::Index               newIndex(GetIndex(), _childIndex);
+            Components::Score               newScore(GetScore(), Condition->Apply(newIndex), isFinal);
+
+            if(isFinal)
+                results.emplace_back(std::make_shared<SyntheticCalculatedResultSystem>(std::move(newScore), std::move(newIndex)));
+            else
+                results.emplace_back(std::make_shared<SyntheticWorkingSystem>(Depth, BranchingFactor, Condition, std::move(newScore).Commit(), std::move(newIndex).Commit()));
+
+            ++_childIndex;
+        }
+
+        return results;
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(SyntheticWorkingSystem);
+
+class BenchmarkConfiguration : public LocalExecution::Configuration {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            MaxNumPendingSystems;
+    size_t const                            MaxNumChildrenPerGeneration;
+    size_t const                            MaxNumIterationsPerRound;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    BenchmarkConfiguration(size_t numThreads, size_t maxNumPendingSystems, size_t maxNumChildrenPerGeneration, size_t maxNumIterationsPerRound) :
+        LocalExecution::Configuration(false, true, std::move(numThreads)),
+        MaxNumPendingSystems(std::move(maxNumPendingSystems)),
+        MaxNumChildrenPerGeneration(std::move(maxNumChildrenPerGeneration)),
+        MaxNumIterationsPerRound(std::move(maxNumIterationsPerRound))
+    {}
+
+#define ARGS                                MEMBERS(MaxNumPendingSystems, MaxNumChildrenPerGeneration, MaxNumIterationsPerRound), BASES(LocalExecution::Configuration)
+
+    NON_COPYABLE(BenchmarkConfiguration);
+    MOVE(BenchmarkConfiguration, ARGS);
+    COMPARE(BenchmarkConfiguration, ARGS);
+    SERIALIZATION(BenchmarkConfiguration, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(LocalExecution::Configuration)));
+
+#undef ARGS
+
+    size_t GetMaxNumPendingSystems(void) const override { return MaxNumPendingSystems; }
+    size_t GetMaxNumPendingSystems(WorkingSystem const &) const override { return MaxNumPendingSystems; }
+    size_t GetMaxNumChildrenPerGeneration(WorkingSystem const &) const override { return MaxNumChildrenPerGeneration; }
+    size_t GetMaxNumIterationsPerRound(WorkingSystem const &) const override { return MaxNumIterationsPerRound; }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         BenchmarkObserver
+///  \brief         Counts generated systems, records the time of the first
+///                 result, and collects statistics; all other events are
+///                 skipped.
+///
+class BenchmarkObserver : public LocalExecution::Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            MaxNumResults;
+    std::chrono::steady_clock::time_point const         Start;
+
+    std::atomic<size_t>                     NumGeneratedSystems;
+    std::atomic<size_t>                     NumResults;
+    std::atomic<std::int64_t>               FirstResultNanoseconds;
+
+    LocalExecution::Engine::Statistics      Statistics;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    BenchmarkObserver(size_t maxNumResults) :
+        MaxNumResults(maxNumResults),
+        Start(std::chrono::steady_clock::now()),
+        NumGeneratedSystems(0),
+        NumResults(0),
+        FirstResultNanoseconds(-1)
+    {}
+
+    ~BenchmarkObserver(void) override = default;
+
+    NON_COPYABLE(BenchmarkObserver);
+    NON_MOVABLE(BenchmarkObserver);
+
+    EventFlagValue GetEventFlags(void) const override { return EventFlagValue::IterationGenerate | EventFlagValue::Statistics; }
+
+    bool OnRoundBegin(size_t, SystemPtrs const &) override { return true; }
+    void OnRoundEnd(size_t, SystemPtrs const &) override {}
+    bool OnRoundMergingWork(size_t, SystemPtrsContainer const &) override { return true; }
+    void OnRoundMergedWork(size_t, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnTaskBegin(size_t, size_t, size_t) override { return true; }
+    void OnTaskEnd(size_t, size_t, size_t) override {}
+    void OnTaskError(size_t, size_t, size_t, std::exception const &ex) override { throw std::runtime_error(ex.what()); }
+    bool OnIterationBegin(size_t, size_t, size_t, size_t, size_t) override { return true; }
+    void OnIterationEnd(size_t, size_t, size_t, size_t, size_t) override {}
+    bool OnIterationGeneratingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &) override { return true; }
+    bool OnIterationMergingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { return true; }
+    void OnIterationMergedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnIterationFailedSystems(size_t, size_t, size_t, size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { return true; }
+
+    void OnIterationGeneratedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &generated) override {
+        NumGeneratedSystems += generated.size();
+    }
+
+    bool OnIterationResultSystems(size_t, size_t, size_t, size_t, size_t, ResultSystemUniquePtrs results) override {
+        std::int64_t                        expected(-1);
+
+        FirstResultNanoseconds.compare_exchange_strong(
+            expected,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count()
+        );
+
+        return (NumResults += results.size()) < MaxNumResults;
+    }
+
+    void OnStatistics(LocalExecution::Engine::Statistics const &statistics) override {
+        Statistics = statistics;
+    }
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+void Usage(void) {
+    std::cerr
+        << "Runs synthetic problems through LocalExecution::Engine::Execute and writes\n"
+        << "throughput, latency-to-first-result, and peak RSS as JSON.\n"
+        << "\n"
+        << "Values may be comma-delimited to define a parameter sweep.\n"
+        << "\n"
+        << "    --depth=<n>                     Depth of the tree [5]\n"
+        << "    --branching=<n>                 Children generated by each working system [10]\n"
+        << "    --failure-ratio=<0.0-1.0>       Ratio of children that fail [0.1]\n"
+        << "    --threads=<n>                   Number of concurrent tasks [1]\n"
+        << "    --pending-cap=<n>               Maximum number of pending systems [10000]\n"
+        << "    --children-per-generation=<n>   Maximum children generated per call; 0 for all [0]\n"
+        << "    --iterations-per-round=<n>      Maximum iterations per round [10]\n"
+        << "\n"
+        << "    --max-results=<n>               Stop after this many results [1]\n"
+        << "    --timeout=<seconds>             Stop after this many seconds; 0 for no timeout [0]\n"
+        << "    --repetitions=<n>               Number of times to run each configuration [5]\n"
+        << "    --seed=<n>                      Seed used to create the problem [1]\n"
+        << "    --output=<filename>             Write JSON to a file rather than stdout\n"
+        << "\n";
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Entry Point
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    try {
+        Benchmarks::Arguments               args(argc, argv);
+
+        if(args.Has("help")) {
+            Usage();
+            return 0;
+        }
+
+        std::vector<std::vector<double>> const          sweep{
+            args.GetValues<double>("depth", { 5 }),
+            args.GetValues<double>("branching", { 10 }),
+            args.GetValues<double>("failure-ratio", { 0.1 }),
+            args.GetValues<double>("threads", { 1 }),
+            args.GetValues<double>("pending-cap", { 10000 })
+        };
+
+        size_t const                        childrenPerGeneration(args.GetValue<size_t>("children-per-generation", 0));
+        size_t const                        iterationsPerRound(args.GetValue<size_t>("iterations-per-round", 10));
+        size_t const                        maxNumResults(args.GetValue<size_t>("max-results", 1));
+        double const                        timeoutSeconds(args.GetValue<double>("timeout", 0));
+        size_t const                        repetitions(args.GetValue<size_t>("repetitions", 5));
+        std::uint64_t const                 seed(args.GetValue<std::uint64_t>("seed", 1));
+        std::string const                   output(args.GetValue<std::string>("output", std::string()));
+
+        args.EnsureAllUsed();
+
+        if(repetitions == 0 || maxNumResults == 0 || iterationsPerRound == 0)
+            throw std::invalid_argument("'--repetitions', '--max-results', and '--iterations-per-round' must be greater than 0");
+
+        std::optional<std::chrono::steady_clock::duration> const            timeout(
+            [&timeoutSeconds](void) -> std::optional<std::chrono::steady_clock::duration> {
+                if(timeoutSeconds <= 0)
+                    return std::nullopt;
+
+                return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeoutSeconds));
+            }()
+        );
+
+        Benchmarks::Report                  report("Engine");
+
+        Benchmarks::ForEachCombination(
+            sweep,
+            [&](std::vector<double> const &values) {
+                size_t const                depth(static_cast<size_t>(values[0]));
+                size_t const                branching(static_cast<size_t>(values[1]));
+                float const                 failureRatio(static_cast<float>(values[2]));
+                size_t const                threads(static_cast<size_t>(values[3]));
+                size_t const                pendingCap(static_cast<size_t>(values[4]));
+
+                Benchmarks::Metric          throughput{ "throughput", "systems/s", true, {} };
+                Benchmarks::Metric          firstResult{ "latency_to_first_result", "s", false, {} };
+                Benchmarks::Metric          elapsed{ "elapsed", "s", false, {} };
+                Benchmarks::Metric          peakRss{ "peak_rss", "bytes", false, {} };
+                Benchmarks::Metric          numResults{ "results", "systems", true, {} };
+                Benchmarks::Metrics         phases;
+
+                for(size_t phase = 0; phase < LocalExecution::Engine::Statistics::NumPhases; ++phase)
+                    phases.emplace_back(
+                        Benchmarks::Metric{
+                            std::string("phase_") + LocalExecution::Engine::Statistics::ToString(static_cast<LocalExecution::Engine::Statistics::PhaseValue>(phase)),
+                            "s",
+                            false,
+                            {}
+                        }
+                    );
+
+                for(size_t repetition = 0; repetition < repetitions; ++repetition) {
+                    Benchmarks::ResetPeakRss();
+
+                    BenchmarkConfiguration                      config(threads, pendingCap, childrenPerGeneration ? childrenPerGeneration : branching, iterationsPerRound);
+                    SyntheticWorkingSystem                      initial(depth, branching, SyntheticCondition::Create(seed, failureRatio));
+                    BenchmarkObserver                           observer(maxNumResults);
+
+                    LocalExecution::Engine::Execute(config, observer, initial, timeout);
+
+                    double const            seconds(Benchmarks::ToSeconds(std::chrono::steady_clock::now() - observer.Start));
+
+                    throughput.Values.emplace_back(static_cast<double>(observer.NumGeneratedSystems) / seconds);
+                    firstResult.Values.emplace_back(observer.FirstResultNanoseconds < 0 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(observer.FirstResultNanoseconds) / 1e9);
+                    elapsed.Values.emplace_back(seconds);
+                    peakRss.Values.emplace_back(static_cast<double>(Benchmarks::GetPeakRssBytes()));
+                    numResults.Values.emplace_back(static_cast<double>(observer.NumResults));
+
+                    for(size_t phase = 0; phase < phases.size(); ++phase)
+                        phases[phase].Values.emplace_back(static_cast<double>(observer.Statistics.PhaseNanoseconds[phase]) / 1e9);
+                }
+
+                Benchmarks::Metrics         metrics{ std::move(throughput), std::move(firstResult), std::move(elapsed), std::move(peakRss), std::move(numResults) };
+
+                // Phase timings are only available when statistics are compiled in
+                if(LocalExecution::Engine::Statistics::IsEnabled)
+                    std::move(phases.begin(), phases.end(), std::back_inserter(metrics));
+
+                report.Add(
+                    Benchmarks::Parameters{
+                        { "depth", std::to_string(depth) },
+                        { "branching", std::to_string(branching) },
+                        { "failure_ratio", boost::str(boost::format("%1%") % failureRatio) },
+                        { "threads", std::to_string(threads) },
+                        { "pending_cap", std::to_string(pendingCap) }
+                    },
+                    std::move(metrics)
+                );
+            }
+        );
+
+        report.Write(output);
+        return 0;
+    }
+    catch(std::exception const &ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n\n";
+        Usage();
+        return -1;
+    }
+}
@@ -21,6 +21,7 @@
 /////////////////////////////////////////////////////////////////////////
 #include "Configuration.h"
 
+#include <DecisionEngine/Core/Components/EngineImpl.h>
 #include <DecisionEngine/Core/Components/ResultSystem.h>
 
 namespace DecisionEngine {
@@ -49,6 +50,41 @@ Configuration::Configuration(
     )
 {}
 
+// virtual
+boost::optional<size_t> Configuration::GetMaxNumPendingSystemBytes(void) const {
+    return boost::none;
+}
+
+// virtual
+std::filesystem::path Configuration::GetPendingSystemsSpillDirectory(void) const {
+    return std::filesystem::temp_directory_path();
+}
+
+// virtual
+boost::optional<std::filesystem::path> Configuration::GetTraceFilename(void) const {
+    return boost::none;
+}
+
+// virtual
+Components::EngineImpl::EventFlagValue Configuration::GetTraceEventFlags(void) const {
+    return Components::EngineImpl::EventFlagValue::All;
+}
+
+// virtual
+boost::optional<std::filesystem::path> Configuration::GetCheckpointFilename(void) const {
+    return boost::none;
+}
+
+// virtual
+std::chrono::steady_clock::duration Configuration::GetCheckpointInterval(void) const {
+    return std::chrono::minutes(5);
+}
+
+// virtual
+bool Configuration::IsNumaAware(void) const {
+    return false;
+}
+
 // virtual
 Configuration::ResultSystemUniquePtrs Configuration::Finalize(ResultSystemUniquePtrs results) {
     // Don't do anything by default
@@ -23,6 +23,8 @@
 
 #include "LocalExecution.h"
 
+#include <chrono>
+
 namespace DecisionEngine {
 namespace Core {
 
@@ -33,6 +35,12 @@ namespace Components {
 class ResultSystem;
 class WorkingSystem;
 
+namespace EngineImpl {
+
+enum class EventFlagValue : std::uint32_t;
+
+} // namespace EngineImpl
+
 } // namespace Components
 
 namespace LocalExecution {
@@ -95,6 +103,59 @@ public:
     virtual size_t GetMaxNumChildrenPerGeneration(WorkingSystem const &system) const = 0;
     virtual size_t GetMaxNumIterationsPerRound(WorkingSystem const &system) const = 0;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetMaxNumPendingSystemBytes
+    ///  \brief         Returns the approximate number of bytes that pending systems
+    ///                 may consume in memory. Lower-ranked systems that exceed this
+    ///                 budget are spilled to a file in `GetPendingSystemsSpillDirectory`
+    ///                 and restored once they rise to the front. No budget is
+    ///                 enforced by default.
+    ///
+    virtual boost::optional<size_t> GetMaxNumPendingSystemBytes(void) const;
+
+    virtual std::filesystem::path GetPendingSystemsSpillDirectory(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetTraceFilename
+    ///  \brief         Returns the name of a file that will be populated with
+    ///                 Chrome trace-event JSON describing the rounds, tasks, and
+    ///                 iterations executed (see `TraceObserver`). Tracing is
+    ///                 disabled by default.
+    ///
+    virtual boost::optional<std::filesystem::path> GetTraceFilename(void) const;
+
+    /// Returns the events recorded when tracing is enabled; all events are
+    /// recorded by default.
+    virtual Components::EngineImpl::EventFlagValue GetTraceEventFlags(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetCheckpointFilename
+    ///  \brief         Returns the name of a file that will be periodically
+    ///                 populated with the state of an in-progress search (the
+    ///                 pending systems, round, fingerprinter state, and results
+    ///                 found so far); the search can be continued from this file
+    ///                 via `Engine::Resume`. The file is removed once the search
+    ///                 completes. Checkpointing is disabled by default.
+    ///
+    virtual boost::optional<std::filesystem::path> GetCheckpointFilename(void) const;
+
+    /// Minimum amount of time between checkpoints; checkpoints are only
+    /// written between rounds.
+    virtual std::chrono::steady_clock::duration GetCheckpointInterval(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            IsNumaAware
+    ///  \brief         Returns true if the threads that execute tasks should be
+    ///                 pinned to the CPUs of a NUMA node (see `NumaTopology`;
+    ///                 each thread is pinned once), where systems generated by
+    ///                 a task on one node are processed by tasks on the same node
+    ///                 in subsequent rounds. Systems are only assigned to tasks
+    ///                 on another node when their node doesn't have a task
+    ///                 available. The systems processed in each round are the
+    ///                 same regardless of this setting. Disabled by default.
+    ///
+    virtual bool IsNumaAware(void) const;
+
     /////////////////////////////////////////////////////////////////////////
     ///  \fn            Finalize
     ///  \brief         Opportunity to modify the results before they are returned.
@@ -21,11 +21,21 @@
 /////////////////////////////////////////////////////////////////////////
 #include "Engine.h"
 #include "FingerprinterFactory.h"
+#include "NumaTopology.h"
+#include "TraceObserver.h"
 
 #include <DecisionEngine/Core/Components/CalculatedWorkingSystem.h>
 #include <DecisionEngine/Core/Components/Fingerprinter.h>
+#include <DecisionEngine/Core/Components/PendingSystemStore.h>
 #include <DecisionEngine/Core/Components/WorkingSystem.h>
 
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
 namespace DecisionEngine {
 namespace Core {
 namespace LocalExecution {
@@ -43,6 +53,324 @@ namespace Details {
 // ----------------------------------------------------------------------
 namespace {
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         Checkpoint
+///  \brief         Writes the state of an in-progress search to a file so
+///                 that it can be continued via `Resume`.
+///
+///                 Results are consumed by the observer once they are
+///                 delivered, so they are serialized as they are found and
+///                 retained until the search completes.
+///
+class Checkpoint {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SerializedResults                 = std::vector<std::string>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::filesystem::path const             Filename;
+    std::chrono::steady_clock::duration const           Interval;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    Checkpoint(std::filesystem::path filename, std::chrono::steady_clock::duration interval) :
+        Filename(
+            std::move(
+                [&filename](void) -> std::filesystem::path & {
+                    ENSURE_ARGUMENT(filename, filename.empty() == false);
+                    return filename;
+                }()
+            )
+        ),
+        Interval(std::move(interval)),
+        _lastWriteTime(std::chrono::steady_clock::now())
+    {}
+
+    NON_COPYABLE(Checkpoint);
+    NON_MOVABLE(Checkpoint);
+
+    /// Adds results that have been found; this method is thread safe.
+    void AddResults(ResultSystemUniquePtrs const &results) {
+        std::string                         serialized(Serialize(results));
+        std::scoped_lock<decltype(_resultsMutex)>       lock(_resultsMutex); UNUSED(lock);
+
+        _results.emplace_back(std::move(serialized));
+    }
+
+    /// Adds results that were read from a previous checkpoint.
+    void AddResults(SerializedResults results) {
+        std::scoped_lock<decltype(_resultsMutex)>       lock(_resultsMutex); UNUSED(lock);
+
+        std::move(results.begin(), results.end(), std::back_inserter(_results));
+    }
+
+    bool IsWriteRequired(void) const {
+        return std::chrono::steady_clock::now() - _lastWriteTime >= Interval;
+    }
+
+    /// Writes the checkpoint; must not be called while tasks are executing.
+    /// The file is written to a temporary location and then renamed so that
+    /// a valid checkpoint is always available, even if the process is
+    /// terminated while writing.
+    void Write(
+        size_t round,
+        Components::Fingerprinter const &fingerprinter,
+        SystemPtrs const &pending,
+        Components::PendingSystemStore const *pPendingStore
+    ) {
+        std::filesystem::path               tempFilename(Filename);
+
+        tempFilename += ".tmp";
+
+        {
+            std::ofstream                   stream(tempFilename, std::ios::binary | std::ios::trunc);
+
+            if(stream.is_open() == false)
+                throw std::runtime_error("Invalid checkpoint file");
+
+            {
+                boost::archive::binary_oarchive         archive(stream);
+                std::string const           header(Header);
+
+                archive << header;
+                archive << round;
+
+                {
+                    std::ostringstream      fingerprinterStream;
+
+                    fingerprinter.SaveState(fingerprinterStream);
+                    archive << fingerprinterStream.str();
+                }
+
+                archive << _results;
+
+                // Pending systems are written in sorted runs so that those that
+                // have been spilled to disk don't need to be restored. Each run
+                // is written with its own archive, as spilled runs are destroyed
+                // once they have been written and the address of a destroyed
+                // System may be reused by a System in a later run (which would
+                // be written as a reference to the earlier one).
+                bool                        hasRun(true);
+
+                archive << hasRun;
+                archive << SerializeRun(pending);
+
+                if(pPendingStore) {
+                    pPendingStore->EnumSpilledSystems(
+                        [&archive, &hasRun](SystemPtrs run) {
+                            archive << hasRun;
+                            archive << SerializeRun(run);
+                        }
+                    );
+                }
+
+                hasRun = false;
+                archive << hasRun;
+            }
+
+            stream.flush();
+
+            if(stream.good() == false)
+                throw std::runtime_error("Invalid checkpoint file");
+        }
+
+        std::filesystem::rename(tempFilename, Filename);
+        _lastWriteTime = std::chrono::steady_clock::now();
+    }
+
+    /// Removes the checkpoint once the search has completed.
+    void Remove(void) {
+        std::error_code                     ec;
+
+        std::filesystem::remove(Filename, ec);
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Read
+    ///  \brief         Reads a checkpoint, restoring the fingerprinter state and
+    ///                 populating `pending` (which will be sorted). Runs are
+    ///                 spilled as they are read when a pending store is
+    ///                 provided. Returns the round at which the search should
+    ///                 continue and the serialized results.
+    ///
+    static std::tuple<size_t, SerializedResults> Read(
+        std::filesystem::path const &filename,
+        Components::Fingerprinter &fingerprinter,
+        SystemPtrs &pending,
+        Components::PendingSystemStore *pPendingStore
+    ) {
+        std::ifstream                       stream(filename, std::ios::binary);
+
+        if(stream.is_open() == false)
+            throw std::runtime_error("Invalid checkpoint file");
+
+        try {
+            boost::archive::binary_iarchive archive(stream);
+            std::string                     header;
+
+            archive >> header;
+
+            if(header != Header)
+                throw std::runtime_error("Invalid checkpoint file");
+
+            size_t                          round;
+            SerializedResults               results;
+
+            archive >> round;
+
+            {
+                std::string                 fingerprinterState;
+
+                archive >> fingerprinterState;
+
+                std::istringstream          fingerprinterStream(fingerprinterState);
+
+                fingerprinter.LoadState(fingerprinterStream);
+            }
+
+            archive >> results;
+
+            pending.clear();
+
+            while(true) {
+                bool                        hasRun;
+
+                archive >> hasRun;
+
+                if(hasRun == false)
+                    break;
+
+                std::string                 serializedRun;
+
+                archive >> serializedRun;
+
+                SystemPtrs                  run(DeserializeRun(serializedRun));
+
+                if(std::any_of(run.cbegin(), run.cend(), [](SystemPtr const &ptr) { return static_cast<bool>(ptr) == false; }))
+                    throw std::runtime_error("Invalid checkpoint file");
+
+                SystemPtrs                  merged;
+
+                std::merge(
+                    std::make_move_iterator(pending.begin()),
+                    std::make_move_iterator(pending.end()),
+                    std::make_move_iterator(run.begin()),
+                    std::make_move_iterator(run.end()),
+                    std::back_inserter(merged),
+                    Components::EngineImpl::Sorter
+                );
+
+                pending = std::move(merged);
+
+                if(pPendingStore)
+                    pPendingStore->Spill(pending);
+            }
+
+            return std::make_tuple(std::move(round), std::move(results));
+        }
+        catch(boost::archive::archive_exception const &) {
+            throw std::runtime_error("Invalid checkpoint file");
+        }
+    }
+
+    static ResultSystemUniquePtrs Deserialize(std::string const &serialized) {
+        std::istringstream                  stream(serialized);
+        boost::archive::binary_iarchive     archive(stream);
+        size_t                              numResults;
+        ResultSystemUniquePtrs              results;
+
+        archive >> numResults;
+
+        while(numResults--) {
+            Components::System *            pSystem(nullptr);
+
+            archive >> pSystem;
+
+            std::unique_ptr<Components::System>         pOwner(pSystem);
+            Components::ResultSystem * const            pResult(dynamic_cast<Components::ResultSystem *>(pSystem));
+
+            if(pResult == nullptr)
+                throw std::runtime_error("Invalid checkpoint file");
+
+            pOwner.release();
+            results.emplace_back(pResult);
+        }
+
+        return results;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static char const * const               Header;
+
+    std::mutex                              _resultsMutex;
+    SerializedResults                       _results;
+
+    std::chrono::steady_clock::time_point   _lastWriteTime;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static std::string Serialize(ResultSystemUniquePtrs const &results) {
+        std::ostringstream                  stream;
+
+        {
+            boost::archive::binary_oarchive archive(stream);
+            size_t const                    numResults(results.size());
+
+            archive << numResults;
+
+            for(ResultSystemUniquePtr const &pResult : results) {
+                Components::System const *  pSystem(pResult.get());
+
+                archive << pSystem;
+            }
+        }
+
+        return stream.str();
+    }
+
+    static std::string SerializeRun(SystemPtrs const &run) {
+        std::ostringstream                  stream;
+
+        {
+            boost::archive::binary_oarchive archive(stream);
+
+            archive << run;
+        }
+
+        return stream.str();
+    }
+
+    static SystemPtrs DeserializeRun(std::string const &serialized) {
+        std::istringstream                  stream(serialized);
+        boost::archive::binary_iarchive     archive(stream);
+        SystemPtrs                          run;
+
+        archive >> run;
+        return run;
+    }
+};
+
+char const * const Checkpoint::Header = "DecisionEngine.Checkpoint.1";
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TaskObserver
 ///  \brief         Observer for the events associated with a single task.
@@ -55,6 +383,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     ResultObserver &                        _observer;
+    Checkpoint * const                      _pCheckpoint;
     size_t const                            _round;
     size_t const                            _task;
     size_t const                            _numTasks;
@@ -68,11 +397,13 @@ public:
     // ----------------------------------------------------------------------
     TaskObserver(
         ResultObserver &observer,
+        Checkpoint *pCheckpoint,
         size_t round,
         size_t task,
         size_t numTasks
     ) :
         _observer(observer),
+        _pCheckpoint(pCheckpoint),
         _round(std::move(round)),
         _task(std::move(task)),
         _numTasks(std::move(numTasks)),
@@ -83,7 +414,7 @@ public:
 
     NON_COPYABLE(TaskObserver);
 
-#define ARGS                                MEMBERS(_observer, _round, _task, _numTasks)
+#define ARGS                                MEMBERS(_observer, _pCheckpoint, _round, _task, _numTasks)
 
     MOVE(TaskObserver, ARGS, FLAGS(MOVE_NO_ASSIGNMENT))
 
@@ -94,6 +425,10 @@ public:
     }
 
     // EngineImpl::Observer Methods
+    EventFlagValue GetEventFlags(void) const override {
+        return _observer.GetEventFlags();
+    }
+
     bool OnBegin(size_t iteration, size_t maxIterations) override {
         if(_observer.OnIterationBegin(_round, _task, _numTasks, iteration, maxIterations) == false) {
             _isCancelled = true;
@@ -145,6 +480,9 @@ public:
     bool OnSuccessfulSystems(size_t iteration, size_t maxIterations, ResultSystemUniquePtrs results) override {
         assert(results.empty() == false);
 
+        if(_pCheckpoint)
+            _pCheckpoint->AddResults(results);
+
         if(_observer.OnIterationResultSystems(_round, _task, _numTasks, iteration, maxIterations, std::move(results)) == false) {
             _isCancelled = true;
             return false;
@@ -162,17 +500,167 @@ public:
 // |
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+/// The NUMA node of the task that generated a pending system. Systems are
+/// identified by their owner rather than their address, so a system created at
+/// the address of a destroyed system isn't associated with its node.
+using SystemNodeMap                         = std::map<std::weak_ptr<Components::System>, size_t, std::owner_less<>>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            AssignNumaTaskSystems
+///  \brief         Removes `numTasks` systems from the front of `pending` and
+///                 assigns each to a task, where task `n` runs on node
+///                 `n % numNodes`. Systems are assigned to a task on the node
+///                 that generated them when one is available; the remaining
+///                 systems are assigned to the remaining tasks in order.
+///
+std::vector<SystemPtr> AssignNumaTaskSystems(SystemPtrs &pending, size_t numTasks, size_t numNodes, SystemNodeMap &systemNodes) {
+    assert(numTasks <= pending.size());
+    assert(numNodes);
+
+    std::vector<SystemPtr>                  results(numTasks);
+    std::vector<SystemPtr>                  unassigned;
+
+    while(numTasks--) {
+        SystemPtr                           pSystem(std::move(pending.front()));
+
+        pending.pop_front();
+
+        SystemNodeMap::const_iterator const iter(systemNodes.find(pSystem));
+
+        if(iter != systemNodes.end()) {
+            size_t const                    node(iter->second);
+
+            systemNodes.erase(iter);
+
+            for(size_t taskIndex = node; taskIndex < results.size(); taskIndex += numNodes) {
+                if(!results[taskIndex]) {
+                    results[taskIndex] = std::move(pSystem);
+                    break;
+                }
+            }
+        }
+
+        if(pSystem)
+            unassigned.emplace_back(std::move(pSystem));
+    }
+
+    std::vector<SystemPtr>::iterator        iter(unassigned.begin());
+
+    for(SystemPtr &pSystem : results) {
+        if(!pSystem) {
+            assert(iter != unassigned.end());
+            pSystem = std::move(*iter++);
+        }
+    }
+
+    return results;
+}
+
+/// Returns the node that the calling pool thread is pinned to; the thread is
+/// pinned the first time that it is called and remains pinned for its lifetime.
+size_t GetPoolThreadNode(NumaTopology const &topology, std::atomic<size_t> &nextNode) {
+    thread_local std::optional<size_t>      node;
+
+    if(!node) {
+        node = nextNode++ % topology.NumNodes();
+        topology.PinThread(*node);
+    }
+
+    return *node;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ExecuteNumaTasks
+///  \brief         Executes the tasks on the pool, where each pool thread is
+///                 pinned to a node once (see `GetPoolThreadNode`). Rather than
+///                 executing the task that it was given, each invocation
+///                 claims the first unclaimed task assigned to the node of its
+///                 thread (task `n` is assigned to node `n % numNodes`), or
+///                 the first unclaimed task when there isn't one. Returns the
+///                 results of each task and the node that each task executed
+///                 on.
+///
+///                 The calling thread may also execute tasks; it is only
+///                 pinned while a task executes, as it doesn't belong to the
+///                 pool.
+///
+template <typename TaskArgsT, typename ExecuteTaskFuncT>
+std::tuple<SystemPtrsContainer, std::vector<size_t>> ExecuteNumaTasks(
+    Components::ThreadPool &pool,
+    NumaTopology const &topology,
+    std::atomic<size_t> &nextNode,
+    std::vector<TaskArgsT> const &allTaskArgs,
+    ExecuteTaskFuncT const &executeTaskFunc
+) {
+    size_t const                            numNodes(topology.NumNodes());
+    std::thread::id const                   callingThreadId(std::this_thread::get_id());
+
+    std::mutex                              claimMutex;
+    std::vector<bool>                       isClaimed(allTaskArgs.size(), false);
+
+    SystemPtrsContainer                     results(allTaskArgs.size());
+    std::vector<size_t>                     taskNodes(allTaskArgs.size());
+
+    pool.parallel(
+        allTaskArgs.begin(),
+        allTaskArgs.end(),
+        [&](TaskArgsT const &) {
+            std::optional<size_t>           node;
+
+            if(std::this_thread::get_id() != callingThreadId)
+                node = GetPoolThreadNode(topology, nextNode);
+
+            size_t                          taskIndex(isClaimed.size());
+
+            {
+                std::scoped_lock<decltype(claimMutex)>  lock(claimMutex); UNUSED(lock);
+
+                if(node) {
+                    for(size_t index = *node; index < isClaimed.size(); index += numNodes) {
+                        if(isClaimed[index] == false) {
+                            taskIndex = index;
+                            break;
+                        }
+                    }
+                }
+
+                if(taskIndex == isClaimed.size())
+                    taskIndex = static_cast<size_t>(std::find(isClaimed.begin(), isClaimed.end(), false) - isClaimed.begin());
+
+                assert(taskIndex < isClaimed.size());
+                isClaimed[taskIndex] = true;
+            }
+
+            std::optional<NumaTopology::ScopedThreadAffinity>           affinity;
+
+            if(!node) {
+                node = taskIndex % numNodes;
+                affinity.emplace(topology, *node);
+            }
+
+            taskNodes[taskIndex] = *node;
+            results[taskIndex] = std::apply(executeTaskFunc, allTaskArgs[taskIndex]);
+        }
+    );
+
+    return std::make_tuple(std::move(results), std::move(taskNodes));
+}
+
 // ----------------------------------------------------------------------
 ExecuteResultValue DeterministicExecuteImpl(
     Configuration &config,
     ResultObserver &observer,
     SystemPtrs pending,
-    std::optional<std::chrono::steady_clock::duration> const &timeout
+    std::filesystem::path const *pResumeFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout,
+    Statistics *pStatistics
 ) {
     // ----------------------------------------------------------------------
     using Fingerprinter                                 = Components::Fingerprinter;
 
-    using ProcessWorkingItemsFuncArgs                   = std::tuple<size_t, size_t, size_t, SystemPtr>;
+    using ProcessWorkingItemsFuncArgs                   = std::tuple<size_t, size_t, size_t, SystemPtr, Statistics *>;
     using ProcessWorkingItemsFuncArgsContainer          = std::vector<ProcessWorkingItemsFuncArgs>;
     // ----------------------------------------------------------------------
 
@@ -210,6 +698,30 @@ ExecuteResultValue DeterministicExecuteImpl(
         }()
     );
 
+    // Events that the observer isn't interested in are skipped
+    EventFlagValue const                    eventFlags(observer.GetEventFlags());
+    bool const                              notifyRound(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::Round));
+    bool const                              notifyRoundMerge(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::RoundMerge));
+    bool const                              notifyTask(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::Task));
+    bool const                              notifyTaskError(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::TaskError));
+
+    // Tasks are pinned to NUMA nodes (if requested)
+    NumaTopology const * const              pNumaTopology(config.IsNumaAware() ? &NumaTopology::Get() : nullptr);
+    SystemNodeMap                           systemNodes;
+    std::atomic<size_t>                     nextPoolThreadNode(0);
+
+    // Create the checkpoint (if any)
+    std::unique_ptr<Checkpoint>             pCheckpoint(
+        [&config](void) -> std::unique_ptr<Checkpoint> {
+            boost::optional<std::filesystem::path>      filename(config.GetCheckpointFilename());
+
+            if(!filename)
+                return std::unique_ptr<Checkpoint>();
+
+            return std::make_unique<Checkpoint>(std::move(*filename), config.GetCheckpointInterval());
+        }()
+    );
+
     // Create the function used to process working systems
     std::atomic<bool>                       isCancelled(false);
     auto const                              executeTaskFunc(
@@ -217,19 +729,28 @@ ExecuteResultValue DeterministicExecuteImpl(
             &config,
             &observer,
             &fingerprinter,
-            &isCancelled
+            &pCheckpoint,
+            &isCancelled,
+            notifyTask,
+            notifyTaskError
         ](
             size_t round,
             size_t taskIndex,
             size_t numTasks,
-            SystemPtr pSystem
+            SystemPtr pSystem,
+            Statistics *pTaskStatistics
         ) -> SystemPtrs {
             assert(pSystem->Type == Components::System::TypeValue::Working);
 
             WorkingSystemPtr                pWorkingSystem(
-                [&pSystem](void) {
+                [&pSystem, &pTaskStatistics](void) {
+                    UNUSED(pTaskStatistics);
+
                     if(pSystem->Completion == Components::System::CompletionValue::Calculated) {
                         assert(std::dynamic_pointer_cast<Components::CalculatedWorkingSystem>(pSystem));
+
+                        DECISION_ENGINE_STATISTICS_PHASE(pTaskStatistics, Commit);
+
                         return std::static_pointer_cast<Components::CalculatedWorkingSystem>(pSystem)->Commit();
                     }
                     else if(pSystem->Completion == Components::System::CompletionValue::Concrete) {
@@ -243,14 +764,15 @@ ExecuteResultValue DeterministicExecuteImpl(
             );
             assert(pWorkingSystem);
 
-            if(observer.OnTaskBegin(round, taskIndex, numTasks) == false)
+            if(notifyTask && observer.OnTaskBegin(round, taskIndex, numTasks) == false)
                 return SystemPtrs();
 
-            FINALLY([&observer, round, taskIndex, numTasks](void) { observer.OnTaskEnd(round, taskIndex, numTasks); });
+            FINALLY([&observer, round, taskIndex, numTasks, notifyTask](void) { if(notifyTask) observer.OnTaskEnd(round, taskIndex, numTasks); });
 
             try {
                 TaskObserver                taskObserver(
                     observer,
+                    pCheckpoint.get(),
                     round,
                     taskIndex,
                     numTasks
@@ -264,7 +786,9 @@ ExecuteResultValue DeterministicExecuteImpl(
                         config.GetMaxNumChildrenPerGeneration(*pWorkingSystem),
                         config.GetMaxNumIterationsPerRound(*pWorkingSystem),
                         config.ContinueProcessingSystemsWithFailures,
-                        std::move(pWorkingSystem)
+                        std::move(pWorkingSystem),
+                        std::nullopt,
+                        pTaskStatistics
                     )
                 );
 
@@ -274,7 +798,9 @@ ExecuteResultValue DeterministicExecuteImpl(
                 return results;
             }
             catch(std::exception const &ex) {
-                observer.OnTaskError(round, taskIndex, numTasks, ex);
+                if(notifyTaskError)
+                    observer.OnTaskError(round, taskIndex, numTasks, ex);
+
                 return SystemPtrs();
             }
         }
@@ -285,6 +811,18 @@ ExecuteResultValue DeterministicExecuteImpl(
         }
     );
 
+    // Create the store used to enforce the pending memory budget (if any)
+    std::unique_ptr<Components::PendingSystemStore> pPendingStore(
+        [&config](void) -> std::unique_ptr<Components::PendingSystemStore> {
+            boost::optional<size_t> const   maxNumBytes(config.GetMaxNumPendingSystemBytes());
+
+            if(!maxNumBytes)
+                return std::unique_ptr<Components::PendingSystemStore>();
+
+            return std::make_unique<Components::PendingSystemStore>(*maxNumBytes, config.GetMaxNumPendingSystems(), config.GetPendingSystemsSpillDirectory());
+        }()
+    );
+
     // Execute the rounds
     Components::ThreadPool                  pool(
         [&config](void) {
@@ -296,19 +834,40 @@ ExecuteResultValue DeterministicExecuteImpl(
     );
     size_t                                  round(0);
 
+    // Continue from the checkpoint (if any)
+    if(pResumeFilename) {
+        Checkpoint::SerializedResults       results;
+
+        std::tie(round, results) = Checkpoint::Read(*pResumeFilename, fingerprinter, pending, pPendingStore.get());
+
+        // Results found before the checkpoint was written are delivered first
+        for(std::string const &serialized : results) {
+            if(observer.OnIterationResultSystems(round, 0, 1, 0, 1, Checkpoint::Deserialize(serialized)) == false) {
+                isCancelled = true;
+                break;
+            }
+        }
+
+        if(pCheckpoint)
+            pCheckpoint->AddResults(std::move(results));
+    }
+
     while(
         isCancelled == false
-        && pending.empty() == false
+        && (pending.empty() == false || (pPendingStore && pPendingStore->empty() == false))
         && hasTimeExpiredFunc() == false
     ) {
         {
-            if(observer.OnRoundBegin(round, pending) == false)
+            if(pPendingStore)
+                pPendingStore->Restore(pending, pool.NumThreads);
+
+            if(notifyRound && observer.OnRoundBegin(round, pending) == false)
                 isCancelled = true;
 
             if(isCancelled)
                 continue;
 
-            FINALLY([&observer, &round, &pending](void) { observer.OnRoundEnd(round, pending); });
+            FINALLY([&observer, &round, &pending, notifyRound](void) { if(notifyRound) observer.OnRoundEnd(round, pending); });
 
             // Create the tasks
             size_t const                    numTasks(std::min(pool.NumThreads, pending.size()));
@@ -319,26 +878,67 @@ ExecuteResultValue DeterministicExecuteImpl(
 
             allTaskArgs.reserve(numTasks);
 
-            for(size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex) {
-                SystemPtr                   pTaskSystem(pending.front());
+            // Each task populates its own statistics; they are combined once
+            // all of the tasks have completed.
+            std::vector<Statistics>         taskStatistics(Statistics::IsEnabled && pStatistics ? numTasks : 0);
+
+            DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumRounds, 1);
+            DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumTasks, numTasks);
 
-                pending.pop_front();
+            std::vector<SystemPtr>          taskSystems(
+                [&pending, &numTasks, &pNumaTopology, &systemNodes](void) {
+                    if(pNumaTopology)
+                        return AssignNumaTaskSystems(pending, numTasks, pNumaTopology->NumNodes(), systemNodes);
+
+                    std::vector<SystemPtr>  results;
+
+                    results.reserve(numTasks);
+
+                    while(results.size() < numTasks) {
+                        results.emplace_back(std::move(pending.front()));
+                        pending.pop_front();
+                    }
+
+                    return results;
+                }()
+            );
+
+            for(size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex) {
+                SystemPtr                   pTaskSystem(std::move(taskSystems[taskIndex]));
 
                 allTaskArgs.emplace_back(
                     ProcessWorkingItemsFuncArgs(
                         round,
                         taskIndex,
                         numTasks,
-                        std::move(pTaskSystem)
+                        std::move(pTaskSystem),
+                        taskStatistics.empty() ? nullptr : &taskStatistics[taskIndex]
                     )
                 );
             }
 
-            // Execute the tasks
-            SystemPtrsContainer             taskResults(pool.parallel(allTaskArgs, executeTaskFuncImpl));
+            // Execute the tasks; when NUMA aware, systems are allocated on the
+            // node of the pinned thread that creates them.
+            SystemPtrsContainer             taskResults;
+
+            if(pNumaTopology) {
+                std::vector<size_t>         taskNodes;
+
+                std::tie(taskResults, taskNodes) = ExecuteNumaTasks(pool, *pNumaTopology, nextPoolThreadNode, allTaskArgs, executeTaskFunc);
+
+                for(size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex) {
+                    for(SystemPtr const &pSystem : taskResults[taskIndex])
+                        systemNodes[pSystem] = taskNodes[taskIndex];
+                }
+            }
+            else
+                taskResults = pool.parallel(allTaskArgs, executeTaskFuncImpl);
 
             assert(taskResults.size() == numTasks);
 
+            for(Statistics const &statistics : taskStatistics)
+                *pStatistics += statistics;
+
             if(pending.empty() == false)
                 taskResults.emplace_back(std::move(pending));
 
@@ -348,30 +948,110 @@ ExecuteResultValue DeterministicExecuteImpl(
             if(hasResults == false)
                 continue;
 
-            if(observer.OnRoundMergingWork(round, taskResults) == false) {
+            if(notifyRoundMerge && observer.OnRoundMergingWork(round, taskResults) == false) {
                 isCancelled = true;
                 continue;
             }
 
             // Merge the results
-            {
+            if(notifyRoundMerge == false) {
+                pending = std::get<0>(
+                    Components::EngineImpl::Merge(
+                        config.GetMaxNumPendingSystems(),
+                        std::move(taskResults),
+                        std::nullopt,
+                        Statistics::IsEnabled ? pStatistics : nullptr
+                    )
+                );
+            }
+            else {
                 SystemPtrsContainer         removed;
 
                 FINALLY([&observer, &round, &pending, &removed](void) { observer.OnRoundMergedWork(round, pending, std::move(removed)); });
 
-                std::tie(pending, removed) = Components::EngineImpl::Merge(config.GetMaxNumPendingSystems(), std::move(taskResults));
+                std::tie(pending, removed) = Components::EngineImpl::Merge(
+                    config.GetMaxNumPendingSystems(),
+                    std::move(taskResults),
+                    std::nullopt,
+                    Statistics::IsEnabled ? pStatistics : nullptr
+                );
+            }
+
+            if(pPendingStore)
+                pPendingStore->Spill(pending);
+
+            // Remove the nodes of systems that have been destroyed (because they
+            // were removed during the merge or spilled to disk)
+            if(systemNodes.size() > pending.size() * 2) {
+                SystemNodeMap::iterator     iter(systemNodes.begin());
+
+                while(iter != systemNodes.end()) {
+                    if(iter->first.expired())
+                        iter = systemNodes.erase(iter);
+                    else
+                        ++iter;
+                }
             }
         }
 
         ++round;
+
+        if(pCheckpoint && isCancelled == false && pCheckpoint->IsWriteRequired())
+            pCheckpoint->Write(round, fingerprinter, pending, pPendingStore.get());
     }
 
-    if(pending.empty())
+    if(pending.empty() && (!pPendingStore || pPendingStore->empty())) {
+        if(pCheckpoint)
+            pCheckpoint->Remove();
+
         return ExecuteResultValue::Completed;
+    }
     else if(isCancelled)
         return ExecuteResultValue::ExitViaObserver;
-    else
-        return ExecuteResultValue::Timeout;
+
+    // Timeouts are only detected between rounds, so the state is consistent and
+    // the search can be continued later.
+    if(pCheckpoint)
+        pCheckpoint->Write(round, fingerprinter, pending, pPendingStore.get());
+
+    return ExecuteResultValue::Timeout;
+}
+
+ExecuteResultValue ExecuteImplImpl(
+    Configuration &config,
+    ResultObserver &observer,
+    SystemPtrs working,
+    std::filesystem::path const *pResumeFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout
+) {
+    auto const                              executeFunc(
+        [&config, &working, &pResumeFilename, &timeout](ResultObserver &thisObserver) {
+            if(config.IsDeterministic == false)
+                throw std::runtime_error("TODO: Need non-deterministic solution");
+
+            // Statistics are only collected when the observer will receive them
+            if(Statistics::IsEnabled == false || Components::EngineImpl::IsSet(thisObserver.GetEventFlags(), EventFlagValue::Statistics) == false)
+                return DeterministicExecuteImpl(config, thisObserver, std::move(working), pResumeFilename, timeout, nullptr);
+
+            Statistics                      statistics;
+            ExecuteResultValue const        result(DeterministicExecuteImpl(config, thisObserver, std::move(working), pResumeFilename, timeout, &statistics));
+
+            thisObserver.OnStatistics(statistics);
+            return result;
+        }
+    );
+
+    boost::optional<std::filesystem::path> const        traceFilename(config.GetTraceFilename());
+
+    if(!traceFilename)
+        return executeFunc(observer);
+
+    TraceObserver                           traceObserver(observer, config.GetTraceEventFlags());
+    ExecuteResultValue const                result(executeFunc(traceObserver));
+
+    traceObserver.Write(*traceFilename);
+
+    return result;
 }
 
 } // anonymous namespace
@@ -395,6 +1075,12 @@ CollectionResultObserver::CollectionResultObserver(Observer &observer, size_t ma
 {}
 
 // Observer Methods
+CollectionResultObserver::EventFlagValue CollectionResultObserver::GetEventFlags(void) const /*override*/ {
+    // Results are always delivered, so events that the wrapped observer doesn't
+    // need can be skipped entirely.
+    return _observer.GetEventFlags();
+}
+
 bool CollectionResultObserver::OnRoundBegin(size_t round, SystemPtrs const &pending) /*override*/ {
     return _observer.OnRoundBegin(round, pending);
 }
@@ -451,6 +1137,10 @@ bool CollectionResultObserver::OnIterationFailedSystems(size_t round, size_t tas
     return _observer.OnIterationFailedSystems(round, task, numTasks, iteration, numIterations, begin, end);
 }
 
+void CollectionResultObserver::OnStatistics(Statistics const &statistics) /*override*/ {
+    _observer.OnStatistics(statistics);
+}
+
 // ResultObserver methods
 bool CollectionResultObserver::OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs theseResults) /*override*/ {
     UNUSED(round);
@@ -517,10 +1207,14 @@ ExecuteResultValue ExecuteImpl(Configuration &config, ResultObserver &observer,
     ENSURE_ARGUMENT(working, std::all_of(working.cbegin(), working.cend(), [](SystemPtr const &ptr) { return static_cast<bool>(ptr); }));
     ENSURE_ARGUMENT(timeout, !timeout || timeout->count());
 
-    if(config.IsDeterministic)
-        return DeterministicExecuteImpl(config, observer, std::move(working), timeout);
+    return ExecuteImplImpl(config, observer, std::move(working), nullptr, timeout);
+}
+
+ExecuteResultValue ResumeImpl(Configuration &config, ResultObserver &observer, std::filesystem::path const &checkpointFilename, std::optional<std::chrono::steady_clock::duration> const &timeout) {
+    ENSURE_ARGUMENT(checkpointFilename, std::filesystem::is_regular_file(checkpointFilename));
+    ENSURE_ARGUMENT(timeout, !timeout || timeout->count());
 
-    throw std::runtime_error("TODO: Need non-deterministic solution");
+    return ExecuteImplImpl(config, observer, SystemPtrs(), &checkpointFilename, timeout);
 }
 
 } // namespace Details
@@ -59,6 +59,12 @@ using ResultSystemUniquePtrs                = std::vector<ResultSystemUniquePtr>
 using WorkingSystemPtr                      = Components::EngineImpl::WorkingSystemPtr;
 using WorkingSystem                         = typename WorkingSystemPtr::element_type;
 
+using EventFlagValue                        = Components::EngineImpl::EventFlagValue;
+
+/// Delivered via `Observer::OnStatistics`; values are only collected when
+/// `DECISION_ENGINE_ENABLE_STATISTICS` is defined.
+using Statistics                            = Components::EngineImpl::Statistics;
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         Observer
 ///  \brief         Observes events generated by Execute, where a round contains
@@ -77,6 +83,9 @@ public:
 
     using WorkingSystem                     = DecisionEngine::Core::LocalExecution::Engine::WorkingSystem;
 
+    using EventFlagValue                    = DecisionEngine::Core::LocalExecution::Engine::EventFlagValue;
+    using Statistics                        = DecisionEngine::Core::LocalExecution::Engine::Statistics;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -84,6 +93,9 @@ public:
     // ----------------------------------------------------------------------
     virtual ~Observer(void) = default;
 
+    /// Events that should be delivered to this observer; all events are delivered by default.
+    virtual EventFlagValue GetEventFlags(void) const { return EventFlagValue::All; }
+
     virtual bool OnRoundBegin(size_t round, SystemPtrs const &pending) = 0;
     virtual void OnRoundEnd(size_t round, SystemPtrs const &pending) = 0;
 
@@ -105,6 +117,10 @@ public:
     virtual void OnIterationMergedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &pending, SystemPtrsContainer removed) = 0;
 
     virtual bool OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) = 0;
+
+    /// Invoked once with the totals for the search when `EventFlagValue::Statistics` is
+    /// requested and statistics are enabled (see `Statistics::IsEnabled`); ignored by default.
+    virtual void OnStatistics(Statistics const &statistics) { UNUSED(statistics); }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -212,6 +228,45 @@ ExecuteResultValue Execute(
     std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
 );
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Resume
+///  \brief         Continues a search from a checkpoint written during a
+///                 previous invocation of `Execute` or `Resume` (see
+///                 `Configuration::GetCheckpointFilename`). Results found
+///                 before the checkpoint was written are delivered to the
+///                 observer before the search continues. The configuration
+///                 should be equivalent to the one used when the checkpoint
+///                 was written.
+///
+///                 The earlier results are delivered via
+///                 `OnIterationResultSystems` with the round at which the
+///                 search continues, task 0 of 1, and iteration 0 of 1. No other
+///                 events (such as `OnRoundBegin` or `OnIterationBegin`) are
+///                 generated for them, as the work that produced them isn't
+///                 repeated.
+///
+std::tuple<ExecuteResultValue, ResultSystemUniquePtr> Resume(
+    Configuration &config,
+    Observer &observer,
+    std::filesystem::path const &checkpointFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
+);
+
+std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> Resume(
+    Configuration &config,
+    Observer &observer,
+    std::filesystem::path const &checkpointFilename,
+    size_t maxNumResults,
+    std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
+);
+
+ExecuteResultValue Resume(
+    Configuration &config,
+    ResultObserver &observer,
+    std::filesystem::path const &checkpointFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
+);
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -233,6 +288,13 @@ namespace Details {
 ///  \class         CollectionResultObserver
 ///  \brief         Observer that writes results to an internal collection.
 ///
+///                 The `Execute` overloads that return results accept an
+///                 `Observer` (which doesn't receive results), so this object
+///                 adapts it to a `ResultObserver` and forwards all other events
+///                 to it. The wrapped observer's event flags are reported as-is
+///                 so that the engine doesn't build events that would only be
+///                 forwarded and ignored.
+///
 class CollectionResultObserver : public ResultObserver {
 public:
     // ----------------------------------------------------------------------
@@ -248,6 +310,8 @@ public:
     NON_MOVABLE(CollectionResultObserver);
 
     // Observer Methods
+    EventFlagValue GetEventFlags(void) const override;
+
     bool OnRoundBegin(size_t round, SystemPtrs const &pending) override;
     void OnRoundEnd(size_t round, SystemPtrs const &pending) override;
 
@@ -270,6 +334,8 @@ public:
 
     bool OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) override;
 
+    void OnStatistics(Statistics const &statistics) override;
+
     // ResultObserver methods
     bool OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs theseResults) override;
 
@@ -298,6 +364,10 @@ private:
 // |
 // ----------------------------------------------------------------------
 ExecuteResultValue ExecuteImpl(Configuration &config, ResultObserver &observer, SystemPtrs working, std::optional<std::chrono::steady_clock::duration> const &timeout);
+ExecuteResultValue ResumeImpl(Configuration &config, ResultObserver &observer, std::filesystem::path const &checkpointFilename, std::optional<std::chrono::steady_clock::duration> const &timeout);
+
+template <typename ExecuteFuncT>
+std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> CollectResults(Configuration &config, Observer &observer, size_t maxNumResults, ExecuteFuncT const &executeFunc);
 
 inline void EmptyDeleter(void const *) {}
 
@@ -360,24 +430,14 @@ std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> Execute(
     size_t maxNumResults,
     std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
 ) {
-    Details::CollectionResultObserver       cro(observer, maxNumResults, !config.NumConcurrentTasks || *config.NumConcurrentTasks > 1);
-    ExecuteResultValue                      result(
-        Execute(
-            config,
-            cro,
-            begin,
-            end,
-            timeout
-        )
+    return Details::CollectResults(
+        config,
+        observer,
+        maxNumResults,
+        [&config, &begin, &end, &timeout](ResultObserver &cro) {
+            return Execute(config, cro, begin, end, timeout);
+        }
     );
-
-    if(cro.results.size() > maxNumResults)
-        cro.results.resize(maxNumResults);
-
-    if(result != ExecuteResultValue::Completed && cro.results.size() == maxNumResults)
-        result = ExecuteResultValue::Completed;
-
-    return std::make_tuple(std::move(result), config.Finalize(std::move(cro.results)));
 }
 
 inline ExecuteResultValue Execute(
@@ -411,6 +471,64 @@ ExecuteResultValue Execute(
     return Details::ExecuteImpl(config, observer, std::move(ptrs), timeout);
 }
 
+inline std::tuple<ExecuteResultValue, ResultSystemUniquePtr> Resume(
+    Configuration &config,
+    Observer &observer,
+    std::filesystem::path const &checkpointFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
+) {
+    std::tuple<ExecuteResultValue, ResultSystemUniquePtrs>                  result(Resume(config, observer, checkpointFilename, 1, timeout));
+
+    if(std::get<1>(result).size() >= 1)
+        return std::make_tuple(ExecuteResultValue::Completed, std::move(std::get<1>(result)[0]));
+
+    return std::make_tuple(std::get<0>(result), ResultSystemUniquePtr());
+}
+
+inline std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> Resume(
+    Configuration &config,
+    Observer &observer,
+    std::filesystem::path const &checkpointFilename,
+    size_t maxNumResults,
+    std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
+) {
+    return Details::CollectResults(
+        config,
+        observer,
+        maxNumResults,
+        [&config, &checkpointFilename, &timeout](ResultObserver &cro) {
+            return Resume(config, cro, checkpointFilename, timeout);
+        }
+    );
+}
+
+inline ExecuteResultValue Resume(
+    Configuration &config,
+    ResultObserver &observer,
+    std::filesystem::path const &checkpointFilename,
+    std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
+) {
+    return Details::ResumeImpl(config, observer, checkpointFilename, timeout);
+}
+
+namespace Details {
+
+template <typename ExecuteFuncT>
+std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> CollectResults(Configuration &config, Observer &observer, size_t maxNumResults, ExecuteFuncT const &executeFunc) {
+    CollectionResultObserver                cro(observer, maxNumResults, !config.NumConcurrentTasks || *config.NumConcurrentTasks > 1);
+    ExecuteResultValue                      result(executeFunc(cro));
+
+    if(cro.results.size() > maxNumResults)
+        cro.results.resize(maxNumResults);
+
+    if(result != ExecuteResultValue::Completed && cro.results.size() == maxNumResults)
+        result = ExecuteResultValue::Completed;
+
+    return std::make_tuple(std::move(result), config.Finalize(std::move(cro.results)));
+}
+
+} // namespace Details
+
 } // namespace Engine
 } // namespace LocalExecution
 } // namespace Core
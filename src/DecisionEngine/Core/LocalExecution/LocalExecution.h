@@ -29,6 +29,8 @@
 #include <boost/uuid/uuid_serialize.hpp>
 #include <boost/uuid/string_generator.hpp>
 
+#include <filesystem>
+
 namespace DecisionEngine {
 namespace Core {
 
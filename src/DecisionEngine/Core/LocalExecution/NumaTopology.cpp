@@ -0,0 +1,264 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          NumaTopology.cpp
+///  \brief         See NumaTopology.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:14:46
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "NumaTopology.h"
+
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <thread>
+
+#if (defined __linux__)
+#   include <sched.h>
+#endif
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+NumaTopology::NodeCpus ReadNodes(void) {
+    NumaTopology::NodeCpus                  results;
+
+#if (defined __linux__)
+    // Nodes are enumerated in numerical order; memory-only nodes are skipped
+    std::filesystem::path const             root("/sys/devices/system/node");
+    std::error_code                         ec;
+    std::map<unsigned long, NumaTopology::CpuIndexes>   nodes;
+
+    for(std::filesystem::directory_entry const &entry : std::filesystem::directory_iterator(root, ec)) {
+        std::string const                   name(entry.path().filename().string());
+
+        if(name.size() <= 4 || name.compare(0, 4, "node") != 0 || name.find_first_not_of("0123456789", 4) != std::string::npos)
+            continue;
+
+        std::ifstream                       stream(entry.path() / "cpulist");
+        std::string                         cpuList;
+
+        if(!std::getline(stream, cpuList))
+            continue;
+
+        try {
+            NumaTopology::CpuIndexes        cpus(NumaTopology::ParseCpuList(cpuList));
+
+            if(cpus.empty() == false)
+                nodes.emplace(std::stoul(name.substr(4)), std::move(cpus));
+        }
+        catch(std::exception const &) {
+            continue;
+        }
+    }
+
+    for(auto &node : nodes)
+        results.emplace_back(std::move(node.second));
+#endif
+
+    if(results.empty()) {
+        NumaTopology::CpuIndexes            cpus(std::max(std::thread::hardware_concurrency(), 1u));
+
+        for(size_t index = 0; index < cpus.size(); ++index)
+            cpus[index] = index;
+
+        results.emplace_back(std::move(cpus));
+    }
+
+    return results;
+}
+
+#if (defined __linux__)
+
+/// Returns the CPUs that the calling thread may run on.
+std::optional<NumaTopology::CpuIndexes> GetThreadCpus(void) {
+    cpu_set_t                               cpus;
+
+    CPU_ZERO(&cpus);
+
+    if(sched_getaffinity(0, sizeof(cpus), &cpus) != 0)
+        return std::nullopt;
+
+    NumaTopology::CpuIndexes                results;
+
+    for(size_t index = 0; index < CPU_SETSIZE; ++index) {
+        if(CPU_ISSET(index, &cpus))
+            results.emplace_back(index);
+    }
+
+    return results;
+}
+
+bool SetThreadCpus(NumaTopology::CpuIndexes const &indexes) {
+    cpu_set_t                               cpus;
+
+    CPU_ZERO(&cpus);
+
+    for(size_t index : indexes) {
+        if(index < CPU_SETSIZE)
+            CPU_SET(index, &cpus);
+    }
+
+    return CPU_COUNT(&cpus) != 0 && sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+}
+
+#endif
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  NumaTopology::ScopedThreadAffinity
+// |
+// ----------------------------------------------------------------------
+NumaTopology::ScopedThreadAffinity::ScopedThreadAffinity(NumaTopology const &topology, size_t node) {
+    ENSURE_ARGUMENT(node, node < topology.NumNodes());
+
+#if (defined __linux__)
+    // Pinning isn't necessary when there is only one node
+    if(topology.NumNodes() == 1)
+        return;
+
+    std::optional<CpuIndexes>               originalCpus(GetThreadCpus());
+
+    if(originalCpus && SetThreadCpus(topology.Nodes[node]))
+        _originalCpus = std::move(originalCpus);
+#else
+    UNUSED(topology);
+#endif
+}
+
+NumaTopology::ScopedThreadAffinity::~ScopedThreadAffinity(void) {
+#if (defined __linux__)
+    if(_originalCpus)
+        SetThreadCpus(*_originalCpus);
+#endif
+}
+
+bool NumaTopology::ScopedThreadAffinity::IsPinned(void) const {
+    return static_cast<bool>(_originalCpus);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  NumaTopology
+// |
+// ----------------------------------------------------------------------
+// static
+NumaTopology const & NumaTopology::Get(void) {
+    static NumaTopology const               topology(ReadNodes());
+
+    return topology;
+}
+
+// static
+NumaTopology::CpuIndexes NumaTopology::ParseCpuList(std::string const &value) {
+    CpuIndexes                              results;
+    std::string::const_iterator             iter(value.cbegin());
+    std::string::const_iterator const       end(
+        std::find_if(
+            value.crbegin(),
+            value.crend(),
+            [](char c) { return std::isspace(static_cast<unsigned char>(c)) == 0; }
+        ).base()
+    );
+
+    auto const                              parseNumberFunc(
+        [&iter, &end](void) {
+            if(iter == end || std::isdigit(static_cast<unsigned char>(*iter)) == 0)
+                throw std::runtime_error("Invalid cpulist");
+
+            size_t                          result(0);
+
+            while(iter != end && std::isdigit(static_cast<unsigned char>(*iter))) {
+                result = result * 10 + static_cast<size_t>(*iter - '0');
+                ++iter;
+            }
+
+            return result;
+        }
+    );
+
+    while(iter != end) {
+        size_t const                        first(parseNumberFunc());
+        size_t                              last(first);
+
+        if(iter != end && *iter == '-') {
+            ++iter;
+            last = parseNumberFunc();
+
+            if(last < first)
+                throw std::runtime_error("Invalid cpulist");
+        }
+
+        for(size_t index = first; index <= last; ++index)
+            results.emplace_back(index);
+
+        if(iter != end) {
+            if(*iter != ',')
+                throw std::runtime_error("Invalid cpulist");
+
+            ++iter;
+
+            if(iter == end)
+                throw std::runtime_error("Invalid cpulist");
+        }
+    }
+
+    return results;
+}
+
+NumaTopology::NumaTopology(NodeCpus nodes) :
+    Nodes(
+        std::move(
+            [&nodes](void) -> NodeCpus & {
+                ENSURE_ARGUMENT(nodes, nodes.empty() == false);
+                ENSURE_ARGUMENT(nodes, std::all_of(nodes.cbegin(), nodes.cend(), [](CpuIndexes const &cpus) { return cpus.empty() == false; }));
+                return nodes;
+            }()
+        )
+    )
+{}
+
+size_t NumaTopology::NumNodes(void) const {
+    return Nodes.size();
+}
+
+bool NumaTopology::PinThread(size_t node) const {
+    ENSURE_ARGUMENT(node, node < NumNodes());
+
+#if (defined __linux__)
+    // Pinning isn't necessary when there is only one node
+    if(NumNodes() == 1)
+        return false;
+
+    return SetThreadCpus(Nodes[node]);
+#else
+    return false;
+#endif
+}
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          NumaTopology.h
+///  \brief         Contains the NumaTopology object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:14:46
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "LocalExecution.h"
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         NumaTopology
+///  \brief         The NUMA nodes of a machine and the CPUs that belong to
+///                 each node.
+///
+///                 On Linux, the topology is read from sysfs and threads can
+///                 be pinned to the CPUs of a node. On other platforms (or
+///                 when the information isn't available), the machine is
+///                 treated as a single node and pinning is not supported.
+///
+class NumaTopology {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using CpuIndexes                        = std::vector<size_t>;
+    using NodeCpus                          = std::vector<CpuIndexes>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         ScopedThreadAffinity
+    ///  \brief         Pins the calling thread to the CPUs of a node and restores
+    ///                 the thread's original affinity when destroyed.
+    ///
+    class ScopedThreadAffinity {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        ScopedThreadAffinity(NumaTopology const &topology, size_t node);
+        ~ScopedThreadAffinity(void);
+
+        NON_COPYABLE(ScopedThreadAffinity);
+        NON_MOVABLE(ScopedThreadAffinity);
+
+        /// Returns true if the thread was pinned.
+        bool IsPinned(void) const;
+
+    private:
+        // ----------------------------------------------------------------------
+        // |  Private Data
+        std::optional<CpuIndexes>           _originalCpus;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    NodeCpus const                          Nodes;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the topology of this machine; the topology is only read once.
+    static NumaTopology const & Get(void);
+
+    /// Parses a Linux cpulist value (for example, "0-3,8,10-11").
+    static CpuIndexes ParseCpuList(std::string const &value);
+
+    NumaTopology(NodeCpus nodes);
+
+    NON_COPYABLE(NumaTopology);
+    NON_MOVABLE(NumaTopology);
+
+    size_t NumNodes(void) const;
+
+    /// Pins the calling thread to the CPUs of a node for the remainder of its
+    /// lifetime; returns true if the thread was pinned. Use `ScopedThreadAffinity`
+    /// for threads that aren't owned by the caller.
+    bool PinThread(size_t node) const;
+};
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
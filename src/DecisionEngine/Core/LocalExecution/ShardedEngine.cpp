@@ -0,0 +1,737 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ShardedEngine.cpp
+///  \brief         See ShardedEngine.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:12:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "ShardedEngine.h"
+#include "FingerprinterFactory.h"
+
+#include <DecisionEngine/Core/Components/CalculatedWorkingSystem.h>
+#include <DecisionEngine/Core/Components/Fingerprinter.h>
+
+#include <boost/serialization/shared_ptr.hpp>
+
+#include <cerrno>
+#include <filesystem>
+#include <sstream>
+#include <system_error>
+
+#if (!defined _WIN32)
+#   include <sys/socket.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+namespace ShardedEngine {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types
+// |
+// ----------------------------------------------------------------------
+using SystemPtr                             = Engine::SystemPtr;
+using SystemPtrs                            = Engine::SystemPtrs;
+using SystemPtrsContainer                   = Engine::SystemPtrsContainer;
+using ResultSystemUniquePtr                 = Engine::ResultSystemUniquePtr;
+using WorkingSystemPtr                      = Engine::WorkingSystemPtr;
+using EventFlagValue                        = Engine::EventFlagValue;
+
+/// Results found during a single iteration of a task
+struct ResultBatch {
+    size_t                                  Iteration;
+    size_t                                  MaxIterations;
+    ResultSystemUniquePtrs                  Results;
+};
+
+using ResultBatches                         = std::vector<ResultBatch>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         WorkerObserver
+///  \brief         Collects the results found by a task executed by a worker;
+///                 all other events are ignored.
+///
+class WorkerObserver : public Components::EngineImpl::Observer {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    ResultBatches                           batches;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    WorkerObserver(void) = default;
+    ~WorkerObserver(void) override = default;
+
+    NON_COPYABLE(WorkerObserver);
+    NON_MOVABLE(WorkerObserver);
+
+    // EngineImpl::Observer Methods
+    EventFlagValue GetEventFlags(void) const override {
+        return EventFlagValue::None;
+    }
+
+    bool OnBegin(size_t, size_t) override { return true; }
+    void OnEnd(size_t, size_t) override {}
+    bool OnGeneratingWork(size_t, size_t, WorkingSystem const &) override { return true; }
+    void OnGeneratedWork(size_t, size_t, WorkingSystem const &, SystemPtrs const &) override {}
+    bool OnMergingWork(size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { return true; }
+    void OnMergedWork(size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnFailedSystems(size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { return true; }
+
+    bool OnSuccessfulSystems(size_t iteration, size_t maxIterations, ResultSystemUniquePtrs results) override {
+        batches.emplace_back(ResultBatch{ iteration, maxIterations, std::move(results) });
+        return true;
+    }
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+std::string SerializeTask(size_t round, size_t taskIndex, size_t numTasks, SystemPtr const &pSystem) {
+    std::ostringstream                      stream;
+
+    {
+        boost::archive::binary_oarchive     archive(stream);
+
+        archive << round;
+        archive << taskIndex;
+        archive << numTasks;
+        archive << pSystem;
+    }
+
+    return stream.str();
+}
+
+std::tuple<size_t, size_t, size_t, SystemPtr> DeserializeTask(std::string const &message) {
+    std::istringstream                      stream(message);
+    boost::archive::binary_iarchive         archive(stream);
+    size_t                                  round;
+    size_t                                  taskIndex;
+    size_t                                  numTasks;
+    SystemPtr                               pSystem;
+
+    archive >> round;
+    archive >> taskIndex;
+    archive >> numTasks;
+    archive >> pSystem;
+
+    if(!pSystem || pSystem->Type != Components::System::TypeValue::Working)
+        throw std::runtime_error("Invalid task message");
+
+    return std::make_tuple(std::move(round), std::move(taskIndex), std::move(numTasks), std::move(pSystem));
+}
+
+std::string SerializeError(std::string const &error) {
+    std::ostringstream                      stream;
+
+    {
+        boost::archive::binary_oarchive     archive(stream);
+        bool const                          succeeded(false);
+
+        archive << succeeded;
+        archive << error;
+    }
+
+    return stream.str();
+}
+
+std::string SerializeResponse(SystemPtrs const &pending, ResultBatches const &batches) {
+    std::ostringstream                      stream;
+
+    {
+        boost::archive::binary_oarchive     archive(stream);
+        bool const                          succeeded(true);
+        size_t const                        numBatches(batches.size());
+
+        archive << succeeded;
+        archive << pending;
+        archive << numBatches;
+
+        for(ResultBatch const &batch : batches) {
+            size_t const                    numResults(batch.Results.size());
+
+            archive << batch.Iteration;
+            archive << batch.MaxIterations;
+            archive << numResults;
+
+            for(ResultSystemUniquePtr const &pResult : batch.Results) {
+                Components::System const *  pSystem(pResult.get());
+
+                archive << pSystem;
+            }
+        }
+    }
+
+    return stream.str();
+}
+
+/// Returns the pending systems and results, or the error encountered by the worker.
+std::tuple<SystemPtrs, ResultBatches, std::optional<std::string>> DeserializeResponse(std::string const &message) {
+    std::istringstream                      stream(message);
+    boost::archive::binary_iarchive         archive(stream);
+    bool                                    succeeded;
+
+    archive >> succeeded;
+
+    if(succeeded == false) {
+        std::string                         error;
+
+        archive >> error;
+        return std::make_tuple(SystemPtrs(), ResultBatches(), std::move(error));
+    }
+
+    SystemPtrs                              pending;
+    size_t                                  numBatches;
+    ResultBatches                           batches;
+
+    archive >> pending;
+    archive >> numBatches;
+
+    if(std::any_of(pending.cbegin(), pending.cend(), [](SystemPtr const &ptr) { return static_cast<bool>(ptr) == false; }))
+        throw std::runtime_error("Invalid response message");
+
+    while(numBatches--) {
+        ResultBatch                         batch;
+        size_t                              numResults;
+
+        archive >> batch.Iteration;
+        archive >> batch.MaxIterations;
+        archive >> numResults;
+
+        while(numResults--) {
+            Components::System *            pSystem(nullptr);
+
+            archive >> pSystem;
+
+            std::unique_ptr<Components::System>         pOwner(pSystem);
+            Components::ResultSystem * const            pResult(dynamic_cast<Components::ResultSystem *>(pSystem));
+
+            if(pResult == nullptr)
+                throw std::runtime_error("Invalid response message");
+
+            pOwner.release();
+            batch.Results.emplace_back(pResult);
+        }
+
+        batches.emplace_back(std::move(batch));
+    }
+
+    return std::make_tuple(std::move(pending), std::move(batches), std::optional<std::string>());
+}
+
+std::string ReceiveResponse(Transport &transport) {
+    std::optional<std::string>              message(transport.Receive());
+
+    if(!message)
+        throw std::runtime_error("The worker is no longer available");
+
+    return std::move(*message);
+}
+
+ExecuteResultValue ExecuteImpl(
+    Configuration &config,
+    Engine::ResultObserver &observer,
+    Transports const &workers,
+    SystemPtrs pending,
+    std::optional<std::chrono::steady_clock::duration> const &timeout,
+    Statistics *pStatistics
+) {
+    // Create the function used to determine if time has expired
+    std::function<bool (void)> const        hasTimeExpiredFunc(
+        [&timeout](void) -> std::function<bool (void)> {
+            if(timeout) {
+                std::chrono::steady_clock::time_point const                 endTime(std::chrono::steady_clock::now() + *timeout);
+
+                return
+                    [endTime=std::move(endTime)](void) {
+                        return std::chrono::steady_clock::now() >= endTime;
+                    };
+            }
+
+            return [](void) { return false; };
+        }()
+    );
+
+    // Events that the observer isn't interested in are skipped
+    EventFlagValue const                    eventFlags(observer.GetEventFlags());
+    bool const                              notifyRound(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::Round));
+    bool const                              notifyRoundMerge(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::RoundMerge));
+    bool const                              notifyTask(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::Task));
+    bool const                              notifyTaskError(Components::EngineImpl::IsSet(eventFlags, EventFlagValue::TaskError));
+
+    bool                                    isCancelled(false);
+    size_t                                  round(0);
+
+    while(isCancelled == false && pending.empty() == false && hasTimeExpiredFunc() == false) {
+        {
+            if(notifyRound && observer.OnRoundBegin(round, pending) == false) {
+                isCancelled = true;
+                continue;
+            }
+
+            FINALLY([&observer, &round, &pending, notifyRound](void) { if(notifyRound) observer.OnRoundEnd(round, pending); });
+
+            // Send the tasks; workers execute them concurrently
+            size_t const                    numTasks(std::min(workers.size(), pending.size()));
+            std::vector<bool>               isSent(numTasks, false);
+
+            assert(numTasks);
+
+            DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumRounds, 1);
+            DECISION_ENGINE_STATISTICS_ADD(pStatistics, NumTasks, numTasks);
+
+            for(size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex) {
+                SystemPtr                   pTaskSystem(pending.front());
+
+                pending.pop_front();
+
+                if(notifyTask && observer.OnTaskBegin(round, taskIndex, numTasks) == false)
+                    continue;
+
+                workers[taskIndex].get().Send(SerializeTask(round, taskIndex, numTasks, pTaskSystem));
+                isSent[taskIndex] = true;
+            }
+
+            // Receive the results in task order so that the output is deterministic
+            SystemPtrsContainer             taskResults;
+
+            taskResults.reserve(numTasks + 1);
+
+            for(size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex) {
+                if(isSent[taskIndex] == false) {
+                    taskResults.emplace_back();
+                    continue;
+                }
+
+                FINALLY([&observer, round, taskIndex, numTasks, notifyTask](void) { if(notifyTask) observer.OnTaskEnd(round, taskIndex, numTasks); });
+
+                SystemPtrs                  taskPending;
+                ResultBatches               batches;
+                std::optional<std::string>  error;
+
+                std::tie(taskPending, batches, error) = DeserializeResponse(ReceiveResponse(workers[taskIndex]));
+
+                if(error) {
+                    if(notifyTaskError)
+                        observer.OnTaskError(round, taskIndex, numTasks, std::runtime_error(*error));
+                }
+
+                for(ResultBatch &batch : batches) {
+                    if(isCancelled)
+                        break;
+
+                    if(observer.OnIterationResultSystems(round, taskIndex, numTasks, batch.Iteration, batch.MaxIterations, std::move(batch.Results)) == false)
+                        isCancelled = true;
+                }
+
+                taskResults.emplace_back(std::move(taskPending));
+            }
+
+            if(isCancelled)
+                continue;
+
+            if(pending.empty() == false)
+                taskResults.emplace_back(std::move(pending));
+
+            // Determine if there is work to complete
+            bool const                      hasResults(std::any_of(taskResults.cbegin(), taskResults.cend(), [](SystemPtrs const &ptrs) { return ptrs.empty() == false; }));
+
+            if(hasResults == false)
+                continue;
+
+            if(notifyRoundMerge && observer.OnRoundMergingWork(round, taskResults) == false) {
+                isCancelled = true;
+                continue;
+            }
+
+            // Merge the results
+            if(notifyRoundMerge == false) {
+                pending = std::get<0>(
+                    Components::EngineImpl::Merge(
+                        config.GetMaxNumPendingSystems(),
+                        std::move(taskResults),
+                        std::nullopt,
+                        Statistics::IsEnabled ? pStatistics : nullptr
+                    )
+                );
+            }
+            else {
+                SystemPtrsContainer         removed;
+
+                FINALLY([&observer, &round, &pending, &removed](void) { observer.OnRoundMergedWork(round, pending, std::move(removed)); });
+
+                std::tie(pending, removed) = Components::EngineImpl::Merge(
+                    config.GetMaxNumPendingSystems(),
+                    std::move(taskResults),
+                    std::nullopt,
+                    Statistics::IsEnabled ? pStatistics : nullptr
+                );
+            }
+        }
+
+        ++round;
+    }
+
+    if(pending.empty())
+        return ExecuteResultValue::Completed;
+    else if(isCancelled)
+        return ExecuteResultValue::ExitViaObserver;
+
+    return ExecuteResultValue::Timeout;
+}
+
+#if (defined __linux__)
+/// Returns the number of threads in the current process
+size_t GetNumThreads(void) {
+    return static_cast<size_t>(std::distance(std::filesystem::directory_iterator("/proc/self/task"), std::filesystem::directory_iterator()));
+}
+#endif
+
+} // anonymous namespace
+
+#if (!defined _WIN32)
+
+// ----------------------------------------------------------------------
+// |
+// |  SocketTransport
+// |
+// ----------------------------------------------------------------------
+// static
+std::tuple<SocketTransport::SocketTransportUniquePtr, SocketTransport::SocketTransportUniquePtr> SocketTransport::CreatePair(void) {
+    int                                     sockets[2];
+
+    if(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0)
+        throw std::system_error(errno, std::generic_category(), "socketpair");
+
+#if (defined SO_NOSIGPIPE)
+    int const                               value(1);
+
+    for(int socket : sockets)
+        ::setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+#endif
+
+    return std::make_tuple(std::make_unique<SocketTransport>(sockets[0]), std::make_unique<SocketTransport>(sockets[1]));
+}
+
+SocketTransport::SocketTransport(int socket) :
+    _socket(
+        std::move(
+            [&socket](void) -> int & {
+                ENSURE_ARGUMENT(socket, socket >= 0);
+                return socket;
+            }()
+        )
+    )
+{}
+
+SocketTransport::~SocketTransport(void) /*override*/ {
+    ::close(_socket);
+}
+
+void SocketTransport::Send(std::string const &message) /*override*/ {
+    std::uint64_t const                     size(message.size());
+
+    auto const                              sendFunc(
+        [this](char const *pData, size_t numBytes) {
+#if (defined MSG_NOSIGNAL)
+            int const                       flags(MSG_NOSIGNAL);
+#else
+            int const                       flags(0);
+#endif
+
+            while(numBytes) {
+                ssize_t const               result(::send(_socket, pData, numBytes, flags));
+
+                if(result < 0) {
+                    if(errno == EINTR)
+                        continue;
+
+                    throw std::system_error(errno, std::generic_category(), "send");
+                }
+
+                pData += result;
+                numBytes -= static_cast<size_t>(result);
+            }
+        }
+    );
+
+    sendFunc(reinterpret_cast<char const *>(&size), sizeof(size));
+    sendFunc(message.data(), message.size());
+}
+
+std::optional<std::string> SocketTransport::Receive(void) /*override*/ {
+    // Returns false if the socket was closed before any data was received
+    auto const                              receiveFunc(
+        [this](char *pData, size_t numBytes) {
+            size_t const                    totalBytes(numBytes);
+
+            while(numBytes) {
+                ssize_t const               result(::recv(_socket, pData, numBytes, 0));
+
+                if(result < 0) {
+                    if(errno == EINTR)
+                        continue;
+
+                    throw std::system_error(errno, std::generic_category(), "recv");
+                }
+
+                if(result == 0) {
+                    if(numBytes == totalBytes)
+                        return false;
+
+                    throw std::runtime_error("Invalid transport message");
+                }
+
+                pData += result;
+                numBytes -= static_cast<size_t>(result);
+            }
+
+            return true;
+        }
+    );
+
+    std::uint64_t                           size;
+
+    if(receiveFunc(reinterpret_cast<char *>(&size), sizeof(size)) == false)
+        return std::nullopt;
+
+    std::string                             message(static_cast<size_t>(size), '\0');
+
+    if(size && receiveFunc(message.data(), message.size()) == false)
+        throw std::runtime_error("Invalid transport message");
+
+    return message;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  LocalWorkers
+// |
+// ----------------------------------------------------------------------
+LocalWorkers::LocalWorkers(Configuration &config, size_t numWorkers) {
+    ENSURE_ARGUMENT(numWorkers);
+
+#if (defined __linux__)
+    // Only the forking thread exists in a worker, so a lock held by any other
+    // thread (including those within the allocator) would never be released.
+    if(GetNumThreads() != 1)
+        throw std::runtime_error("LocalWorkers must be created before any threads are started");
+#endif
+
+    _transports.reserve(numWorkers);
+    _pids.reserve(numWorkers);
+
+    try {
+        while(_pids.size() < numWorkers) {
+            SocketTransport::SocketTransportUniquePtr   pCoordinator;
+            SocketTransport::SocketTransportUniquePtr   pWorker;
+
+            std::tie(pCoordinator, pWorker) = SocketTransport::CreatePair();
+
+            _transports.emplace_back(std::move(pCoordinator));
+
+            pid_t const                     pid(::fork());
+
+            if(pid < 0)
+                throw std::system_error(errno, std::generic_category(), "fork");
+
+            if(pid == 0) {
+                // Close the coordinator's ends so that the other workers detect when the coordinator closes them
+                _transports.clear();
+
+                int                         exitCode(0);
+
+                try {
+                    ExecuteWorker(config, *pWorker);
+                }
+                catch(...) {
+                    exitCode = 1;
+                }
+
+                // Exit without running destructors or atexit handlers that belong to the parent
+                ::_exit(exitCode);
+            }
+
+            _pids.emplace_back(pid);
+        }
+    }
+    catch(...) {
+        Terminate();
+        throw;
+    }
+}
+
+LocalWorkers::~LocalWorkers(void) {
+    Terminate();
+}
+
+Transports LocalWorkers::GetTransports(void) const {
+    Transports                              results;
+
+    results.reserve(_transports.size());
+
+    for(SocketTransport::SocketTransportUniquePtr const &pTransport : _transports)
+        results.emplace_back(*pTransport);
+
+    return results;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+void LocalWorkers::Terminate(void) {
+    // Workers exit once their transports are closed
+    _transports.clear();
+
+    for(pid_t pid : _pids) {
+        while(::waitpid(pid, nullptr, 0) < 0 && errno == EINTR)
+            ;
+    }
+
+    _pids.clear();
+}
+
+#endif
+
+// ----------------------------------------------------------------------
+// |
+// |  Public Methods
+// |
+// ----------------------------------------------------------------------
+void ExecuteWorker(Configuration &config, Transport &transport) {
+    // The fingerprinter persists across the tasks executed by this worker
+    std::unique_ptr<Components::Fingerprinter>          pFingerprinter(
+        [&config](void) -> std::unique_ptr<Components::Fingerprinter> {
+            FingerprinterFactory * const    pFingerprinterFactory(reinterpret_cast<FingerprinterFactory *>(config.QueryInterface(FingerprinterFactory::ID)));
+
+            if(pFingerprinterFactory != nullptr)
+                return pFingerprinterFactory->Create();
+
+            return std::make_unique<Components::NoopFingerprinter>();
+        }()
+    );
+
+    while(std::optional<std::string> message = transport.Receive()) {
+        std::string                         response;
+
+        try {
+            SystemPtr                       pSystem;
+
+            std::tie(std::ignore, std::ignore, std::ignore, pSystem) = DeserializeTask(*message);
+
+            WorkingSystemPtr                pWorkingSystem(
+                [&pSystem](void) {
+                    if(pSystem->Completion == Components::System::CompletionValue::Calculated) {
+                        if(std::dynamic_pointer_cast<Components::CalculatedWorkingSystem>(pSystem) == nullptr)
+                            throw std::runtime_error("Invalid task message");
+
+                        return std::static_pointer_cast<Components::CalculatedWorkingSystem>(pSystem)->Commit();
+                    }
+
+                    WorkingSystemPtr        pResult(std::dynamic_pointer_cast<Components::WorkingSystem>(pSystem));
+
+                    if(!pResult)
+                        throw std::runtime_error("Invalid task message");
+
+                    return pResult;
+                }()
+            );
+
+            WorkerObserver                  observer;
+            SystemPtrs                      pending(
+                Components::EngineImpl::ExecuteTask(
+                    *pFingerprinter,
+                    observer,
+                    config.GetMaxNumPendingSystems(*pWorkingSystem),
+                    config.GetMaxNumChildrenPerGeneration(*pWorkingSystem),
+                    config.GetMaxNumIterationsPerRound(*pWorkingSystem),
+                    config.ContinueProcessingSystemsWithFailures,
+                    std::move(pWorkingSystem)
+                )
+            );
+
+            response = SerializeResponse(pending, observer.batches);
+        }
+        catch(std::exception const &ex) {
+            response = SerializeError(ex.what());
+        }
+
+        transport.Send(response);
+    }
+}
+
+ExecuteResultValue Execute(
+    Configuration &config,
+    Engine::ResultObserver &observer,
+    Transports const &workers,
+    WorkingSystem const &initial,
+    std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
+) {
+    ENSURE_ARGUMENT(workers, workers.empty() == false);
+    ENSURE_ARGUMENT(timeout, !timeout || timeout->count());
+
+    WorkingSystemPtr                        pInitial(&make_mutable(initial), Engine::Details::EmptyDeleter);
+
+    // Statistics are only collected when the observer will receive them
+    if(Statistics::IsEnabled == false || Components::EngineImpl::IsSet(observer.GetEventFlags(), EventFlagValue::Statistics) == false)
+        return ExecuteImpl(config, observer, workers, SystemPtrs{ std::move(pInitial) }, timeout, nullptr);
+
+    Statistics                              statistics;
+    ExecuteResultValue const                result(ExecuteImpl(config, observer, workers, SystemPtrs{ std::move(pInitial) }, timeout, &statistics));
+
+    observer.OnStatistics(statistics);
+    return result;
+}
+
+std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> Execute(
+    Configuration &config,
+    Engine::Observer &observer,
+    Transports const &workers,
+    WorkingSystem const &initial,
+    size_t maxNumResults,
+    std::optional<std::chrono::steady_clock::duration> const &timeout/*=std::nullopt*/
+) {
+    ENSURE_ARGUMENT(maxNumResults);
+
+    return Engine::Details::CollectResults(
+        config,
+        observer,
+        maxNumResults,
+        [&config, &workers, &initial, &timeout](Engine::ResultObserver &cro) {
+            return Execute(config, cro, workers, initial, timeout);
+        }
+    );
+}
+
+} // namespace ShardedEngine
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
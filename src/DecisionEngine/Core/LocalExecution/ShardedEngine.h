@@ -0,0 +1,238 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ShardedEngine.h
+///  \brief         Contains the ShardedEngine namespace
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:12:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Engine.h"
+
+#include <functional>
+
+#if (!defined _WIN32)
+#   include <sys/types.h>
+#endif
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+/////////////////////////////////////////////////////////////////////////
+///  \namespace     ShardedEngine
+///  \brief         Executes the decision engine across multiple processes. A
+///                 coordinator shards the pending systems across workers at the
+///                 beginning of each round; each worker executes its task via
+///                 `EngineImpl::ExecuteTask` and returns the pending systems
+///                 and results, which the coordinator merges via
+///                 `EngineImpl::Merge`. Rounds are equivalent to those executed
+///                 by `Engine::Execute`, where each worker takes the place of a
+///                 thread, with one exception: the fingerprinter (see below).
+///
+///                 Systems are sent between processes with boost binary
+///                 archives, so all systems and conditions must be exported
+///                 for polymorphic serialization (the same requirement as
+///                 checkpoints).
+///
+///                 Each worker uses its own fingerprinter, which persists
+///                 across tasks; duplicate systems generated by different
+///                 workers are not detected. When a fingerprinter is
+///                 configured, a system generated by more than one worker is
+///                 processed (and a result found by more than one worker is
+///                 delivered) once per worker, so the results may differ from
+///                 those of `Engine::Execute`. The results are the same when
+///                 no fingerprinter is configured.
+///
+///                 Iteration events are not delivered to the coordinator's
+///                 observer, and checkpoints, pending system budgets, and
+///                 tracing are not supported.
+///
+namespace ShardedEngine {
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Public Types
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+using ExecuteResultValue                    = Engine::ExecuteResultValue;
+using ResultSystemUniquePtrs                = Engine::ResultSystemUniquePtrs;
+using Statistics                            = Engine::Statistics;
+using WorkingSystem                         = Engine::WorkingSystem;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Transport
+///  \brief         Sends and receives messages between a coordinator and a
+///                 worker. Messages are delivered in order and in their
+///                 entirety.
+///
+class Transport {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    virtual ~Transport(void) = default;
+
+    virtual void Send(std::string const &message) = 0;
+
+    /// Blocks until a message is available; returns an empty value when the
+    /// other end of the transport has been closed.
+    virtual std::optional<std::string> Receive(void) = 0;
+};
+
+using Transports                            = std::vector<std::reference_wrapper<Transport>>;
+
+#if (!defined _WIN32)
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SocketTransport
+///  \brief         `Transport` that uses a connected Unix domain socket, where
+///                 each message is prefixed by its length.
+///
+class SocketTransport : public Transport {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SocketTransportUniquePtr          = std::unique_ptr<SocketTransport>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Creates a pair of connected transports.
+    static std::tuple<SocketTransportUniquePtr, SocketTransportUniquePtr> CreatePair(void);
+
+    /// Takes ownership of the socket.
+    SocketTransport(int socket);
+    ~SocketTransport(void) override;
+
+    NON_COPYABLE(SocketTransport);
+    NON_MOVABLE(SocketTransport);
+
+    void Send(std::string const &message) override;
+    std::optional<std::string> Receive(void) override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    int const                               _socket;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         LocalWorkers
+///  \brief         Forks worker processes on this machine, each of which is
+///                 connected to the coordinator via a `SocketTransport`. The
+///                 workers exit once their transports are closed, which
+///                 happens when this object is destroyed.
+///
+///                 Worker processes are forked from the current process, so
+///                 this object must be created before any threads are
+///                 started. This is verified on Linux, where an exception is
+///                 thrown if the process has more than one thread.
+///
+class LocalWorkers {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    LocalWorkers(Configuration &config, size_t numWorkers);
+    ~LocalWorkers(void);
+
+    NON_COPYABLE(LocalWorkers);
+    NON_MOVABLE(LocalWorkers);
+
+    Transports GetTransports(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<SocketTransport::SocketTransportUniquePtr>  _transports;
+    std::vector<pid_t>                      _pids;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void Terminate(void);
+};
+
+#endif
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Public Methods
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ExecuteWorker
+///  \brief         Executes tasks sent by a coordinator until the transport is
+///                 closed. Errors encountered while executing a task are sent
+///                 to the coordinator.
+///
+void ExecuteWorker(Configuration &config, Transport &transport);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Execute
+///  \brief         Coordinates the execution of a search across the workers
+///                 associated with the provided transports.
+///
+ExecuteResultValue Execute(
+    Configuration &config,
+    Engine::ResultObserver &observer,
+    Transports const &workers,
+    WorkingSystem const &initial,
+    std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
+);
+
+std::tuple<ExecuteResultValue, ResultSystemUniquePtrs> Execute(
+    Configuration &config,
+    Engine::Observer &observer,
+    Transports const &workers,
+    WorkingSystem const &initial,
+    size_t maxNumResults,
+    std::optional<std::chrono::steady_clock::duration> const &timeout=std::nullopt
+);
+
+} // namespace ShardedEngine
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
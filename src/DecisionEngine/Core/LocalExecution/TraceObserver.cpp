@@ -0,0 +1,380 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          TraceObserver.cpp
+///  \brief         See TraceObserver.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:36:59
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "TraceObserver.h"
+
+#include <atomic>
+#include <fstream>
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Data
+// |
+// ----------------------------------------------------------------------
+
+// Used to detect thread-local buffers that belong to a different (or destroyed) TraceObserver
+std::atomic<std::uint64_t>                  g_nextId(1);
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Functions
+// |
+// ----------------------------------------------------------------------
+std::string EscapeJson(std::string const &value) {
+    std::string                             result;
+
+    result.reserve(value.size());
+
+    for(char c : value) {
+        if(c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        }
+        else if(static_cast<unsigned char>(c) < 0x20)
+            result += boost::str(boost::format("\\u%04x") % static_cast<unsigned int>(static_cast<unsigned char>(c)));
+        else
+            result += c;
+    }
+
+    return result;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  TraceObserver
+// |
+// ----------------------------------------------------------------------
+TraceObserver::TraceObserver(Engine::ResultObserver &observer, EventFlagValue eventFlags/*=EventFlagValue::All*/) :
+    EventFlags(std::move(eventFlags)),
+    _observer(observer),
+    _id(g_nextId++),
+    _start(std::chrono::steady_clock::now())
+{}
+
+void TraceObserver::Write(std::filesystem::path const &filename) const {
+    // ----------------------------------------------------------------------
+    struct Internal {
+        static char const * GetCategory(EventTypeValue type) {
+            switch(type) {
+            case EventTypeValue::Round: return "Round";
+            case EventTypeValue::RoundMerge: return "Round";
+            case EventTypeValue::Task: return "Task";
+            case EventTypeValue::TaskError: return "Task";
+            case EventTypeValue::Iteration: return "Iteration";
+            case EventTypeValue::IterationGenerate: return "Iteration";
+            case EventTypeValue::IterationMerge: return "Iteration";
+            case EventTypeValue::IterationFailedSystems: return "Iteration";
+            case EventTypeValue::IterationResultSystems: return "Iteration";
+            }
+
+            throw std::logic_error("Invalid EventTypeValue");
+        }
+
+        static std::string GetName(Event const &event) {
+            switch(event.Type) {
+            case EventTypeValue::Round: return boost::str(boost::format("Round %1%") % event.Round);
+            case EventTypeValue::RoundMerge: return "Merge";
+            case EventTypeValue::Task: return boost::str(boost::format("Task %1% of %2%") % event.Task % event.NumTasks);
+            case EventTypeValue::TaskError: return "Error";
+            case EventTypeValue::Iteration: return boost::str(boost::format("Iteration %1%") % event.Iteration);
+            case EventTypeValue::IterationGenerate: return "Generate";
+            case EventTypeValue::IterationMerge: return "Merge";
+            case EventTypeValue::IterationFailedSystems: return "Failed Systems";
+            case EventTypeValue::IterationResultSystems: return "Result Systems";
+            }
+
+            throw std::logic_error("Invalid EventTypeValue");
+        }
+
+        static std::string GetArgs(Event const &event, ThreadBuffer const &buffer) {
+            switch(event.Type) {
+            case EventTypeValue::Round:
+            case EventTypeValue::RoundMerge:
+                return boost::str(boost::format("{\"round\":%1%}") % event.Round);
+
+            case EventTypeValue::Task:
+                return boost::str(boost::format("{\"round\":%1%,\"task\":%2%,\"numTasks\":%3%}") % event.Round % event.Task % event.NumTasks);
+
+            case EventTypeValue::TaskError:
+                return boost::str(boost::format("{\"round\":%1%,\"task\":%2%,\"what\":\"%3%\"}") % event.Round % event.Task % EscapeJson(buffer.Errors[event.Count]));
+
+            case EventTypeValue::Iteration:
+            case EventTypeValue::IterationGenerate:
+            case EventTypeValue::IterationMerge:
+                return boost::str(boost::format("{\"round\":%1%,\"task\":%2%,\"iteration\":%3%}") % event.Round % event.Task % event.Iteration);
+
+            case EventTypeValue::IterationFailedSystems:
+            case EventTypeValue::IterationResultSystems:
+                return boost::str(boost::format("{\"round\":%1%,\"task\":%2%,\"iteration\":%3%,\"count\":%4%}") % event.Round % event.Task % event.Iteration % event.Count);
+            }
+
+            throw std::logic_error("Invalid EventTypeValue");
+        }
+    };
+    // ----------------------------------------------------------------------
+
+    std::ofstream                           stream(filename, std::ios::binary | std::ios::trunc);
+
+    if(stream.is_open() == false)
+        throw std::runtime_error("Invalid trace file");
+
+    std::scoped_lock<decltype(_buffersMutex)>           lock(_buffersMutex); UNUSED(lock);
+
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool                                    isFirst(true);
+    size_t                                  threadIndex(0);
+
+    for(ThreadBuffer const &buffer : _buffers) {
+        ++threadIndex;
+
+        // The thread id is not meaningful to the viewer, so threads are numbered in the order
+        // in which they recorded their first event.
+        stream
+            << (isFirst ? "" : ",")
+            << boost::format("\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%1%,\"args\":{\"name\":\"Thread %1%\"}}") % threadIndex;
+
+        isFirst = false;
+
+        for(Event const &event : buffer.Events) {
+            stream
+                << boost::format("\n,{\"name\":\"%1%\",\"cat\":\"%2%\",\"ph\":\"%3%\",\"ts\":%4%.%5$03d,\"pid\":1,\"tid\":%6%%7%,\"args\":%8%}")
+                    % EscapeJson(Internal::GetName(event))
+                    % Internal::GetCategory(event.Type)
+                    % static_cast<char>(event.Phase)
+                    % (event.Nanoseconds / 1000)
+                    % (event.Nanoseconds % 1000)
+                    % threadIndex
+                    % (event.Phase == PhaseValue::Instant ? ",\"s\":\"t\"" : "")
+                    % Internal::GetArgs(event, buffer);
+        }
+    }
+
+    stream << "\n]}\n";
+
+    stream.flush();
+
+    if(stream.good() == false)
+        throw std::runtime_error("Invalid trace file");
+}
+
+size_t TraceObserver::GetNumEvents(void) const {
+    std::scoped_lock<decltype(_buffersMutex)>           lock(_buffersMutex); UNUSED(lock);
+
+    return std::accumulate(
+        _buffers.cbegin(),
+        _buffers.cend(),
+        static_cast<size_t>(0),
+        [](size_t total, ThreadBuffer const &buffer) {
+            return total + buffer.Events.size();
+        }
+    );
+}
+
+// Observer Methods
+TraceObserver::EventFlagValue TraceObserver::GetEventFlags(void) const /*override*/ {
+    return EventFlags | _observer.GetEventFlags();
+}
+
+bool TraceObserver::OnRoundBegin(size_t round, SystemPtrs const &pending) /*override*/ {
+    if(_observer.OnRoundBegin(round, pending) == false)
+        return false;
+
+    Record(EventTypeValue::Round, PhaseValue::Begin, round);
+    return true;
+}
+
+void TraceObserver::OnRoundEnd(size_t round, SystemPtrs const &pending) /*override*/ {
+    Record(EventTypeValue::Round, PhaseValue::End, round);
+    _observer.OnRoundEnd(round, pending);
+}
+
+bool TraceObserver::OnRoundMergingWork(size_t round, SystemPtrsContainer const &pending) /*override*/ {
+    if(_observer.OnRoundMergingWork(round, pending) == false)
+        return false;
+
+    Record(EventTypeValue::RoundMerge, PhaseValue::Begin, round);
+    return true;
+}
+
+void TraceObserver::OnRoundMergedWork(size_t round, SystemPtrs const &pending, SystemPtrsContainer removed) /*override*/ {
+    Record(EventTypeValue::RoundMerge, PhaseValue::End, round);
+    _observer.OnRoundMergedWork(round, pending, std::move(removed));
+}
+
+bool TraceObserver::OnTaskBegin(size_t round, size_t task, size_t numTasks) /*override*/ {
+    if(_observer.OnTaskBegin(round, task, numTasks) == false)
+        return false;
+
+    Record(EventTypeValue::Task, PhaseValue::Begin, round, task, numTasks);
+    return true;
+}
+
+void TraceObserver::OnTaskEnd(size_t round, size_t task, size_t numTasks) /*override*/ {
+    Record(EventTypeValue::Task, PhaseValue::End, round, task, numTasks);
+    _observer.OnTaskEnd(round, task, numTasks);
+}
+
+void TraceObserver::OnTaskError(size_t round, size_t task, size_t numTasks, std::exception const &ex) /*override*/ {
+    if(Components::EngineImpl::IsSet(EventFlags, EventFlagValue::TaskError)) {
+        ThreadBuffer &                      buffer(GetThreadBuffer());
+
+        buffer.Errors.emplace_back(ex.what());
+        Record(EventTypeValue::TaskError, PhaseValue::Instant, round, task, numTasks, 0, buffer.Errors.size() - 1);
+    }
+
+    _observer.OnTaskError(round, task, numTasks, ex);
+}
+
+bool TraceObserver::OnIterationBegin(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) /*override*/ {
+    if(_observer.OnIterationBegin(round, task, numTasks, iteration, numIterations) == false)
+        return false;
+
+    Record(EventTypeValue::Iteration, PhaseValue::Begin, round, task, numTasks, iteration);
+    return true;
+}
+
+void TraceObserver::OnIterationEnd(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) /*override*/ {
+    Record(EventTypeValue::Iteration, PhaseValue::End, round, task, numTasks, iteration);
+    _observer.OnIterationEnd(round, task, numTasks, iteration, numIterations);
+}
+
+bool TraceObserver::OnIterationGeneratingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active) /*override*/ {
+    if(_observer.OnIterationGeneratingWork(round, task, numTasks, iteration, numIterations, active) == false)
+        return false;
+
+    Record(EventTypeValue::IterationGenerate, PhaseValue::Begin, round, task, numTasks, iteration);
+    return true;
+}
+
+void TraceObserver::OnIterationGeneratedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated) /*override*/ {
+    Record(EventTypeValue::IterationGenerate, PhaseValue::End, round, task, numTasks, iteration, generated.size());
+    _observer.OnIterationGeneratedWork(round, task, numTasks, iteration, numIterations, active, generated);
+}
+
+bool TraceObserver::OnIterationMergingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated, SystemPtrs const &pending) /*override*/ {
+    if(_observer.OnIterationMergingWork(round, task, numTasks, iteration, numIterations, active, generated, pending) == false)
+        return false;
+
+    Record(EventTypeValue::IterationMerge, PhaseValue::Begin, round, task, numTasks, iteration);
+    return true;
+}
+
+void TraceObserver::OnIterationMergedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &pending, SystemPtrsContainer removed) /*override*/ {
+    Record(EventTypeValue::IterationMerge, PhaseValue::End, round, task, numTasks, iteration);
+    _observer.OnIterationMergedWork(round, task, numTasks, iteration, numIterations, active, pending, std::move(removed));
+}
+
+bool TraceObserver::OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) /*override*/ {
+    Record(EventTypeValue::IterationFailedSystems, PhaseValue::Instant, round, task, numTasks, iteration, static_cast<size_t>(std::distance(begin, end)));
+    return _observer.OnIterationFailedSystems(round, task, numTasks, iteration, numIterations, begin, end);
+}
+
+void TraceObserver::OnStatistics(Statistics const &statistics) /*override*/ {
+    _observer.OnStatistics(statistics);
+}
+
+// ResultObserver methods
+bool TraceObserver::OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs results) /*override*/ {
+    Record(EventTypeValue::IterationResultSystems, PhaseValue::Instant, round, task, numTasks, iteration, results.size());
+    return _observer.OnIterationResultSystems(round, task, numTasks, iteration, numIterations, std::move(results));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// static
+TraceObserver::EventFlagValue TraceObserver::GetEventFlag(EventTypeValue type) {
+    switch(type) {
+    case EventTypeValue::Round: return EventFlagValue::Round;
+    case EventTypeValue::RoundMerge: return EventFlagValue::RoundMerge;
+    case EventTypeValue::Task: return EventFlagValue::Task;
+    case EventTypeValue::TaskError: return EventFlagValue::TaskError;
+    case EventTypeValue::Iteration: return EventFlagValue::Iteration;
+    case EventTypeValue::IterationGenerate: return EventFlagValue::IterationGenerate;
+    case EventTypeValue::IterationMerge: return EventFlagValue::IterationMerge;
+    case EventTypeValue::IterationFailedSystems: return EventFlagValue::IterationFailedSystems;
+    case EventTypeValue::IterationResultSystems: return EventFlagValue::None;
+    }
+
+    throw std::logic_error("Invalid EventTypeValue");
+}
+
+TraceObserver::ThreadBuffer & TraceObserver::GetThreadBuffer(void) {
+    thread_local std::uint64_t              tlsId(0);
+    thread_local ThreadBuffer *             tlsBuffer(nullptr);
+
+    if(tlsId != _id) {
+        std::scoped_lock<decltype(_buffersMutex)>       lock(_buffersMutex); UNUSED(lock);
+
+        _buffers.emplace_back();
+
+        ThreadBuffer &                      buffer(_buffers.back());
+
+        buffer.ThreadId = std::this_thread::get_id();
+        buffer.Events.reserve(1024);
+
+        tlsId = _id;
+        tlsBuffer = &buffer;
+    }
+
+    assert(tlsBuffer);
+    return *tlsBuffer;
+}
+
+void TraceObserver::Record(EventTypeValue type, PhaseValue phase, size_t round, size_t task/*=0*/, size_t numTasks/*=0*/, size_t iteration/*=0*/, size_t count/*=0*/) {
+    // Result events are always recorded
+    EventFlagValue const                    flag(GetEventFlag(type));
+
+    if(flag != EventFlagValue::None && Components::EngineImpl::IsSet(EventFlags, flag) == false)
+        return;
+
+    std::uint64_t const                     nanoseconds(
+        static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count()
+        )
+    );
+
+    GetThreadBuffer().Events.emplace_back(
+        Event{
+            nanoseconds,
+            type,
+            phase,
+            round,
+            task,
+            numTasks,
+            iteration,
+            count
+        }
+    );
+}
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
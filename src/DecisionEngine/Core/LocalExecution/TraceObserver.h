@@ -0,0 +1,179 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          TraceObserver.h
+///  \brief         Contains the TraceObserver object
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:36:59
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Engine.h"
+
+#include <chrono>
+#include <thread>
+
+namespace DecisionEngine {
+namespace Core {
+namespace LocalExecution {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TraceObserver
+///  \brief         `ResultObserver` that records round, task, and iteration
+///                 events before forwarding them to another `ResultObserver`.
+///                 The recorded events can be written as Chrome trace-event
+///                 JSON (viewable in chrome://tracing or https://ui.perfetto.dev)
+///                 to show how tasks overlap across threads and where threads
+///                 are idle while waiting for a round to complete.
+///
+///                 Each thread records events into its own buffer; a lock is
+///                 only acquired the first time a thread records an event.
+///
+///                 Only events in `EventFlags` are recorded (result events are
+///                 always recorded). The events requested from the engine are
+///                 those in `EventFlags` and those requested by the wrapped
+///                 observer.
+///
+class TraceObserver : public Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    EventFlagValue const                    EventFlags;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TraceObserver(Engine::ResultObserver &observer, EventFlagValue eventFlags=EventFlagValue::All);
+    ~TraceObserver(void) override = default;
+
+    NON_COPYABLE(TraceObserver);
+    NON_MOVABLE(TraceObserver);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Write
+    ///  \brief         Writes the events recorded so far as Chrome trace-event JSON.
+    ///                 This method must not be called while events are being
+    ///                 recorded.
+    ///
+    void Write(std::filesystem::path const &filename) const;
+
+    /// Returns the number of events recorded across all threads.
+    size_t GetNumEvents(void) const;
+
+    // Observer Methods
+    EventFlagValue GetEventFlags(void) const override;
+
+    bool OnRoundBegin(size_t round, SystemPtrs const &pending) override;
+    void OnRoundEnd(size_t round, SystemPtrs const &pending) override;
+
+    bool OnRoundMergingWork(size_t round, SystemPtrsContainer const &pending) override;
+    void OnRoundMergedWork(size_t round, SystemPtrs const &pending, SystemPtrsContainer removed) override;
+
+    bool OnTaskBegin(size_t round, size_t task, size_t numTasks) override;
+    void OnTaskEnd(size_t round, size_t task, size_t numTasks) override;
+
+    void OnTaskError(size_t round, size_t task, size_t numTasks, std::exception const &ex) override;
+
+    bool OnIterationBegin(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) override;
+    void OnIterationEnd(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations) override;
+
+    bool OnIterationGeneratingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active) override;
+    void OnIterationGeneratedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated) override;
+
+    bool OnIterationMergingWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &generated, SystemPtrs const &pending) override;
+    void OnIterationMergedWork(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, WorkingSystem const &active, SystemPtrs const &pending, SystemPtrsContainer removed) override;
+
+    bool OnIterationFailedSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, SystemPtrs::const_iterator begin, SystemPtrs::const_iterator end) override;
+
+    void OnStatistics(Statistics const &statistics) override;
+
+    // ResultObserver methods
+    bool OnIterationResultSystems(size_t round, size_t task, size_t numTasks, size_t iteration, size_t numIterations, ResultSystemUniquePtrs results) override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    enum class EventTypeValue : unsigned char {
+        Round,
+        RoundMerge,
+        Task,
+        TaskError,
+        Iteration,
+        IterationGenerate,
+        IterationMerge,
+        IterationFailedSystems,
+        IterationResultSystems
+    };
+
+    enum class PhaseValue : char {
+        Begin = 'B',
+        End = 'E',
+        Instant = 'i'
+    };
+
+    struct Event {
+        std::uint64_t                       Nanoseconds;    /// Relative to the construction of the TraceObserver
+        EventTypeValue                      Type;
+        PhaseValue                          Phase;
+        size_t                              Round;
+        size_t                              Task;
+        size_t                              NumTasks;
+        size_t                              Iteration;
+        size_t                              Count;          /// Number of systems or index into `ThreadBuffer::Errors`
+    };
+
+    struct ThreadBuffer {
+        std::thread::id                     ThreadId;
+        std::vector<Event>                  Events;
+        std::vector<std::string>            Errors;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    Engine::ResultObserver &                _observer;
+
+    std::uint64_t const                     _id;
+    std::chrono::steady_clock::time_point const         _start;
+
+    mutable std::mutex                      _buffersMutex;
+    std::deque<ThreadBuffer>                _buffers;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static EventFlagValue GetEventFlag(EventTypeValue type);
+
+    ThreadBuffer & GetThreadBuffer(void);
+
+    void Record(EventTypeValue type, PhaseValue phase, size_t round, size_t task=0, size_t numTasks=0, size_t iteration=0, size_t count=0);
+};
+
+} // namespace LocalExecution
+} // namespace Core
+} // namespace DecisionEngine
@@ -0,0 +1,322 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AnytimeObserver_UnitTest.cpp
+///  \brief         Unit test for AnytimeObserver.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:53:16
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../AnytimeObserver.h"
+#include <catch.hpp>
+
+#include <DecisionEngine/Core/Components/Condition.h>
+#include <DecisionEngine/Core/Components/ResultSystem.h>
+#include <DecisionEngine/Core/Components/WorkingSystem.h>
+
+#include <CommonHelpers/Stl.h>
+
+#include <fstream>
+
+namespace Components                        = DecisionEngine::Core::Components;
+namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyObserver : public LocalExecution::Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t                                  NumEvents;
+    size_t                                  NumResults;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyObserver(void) :
+        NumEvents(0),
+        NumResults(0)
+    {}
+
+    ~MyObserver(void) override = default;
+
+    EventFlagValue GetEventFlags(void) const override { return EventFlagValue::None; }
+
+    bool OnRoundBegin(size_t, SystemPtrs const &) override { ++NumEvents; return true; }
+    void OnRoundEnd(size_t, SystemPtrs const &) override { ++NumEvents; }
+
+    bool OnRoundMergingWork(size_t, SystemPtrsContainer const &) override { ++NumEvents; return true; }
+    void OnRoundMergedWork(size_t, SystemPtrs const &, SystemPtrsContainer) override { ++NumEvents; }
+
+    bool OnTaskBegin(size_t, size_t, size_t) override { ++NumEvents; return true; }
+    void OnTaskEnd(size_t, size_t, size_t) override { ++NumEvents; }
+
+    void OnTaskError(size_t, size_t, size_t, std::exception const &) override { ++NumEvents; }
+
+    bool OnIterationBegin(size_t, size_t, size_t, size_t, size_t) override { ++NumEvents; return true; }
+    void OnIterationEnd(size_t, size_t, size_t, size_t, size_t) override { ++NumEvents; }
+
+    bool OnIterationGeneratingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &) override { ++NumEvents; return true; }
+    void OnIterationGeneratedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &) override { ++NumEvents; }
+
+    bool OnIterationMergingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { ++NumEvents; return true; }
+    void OnIterationMergedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override { ++NumEvents; }
+
+    bool OnIterationFailedSystems(size_t, size_t, size_t, size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { ++NumEvents; return true; }
+
+    bool OnIterationResultSystems(size_t, size_t, size_t, size_t, size_t, ResultSystemUniquePtrs results) override { ++NumEvents; NumResults += results.size(); return true; }
+};
+
+class MyResultSystem : public Components::ResultSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::ResultSystem::ResultSystem;
+
+#define ARGS                                BASES(Components::ResultSystem)
+
+    NON_COPYABLE(MyResultSystem);
+    MOVE(MyResultSystem, ARGS);
+    COMPARE(MyResultSystem, ARGS);
+    SERIALIZATION(MyResultSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return "MyResultSystem";
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResultSystem);
+
+class MyWorkingSystem : public Components::WorkingSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::WorkingSystem::WorkingSystem;
+
+#define ARGS                                BASES(Components::WorkingSystem)
+
+    NON_COPYABLE(MyWorkingSystem);
+    MOVE(MyWorkingSystem, ARGS);
+    COMPARE(MyWorkingSystem, ARGS);
+    SERIALIZATION(MyWorkingSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override { return "MyWorkingSystem"; }
+
+    bool IsComplete(void) const override { return false; }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    SystemPtrs GenerateChildrenImpl(size_t, bool) override { return SystemPtrs(); }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyWorkingSystem);
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+
+Components::Condition::Result::ConditionPtr const   g_pCondition(Components::Condition::Create("Preference", static_cast<unsigned short>(1)));
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+LocalExecution::Engine::ResultObserver::ResultSystemUniquePtrs CreateResults(std::vector<float> const &ratios) {
+    LocalExecution::Engine::ResultObserver::ResultSystemUniquePtrs      results;
+
+    for(float ratio : ratios) {
+        results.emplace_back(
+            std::make_unique<MyResultSystem>(
+                Components::Score(
+                    Components::Score::Result(
+                        Components::Score::Result::ConditionResults{},
+                        Components::Score::Result::ConditionResults{},
+                        CommonHelpers::Stl::CreateVector<Components::Condition::Result>(Components::Condition::Result(g_pCondition, ratio))
+                    ),
+                    true
+                ),
+                Components::Index(results.size())
+            )
+        );
+    }
+
+    return results;
+}
+
+std::vector<std::string> ReadLines(std::filesystem::path const &filename) {
+    std::ifstream                           stream(filename);
+    std::vector<std::string>                lines;
+    std::string                             line;
+
+    while(std::getline(stream, line))
+        lines.emplace_back(std::move(line));
+
+    return lines;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  AnytimeObserver
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("GetEventFlags") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+
+    CHECK(
+        anytimeObserver.GetEventFlags() == (
+            LocalExecution::AnytimeObserver::EventFlagValue::Round
+            | LocalExecution::AnytimeObserver::EventFlagValue::IterationGenerate
+        )
+    );
+}
+
+TEST_CASE("GetQuality") {
+    CHECK(LocalExecution::AnytimeObserver::GetQuality(Components::Score()) == 0.0);
+
+    double const                            low(LocalExecution::AnytimeObserver::GetQuality(CreateResults({0.25f})[0]->GetScore()));
+    double const                            high(LocalExecution::AnytimeObserver::GetQuality(CreateResults({0.75f})[0]->GetScore()));
+
+    CHECK(low > 0.0);
+    CHECK(low < high);
+    CHECK(high <= 1.0);
+}
+
+TEST_CASE("Improvements") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+
+    CHECK(anytimeObserver.OnIterationResultSystems(0, 0, 1, 0, 1, CreateResults({0.5f, 0.25f})));
+    CHECK(anytimeObserver.OnIterationResultSystems(1, 0, 1, 0, 1, CreateResults({0.25f})));
+    CHECK(anytimeObserver.OnIterationResultSystems(2, 0, 1, 0, 1, CreateResults({0.75f})));
+
+    CHECK(observer.NumEvents == 3);
+    CHECK(observer.NumResults == 4);
+
+    LocalExecution::AnytimeObserver::Improvements const &   improvements(anytimeObserver.GetImprovements());
+
+    REQUIRE(improvements.size() == 2);
+    CHECK(improvements[0].Round == 0);
+    CHECK(improvements[1].Round == 2);
+    CHECK(improvements[0].Seconds <= improvements[1].Seconds);
+    CHECK(improvements[0].Quality < improvements[1].Quality);
+    CHECK(improvements[0].Score.empty() == false);
+}
+
+TEST_CASE("Rounds") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+    MyWorkingSystem const                   active;
+    LocalExecution::Engine::SystemPtrs      generated(3);
+    LocalExecution::Engine::SystemPtrs      pending(2);
+
+    CHECK(anytimeObserver.OnRoundBegin(0, pending));
+    CHECK(anytimeObserver.OnIterationGeneratingWork(0, 0, 1, 0, 2, active));
+    anytimeObserver.OnIterationGeneratedWork(0, 0, 1, 0, 2, active, generated);
+    CHECK(anytimeObserver.OnIterationGeneratingWork(0, 0, 1, 1, 2, active));
+    anytimeObserver.OnIterationGeneratedWork(0, 0, 1, 1, 2, active, generated);
+    anytimeObserver.OnRoundEnd(0, pending);
+
+    CHECK(anytimeObserver.OnRoundBegin(1, pending));
+    anytimeObserver.OnRoundEnd(1, LocalExecution::Engine::SystemPtrs());
+
+    CHECK(observer.NumEvents == 8);
+
+    LocalExecution::AnytimeObserver::RoundInfos const &     rounds(anytimeObserver.GetRounds());
+
+    REQUIRE(rounds.size() == 2);
+    CHECK(rounds[0].Round == 0);
+    // Each active system is counted once, regardless of the number of children generated
+    CHECK(rounds[0].NumExpandedSystems == 2);
+    CHECK(rounds[0].NumPendingSystems == 2);
+    CHECK(rounds[1].Round == 1);
+    CHECK(rounds[1].NumExpandedSystems == 0);
+    CHECK(rounds[1].NumPendingSystems == 0);
+    CHECK(rounds[0].Seconds <= rounds[1].Seconds);
+}
+
+TEST_CASE("GetAreaUnderCurve") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+
+    CHECK(anytimeObserver.GetAreaUnderCurve(1.0) == 0.0);
+
+    CHECK(anytimeObserver.OnIterationResultSystems(0, 0, 1, 0, 1, CreateResults({0.5f})));
+
+    double const                            quality(anytimeObserver.GetImprovements().back().Quality);
+    double const                            seconds(anytimeObserver.GetImprovements().back().Seconds);
+    double const                            endSeconds(seconds + 10.0);
+
+    CHECK(anytimeObserver.GetAreaUnderCurve(endSeconds) == Approx((endSeconds - seconds) * quality / endSeconds));
+    CHECK(anytimeObserver.GetAreaUnderCurve(endSeconds) <= quality);
+
+    CHECK_THROWS_MATCHES(anytimeObserver.GetAreaUnderCurve(0.0), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("endSeconds"));
+}
+
+TEST_CASE("Write") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+    std::filesystem::path const             improvementsFilename(std::filesystem::temp_directory_path() / "AnytimeObserver_UnitTest.improvements.csv");
+    std::filesystem::path const             roundsFilename(std::filesystem::temp_directory_path() / "AnytimeObserver_UnitTest.rounds.csv");
+
+    FINALLY(
+        [&improvementsFilename, &roundsFilename](void) {
+            std::error_code                 ec;
+
+            std::filesystem::remove(improvementsFilename, ec);
+            std::filesystem::remove(roundsFilename, ec);
+        }
+    );
+
+    CHECK(anytimeObserver.OnRoundBegin(0, LocalExecution::Engine::SystemPtrs()));
+    CHECK(anytimeObserver.OnIterationResultSystems(0, 0, 1, 0, 1, CreateResults({0.5f})));
+    anytimeObserver.OnRoundEnd(0, LocalExecution::Engine::SystemPtrs());
+
+    anytimeObserver.WriteImprovements(improvementsFilename);
+    anytimeObserver.WriteRounds(roundsFilename);
+
+    std::vector<std::string> const          improvementLines(ReadLines(improvementsFilename));
+
+    REQUIRE(improvementLines.size() == 2);
+    CHECK(improvementLines[0] == "seconds,round,quality,score");
+    CHECK(improvementLines[1].find(",0,") != std::string::npos);
+    CHECK(improvementLines[1].back() == '"');
+
+    std::vector<std::string> const          roundLines(ReadLines(roundsFilename));
+
+    REQUIRE(roundLines.size() == 2);
+    CHECK(roundLines[0] == "round,seconds,expanded_systems,pending_systems");
+    CHECK(roundLines[1].substr(0, 2) == "0,");
+    CHECK(roundLines[1].substr(roundLines[1].size() - 4) == ",0,0");
+}
+
+TEST_CASE("Write - Errors") {
+    MyObserver                              observer;
+    LocalExecution::AnytimeObserver         anytimeObserver(observer);
+    std::filesystem::path const             filename(std::filesystem::temp_directory_path() / "__does_not_exist__" / "Anytime.csv");
+
+    CHECK_THROWS_MATCHES(anytimeObserver.WriteImprovements(filename), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid csv file"));
+    CHECK_THROWS_MATCHES(anytimeObserver.WriteRounds(filename), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid csv file"));
+}
@@ -27,8 +27,11 @@
 
 #include <DecisionEngine/Core/Components/Condition.h>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
+#include <fstream>
+
 namespace Components                        = DecisionEngine::Core::Components;
 namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
 
@@ -373,7 +376,7 @@ public:
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
-    virtual SystemPtrs GenerateChildrenImpl(size_t maxNumChildren) override {
+    virtual SystemPtrs GenerateChildrenImpl(size_t maxNumChildren, bool) override {
         // ----------------------------------------------------------------------
         using CreateSystemFunc              = std::function<LocalExecution::Engine::SystemPtr (Components::Score, Components::Index)>;
         // ----------------------------------------------------------------------
@@ -1712,3 +1715,458 @@ TEST_CASE("Deterministic: 1,2,3,4,5,6,7 - 10 - 1") {
 }
 
 #endif
+
+class MyStatisticsObserver : public MyObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    LocalExecution::Engine::EventFlagValue const        EventFlags;
+
+    size_t                                              NumCalls;
+    Statistics                                          Values;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyStatisticsObserver(LocalExecution::Engine::EventFlagValue eventFlags) :
+        EventFlags(eventFlags),
+        NumCalls(0)
+    {}
+
+    ~MyStatisticsObserver(void) override = default;
+
+    LocalExecution::Engine::EventFlagValue GetEventFlags(void) const override {
+        return EventFlags;
+    }
+
+    void OnStatistics(Statistics const &statistics) override {
+        ++NumCalls;
+        Values = statistics;
+    }
+};
+
+TEST_CASE("Statistics") {
+    using Statistics                                    = LocalExecution::Engine::Statistics;
+
+    LocalExecution::Engine::ExecuteResultValue          result;
+    LocalExecution::Engine::ResultSystemUniquePtr       pResult;
+    Configuration                                       configuration(10, true);
+
+    // Statistics are only delivered when requested
+    {
+        MyStatisticsObserver                            observer(LocalExecution::Engine::EventFlagValue::None);
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true))
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(observer.NumCalls == 0);
+    }
+
+    MyStatisticsObserver                                observer(LocalExecution::Engine::EventFlagValue::Statistics);
+
+    std::tie(result, pResult) = LocalExecution::Engine::Execute(
+        configuration,
+        observer,
+        MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true))
+    );
+
+    CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+    REQUIRE(pResult);
+    CHECK(observer.GetStrings().empty());
+    CHECK(observer.NumCalls == (Statistics::IsEnabled ? 1 : 0));
+
+    Statistics const &                                  statistics(observer.Values);
+
+    if(Statistics::IsEnabled) {
+        CHECK(statistics.NumRounds == 1);
+        CHECK(statistics.NumTasks == 1);
+        CHECK(statistics.NumIterations == 1);
+        CHECK(statistics.NumGeneratedSystems == 10);
+        CHECK(statistics.NumResultSystems == 1);
+        CHECK(statistics.NumFailedSystems == 9);
+        CHECK(statistics.NumFingerprintedSystems == 0);
+
+        CHECK(statistics.GetCount(Statistics::PhaseValue::Commit) == 0);
+        CHECK(statistics.GetCount(Statistics::PhaseValue::GenerateChildren) == 1);
+        CHECK(statistics.GetCount(Statistics::PhaseValue::Sort) == 1);
+        CHECK(statistics.GetCount(Statistics::PhaseValue::Fingerprint) == 0);
+        CHECK(statistics.GetCount(Statistics::PhaseValue::ResultCommit) == 1);
+        CHECK(statistics.GetCount(Statistics::PhaseValue::Merge) == 0);
+    }
+    else
+        CHECK(statistics.ToString() == "Statistics(0,0,0,0,0,0,0,Commit(0,0),GenerateChildren(0,0),Sort(0,0),Fingerprint(0,0),ResultCommit(0,0),Merge(0,0))");
+
+    Statistics                                          combined;
+
+    combined += statistics;
+    combined += statistics;
+
+    CHECK(combined.NumRounds == statistics.NumRounds * 2);
+    CHECK(combined.GetNanoseconds(Statistics::PhaseValue::GenerateChildren) == statistics.GetNanoseconds(Statistics::PhaseValue::GenerateChildren) * 2);
+}
+
+class MyFilteredObserver : public MyObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    LocalExecution::Engine::EventFlagValue const        EventFlags;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyFilteredObserver(LocalExecution::Engine::EventFlagValue eventFlags) :
+        EventFlags(eventFlags)
+    {}
+
+    ~MyFilteredObserver(void) override = default;
+
+    LocalExecution::Engine::EventFlagValue GetEventFlags(void) const override {
+        return EventFlags;
+    }
+};
+
+TEST_CASE("Event flags") {
+    using EventFlagValue                                = LocalExecution::Engine::EventFlagValue;
+
+    LocalExecution::Engine::ExecuteResultValue          result;
+    LocalExecution::Engine::ResultSystemUniquePtr       pResult;
+    Configuration                                       configuration(10, true);
+
+    SECTION("None") {
+        MyFilteredObserver                              observer(EventFlagValue::None);
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true))
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(GetIndexes(*pResult) == std::vector<Components::Index::value_type>{0});
+        CHECK(observer.GetStrings().empty());
+    }
+
+    SECTION("Round and Task") {
+        MyFilteredObserver                              observer(EventFlagValue::Round | EventFlagValue::Task);
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true))
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(GetIndexes(*pResult) == std::vector<Components::Index::value_type>{0});
+        CHECK(
+            observer.GetStrings() ==
+            std::vector<std::string>{
+                "OnRoundBegin: 0, pending [MyWorkingSystem(Score(Pending(1,100001.00,0,0)),Index())]",
+                "OnRoundEnd: 0, pending []",
+                "OnTaskBegin: 0, 0, 1",
+                "OnTaskEnd: 0, 0, 1"
+            }
+        );
+    }
+
+    SECTION("Failed systems") {
+        MyFilteredObserver                              observer(EventFlagValue::IterationFailedSystems);
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true))
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(observer.GetStrings() == std::vector<std::string>{ "OnIterationFailedSystems: 0, 0, 1, 0, -1, 9" });
+    }
+}
+
+class NumaConfiguration : public Configuration {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    NumaConfiguration(void) :
+        Configuration(10, true, 4)
+    {}
+
+    bool IsNumaAware(void) const override {
+        return true;
+    }
+};
+
+TEST_CASE("NUMA aware") {
+    // The same systems are processed in each round; only the assignment of
+    // systems to tasks (and threads) changes.
+    MyWorkingSystem::MyConditionPtr const               pCondition(MyCondition::Create(MyCondition::IndexesType{5, 4}, false));
+
+    auto const                                          executeFunc(
+        [&pCondition](LocalExecution::Configuration &configuration) {
+            MyObserver                                  observer;
+            LocalExecution::Engine::ExecuteResultValue  result;
+            LocalExecution::Engine::ResultSystemUniquePtrs          results;
+
+            std::tie(result, results) = LocalExecution::Engine::Execute(
+                configuration,
+                observer,
+                MyWorkingSystem(2, pCondition),
+                1000
+            );
+
+            CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+
+            std::vector<std::vector<Components::Index::value_type>>     allIndexes;
+
+            for(auto const &pResult : results)
+                allIndexes.emplace_back(GetIndexes(*pResult));
+
+            // Results are delivered by concurrent tasks
+            std::sort(allIndexes.begin(), allIndexes.end());
+            return allIndexes;
+        }
+    );
+
+    Configuration                                       standardConfiguration(10, true, 4);
+    NumaConfiguration                                   numaConfiguration;
+
+    std::vector<std::vector<Components::Index::value_type>> const   expected(executeFunc(standardConfiguration));
+
+    CHECK(expected.size() == 100);
+    CHECK(executeFunc(numaConfiguration) == expected);
+}
+
+class CheckpointConfiguration : public Configuration {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::filesystem::path const             Filename;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    // A single task ensures that results are found in a consistent order
+    CheckpointConfiguration(std::filesystem::path filename) :
+        Configuration(1, true, 1),
+        Filename(std::move(filename))
+    {}
+
+    // A single iteration per round ensures that there are many opportunities
+    // to write a checkpoint.
+    size_t GetMaxNumIterationsPerRound(WorkingSystem const &) const override {
+        return 1;
+    }
+
+    boost::optional<std::filesystem::path> GetCheckpointFilename(void) const override {
+        return Filename;
+    }
+
+    std::chrono::steady_clock::duration GetCheckpointInterval(void) const override {
+        return std::chrono::steady_clock::duration::zero();
+    }
+};
+
+TEST_CASE("Checkpoint and Resume") {
+    std::filesystem::path const                         filename(std::filesystem::temp_directory_path() / "Engine_UnitTest.checkpoint");
+    MyWorkingSystem::MyConditionPtr const               pCondition(MyCondition::Create(MyCondition::IndexesType{5, 4, 3, 2, 1}, false));
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    // Uninterrupted
+    LocalExecution::Engine::ExecuteResultValue          result;
+    LocalExecution::Engine::ResultSystemUniquePtrs      expected;
+
+    {
+        CheckpointConfiguration                         configuration(filename);
+        MyObserver                                      observer;
+
+        std::tie(result, expected) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(1, pCondition),
+            3
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(expected.size() == 3);
+
+        // The checkpoint is removed once the search completes
+        CHECK(std::filesystem::exists(filename) == false);
+    }
+
+    // Interrupted once the first result is found
+    {
+        CheckpointConfiguration                         configuration(filename);
+        MyObserver                                      observer;
+        LocalExecution::Engine::ResultSystemUniquePtr   pResult;
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(1, pCondition)
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(GetIndexes(*pResult) == GetIndexes(*expected[0]));
+        CHECK(std::filesystem::exists(filename));
+    }
+
+    // Resumed
+    {
+        CheckpointConfiguration                         configuration(filename);
+        MyObserver                                      observer;
+        LocalExecution::Engine::ResultSystemUniquePtrs  results;
+
+        std::tie(result, results) = LocalExecution::Engine::Resume(
+            configuration,
+            observer,
+            filename,
+            3
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(results.size() == expected.size());
+
+        for(size_t index = 0; index < results.size(); ++index)
+            CHECK(GetIndexes(*results[index]) == GetIndexes(*expected[index]));
+
+        CHECK(std::filesystem::exists(filename) == false);
+    }
+}
+
+class SpillingCheckpointConfiguration : public CheckpointConfiguration {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using CheckpointConfiguration::CheckpointConfiguration;
+
+    // All but one pending system are spilled to disk
+    boost::optional<size_t> GetMaxNumPendingSystemBytes(void) const override {
+        return 1;
+    }
+};
+
+TEST_CASE("Checkpoint and Resume - Spilled") {
+    // ----------------------------------------------------------------------
+    using Strings                                       = std::vector<std::string>;
+    // ----------------------------------------------------------------------
+
+    std::filesystem::path const                         filename(std::filesystem::temp_directory_path() / "Engine_UnitTest.spilled_checkpoint");
+    MyWorkingSystem::MyConditionPtr const               pCondition(MyCondition::Create(MyCondition::IndexesType{5, 4, 3, 2, 1}, false));
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    // Returns the systems processed in each round, which are the best pending systems;
+    // a resumed search only processes the same systems if every pending system
+    // (including those that were spilled) was restored from the checkpoint.
+    auto const                                          getActiveFunc(
+        [](MyObserver &observer) {
+            Strings                                     results;
+
+            for(std::string const &str : observer.GetStrings(false)) {
+                if(boost::algorithm::starts_with(str, "OnIterationGeneratingWork: "))
+                    results.emplace_back(str);
+            }
+
+            return results;
+        }
+    );
+
+    // Uninterrupted
+    LocalExecution::Engine::ExecuteResultValue          result;
+    LocalExecution::Engine::ResultSystemUniquePtrs      expected;
+    Strings                                             expectedActive;
+
+    {
+        SpillingCheckpointConfiguration                 configuration(filename);
+        MyObserver                                      observer;
+
+        std::tie(result, expected) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(1, pCondition),
+            3
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(expected.size() == 3);
+
+        expectedActive = getActiveFunc(observer);
+    }
+
+    // Interrupted once the first result is found
+    Strings                                             interruptedActive;
+
+    {
+        SpillingCheckpointConfiguration                 configuration(filename);
+        MyObserver                                      observer;
+        LocalExecution::Engine::ResultSystemUniquePtr   pResult;
+
+        std::tie(result, pResult) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(1, pCondition)
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(pResult);
+        CHECK(std::filesystem::exists(filename));
+
+        interruptedActive = getActiveFunc(observer);
+    }
+
+    // Resumed
+    {
+        SpillingCheckpointConfiguration                 configuration(filename);
+        MyObserver                                      observer;
+        LocalExecution::Engine::ResultSystemUniquePtrs  results;
+
+        std::tie(result, results) = LocalExecution::Engine::Resume(
+            configuration,
+            observer,
+            filename,
+            3
+        );
+
+        CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+        REQUIRE(results.size() == expected.size());
+
+        for(size_t index = 0; index < results.size(); ++index)
+            CHECK(GetIndexes(*results[index]) == GetIndexes(*expected[index]));
+
+        Strings const                                   resumedActive(getActiveFunc(observer));
+
+        REQUIRE(resumedActive.empty() == false);
+        REQUIRE(interruptedActive.size() <= expectedActive.size());
+        REQUIRE(resumedActive.size() <= expectedActive.size());
+
+        // Both searches process the same systems as the uninterrupted search;
+        // the resumed search continues with the systems that were pending when
+        // the checkpoint was written.
+        CHECK(std::equal(interruptedActive.begin(), interruptedActive.end(), expectedActive.begin()));
+        CHECK(std::equal(resumedActive.rbegin(), resumedActive.rend(), expectedActive.rbegin()));
+    }
+}
+
+TEST_CASE("Resume - Errors") {
+    std::filesystem::path const                         filename(std::filesystem::temp_directory_path() / "Engine_UnitTest.invalid_checkpoint");
+    Configuration                                       configuration(10, true);
+    MyObserver                                          observer;
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    CHECK_THROWS_MATCHES(LocalExecution::Engine::Resume(configuration, observer, filename), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("checkpointFilename"));
+
+    {
+        std::ofstream                                   stream(filename);
+
+        stream << "This is not a checkpoint";
+    }
+
+    CHECK_THROWS_MATCHES(LocalExecution::Engine::Resume(configuration, observer, filename), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid checkpoint file"));
+}
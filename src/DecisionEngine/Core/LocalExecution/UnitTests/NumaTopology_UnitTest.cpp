@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          NumaTopology_UnitTest.cpp
+///  \brief         Unit test for NumaTopology.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:14:46
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../NumaTopology.h"
+#include <catch.hpp>
+
+namespace NS                                = DecisionEngine::Core::LocalExecution;
+
+TEST_CASE("ParseCpuList") {
+    CHECK(NS::NumaTopology::ParseCpuList("") == NS::NumaTopology::CpuIndexes());
+    CHECK(NS::NumaTopology::ParseCpuList("3") == NS::NumaTopology::CpuIndexes{3});
+    CHECK(NS::NumaTopology::ParseCpuList("0-3") == NS::NumaTopology::CpuIndexes{0, 1, 2, 3});
+    CHECK(NS::NumaTopology::ParseCpuList("0-1,8,10-11\n") == NS::NumaTopology::CpuIndexes{0, 1, 8, 10, 11});
+}
+
+TEST_CASE("ParseCpuList - Errors") {
+    for(char const *value : { "a", "1,", ",1", "3-1", "1-", "1;2" })
+        CHECK_THROWS_MATCHES(NS::NumaTopology::ParseCpuList(value), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid cpulist"));
+}
+
+TEST_CASE("Construct") {
+    NS::NumaTopology const                  topology(NS::NumaTopology::NodeCpus{ {0, 1}, {2, 3} });
+
+    CHECK(topology.NumNodes() == 2);
+    CHECK(topology.Nodes[1] == NS::NumaTopology::CpuIndexes{2, 3});
+
+    CHECK_THROWS_MATCHES(NS::NumaTopology(NS::NumaTopology::NodeCpus()), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("nodes"));
+    CHECK_THROWS_MATCHES(NS::NumaTopology(NS::NumaTopology::NodeCpus{ {0}, {} }), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("nodes"));
+}
+
+TEST_CASE("Get") {
+    NS::NumaTopology const &                topology(NS::NumaTopology::Get());
+
+    REQUIRE(topology.NumNodes() >= 1);
+
+    for(NS::NumaTopology::CpuIndexes const &cpus : topology.Nodes)
+        CHECK(cpus.empty() == false);
+
+    CHECK(&NS::NumaTopology::Get() == &topology);
+}
+
+TEST_CASE("ScopedThreadAffinity") {
+    // Threads aren't pinned when there is a single node
+    NS::NumaTopology const                  topology(NS::NumaTopology::NodeCpus{ {0} });
+
+    {
+        NS::NumaTopology::ScopedThreadAffinity          affinity(topology, 0);
+
+        CHECK(affinity.IsPinned() == false);
+    }
+
+    CHECK_THROWS_MATCHES(NS::NumaTopology::ScopedThreadAffinity(topology, 1), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("node"));
+}
+
+TEST_CASE("PinThread") {
+    // Threads aren't pinned when there is a single node
+    NS::NumaTopology const                  topology(NS::NumaTopology::NodeCpus{ {0} });
+
+    CHECK(topology.PinThread(0) == false);
+    CHECK_THROWS_MATCHES(topology.PinThread(1), std::invalid_argument, Catch::Matchers::Exception::ExceptionMessageMatcher("node"));
+}
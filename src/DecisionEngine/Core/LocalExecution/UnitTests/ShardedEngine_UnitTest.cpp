@@ -0,0 +1,531 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ShardedEngine_UnitTest.cpp
+///  \brief         Unit test for ShardedEngine.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 11:12:07
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../ShardedEngine.h"
+#include <catch.hpp>
+
+#include <DecisionEngine/Core/Components/Condition.h>
+
+#include <future>
+#include <thread>
+
+namespace Components                        = DecisionEngine::Core::Components;
+namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyObserver : public LocalExecution::Engine::Observer {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::vector<std::string>                errors;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    ~MyObserver(void) override = default;
+
+    bool OnRoundBegin(size_t, SystemPtrs const &) override { return true; }
+    void OnRoundEnd(size_t, SystemPtrs const &) override {}
+    bool OnRoundMergingWork(size_t, SystemPtrsContainer const &) override { return true; }
+    void OnRoundMergedWork(size_t, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnTaskBegin(size_t, size_t, size_t) override { return true; }
+    void OnTaskEnd(size_t, size_t, size_t) override {}
+    void OnTaskError(size_t, size_t, size_t, std::exception const &ex) override { errors.emplace_back(ex.what()); }
+    bool OnIterationBegin(size_t, size_t, size_t, size_t, size_t) override { return true; }
+    void OnIterationEnd(size_t, size_t, size_t, size_t, size_t) override {}
+    bool OnIterationGeneratingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &) override { return true; }
+    void OnIterationGeneratedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &) override {}
+    bool OnIterationMergingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { return true; }
+    void OnIterationMergedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override {}
+    bool OnIterationFailedSystems(size_t, size_t, size_t, size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { return true; }
+};
+
+class MyCondition : public Components::Condition {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using IndexesType                       = std::vector<Components::Index::value_type>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    IndexesType const                       Indexes;
+    bool const                              MismatchesAreFailures;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CREATE(MyCondition);
+
+    template <typename PrivateConstructorTagT>
+    MyCondition(PrivateConstructorTagT tag, IndexesType indexes, bool mismatchesAreFailures) :
+        Components::Condition(tag, "MyCondition", 10000),
+        Indexes(
+            std::move(
+                [&indexes](void) -> IndexesType & {
+                    ENSURE_ARGUMENT(indexes, indexes.empty() == false);
+                    return indexes;
+                }()
+            )
+        ),
+        MismatchesAreFailures(mismatchesAreFailures)
+    {}
+
+#define ARGS                                MEMBERS(Indexes, MismatchesAreFailures), BASES(Components::Condition)
+
+    NON_COPYABLE(MyCondition);
+    MOVE(MyCondition, ARGS);
+    COMPARE(MyCondition, ARGS);
+    SERIALIZATION(MyCondition, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT, SERIALIZATION_POLYMORPHIC(Components::Condition)));
+
+#undef ARGS
+
+    Result Apply(Components::Index const &index) const {
+        IndexesType::const_iterator         iter(Indexes.begin());
+        bool const                          enumeratedAll(
+            index.Enumerate(
+                [this, &iter](Components::Index::value_type value) {
+                    if(value != *iter)
+                        return false;
+
+                    ++iter;
+                    return iter != Indexes.end();
+                }
+            )
+        );
+
+        float                               ratio(
+            [this, &iter, &enumeratedAll](void) {
+                if(enumeratedAll || iter == Indexes.end())
+                    return 1.0f;
+
+                if(Indexes.size() == 1)
+                    return 0.0f;
+
+                return static_cast<float>(std::distance(Indexes.begin(), iter)) / static_cast<float>(Indexes.size());
+            }()
+        );
+
+        return Result(
+            SharedFromThis(),
+            ratio == 1.0f || MismatchesAreFailures == false,
+            ratio
+        );
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyCondition);
+
+class MyResultSystem : public Components::ResultSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::ResultSystem::ResultSystem;
+
+#define ARGS                                BASES(Components::ResultSystem)
+
+    NON_COPYABLE(MyResultSystem);
+    MOVE(MyResultSystem, ARGS);
+    COMPARE(MyResultSystem, ARGS);
+    SERIALIZATION(MyResultSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(
+            boost::format("MyResultSystem(%s,%s)")
+                % GetScore().ToString()
+                % GetIndex().ToString()
+        );
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyResultSystem);
+
+class MyCalculatedResultSystem : public Components::CalculatedResultSystem {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    using Components::CalculatedResultSystem::CalculatedResultSystem;
+
+#define ARGS                                BASES(Components::CalculatedResultSystem)
+
+    NON_COPYABLE(MyCalculatedResultSystem);
+    MOVE(MyCalculatedResultSystem, ARGS);
+    COMPARE(MyCalculatedResultSystem, ARGS);
+    SERIALIZATION(MyCalculatedResultSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(
+            boost::format("MyCalculatedResultSystem(%s,%s)")
+                % GetScore().ToString()
+                % GetIndex().ToString()
+        );
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    ResultSystemUniquePtr CommitImpl(Score score, Index index) override {
+        return std::make_unique<MyResultSystem>(std::move(score), std::move(index));
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyCalculatedResultSystem);
+
+class MyWorkingSystem : public Components::WorkingSystem {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+    size_t                                  _childIndex;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using MyConditionPtr                    = std::shared_ptr<MyCondition>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t const                            ChildrenPerIteration;
+    size_t const                            ChildrenToGenerate;
+    MyConditionPtr const                    Condition;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyWorkingSystem(size_t childrenPerIteration, MyConditionPtr pCondition) :
+        MyWorkingSystem(
+            std::move(childrenPerIteration),
+            std::move(pCondition),
+            Components::Score(),
+            Components::Index()
+        )
+    {}
+
+    MyWorkingSystem(size_t childrenPerIteration, MyConditionPtr pCondition, Components::Score score, Components::Index index) :
+        Components::WorkingSystem(std::move(score), std::move(index)),
+        _childIndex(0),
+        ChildrenPerIteration(
+            std::move(
+                [&childrenPerIteration](void) -> size_t & {
+                    ENSURE_ARGUMENT(childrenPerIteration);
+                    return childrenPerIteration;
+                }()
+            )
+        ),
+        ChildrenToGenerate(10),
+        Condition(
+            std::move(
+                [&pCondition](void) -> MyConditionPtr & {
+                    ENSURE_ARGUMENT(pCondition);
+                    return pCondition;
+                }()
+            )
+        )
+    {}
+
+#define ARGS                                MEMBERS(_childIndex, ChildrenPerIteration, ChildrenToGenerate, Condition), BASES(Components::WorkingSystem)
+
+    NON_COPYABLE(MyWorkingSystem);
+    MOVE(MyWorkingSystem, ARGS);
+    COMPARE(MyWorkingSystem, ARGS);
+    SERIALIZATION(MyWorkingSystem, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Components::System)));
+
+#undef ARGS
+
+    std::string ToString(void) const override {
+        return boost::str(
+            boost::format("MyWorkingSystem(%s,%s)")
+                % GetScore().ToString()
+                % GetIndex().ToString()
+        );
+    }
+
+    bool IsComplete(void) const override {
+        return _childIndex == ChildrenToGenerate;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    virtual SystemPtrs GenerateChildrenImpl(size_t maxNumChildren, bool) override {
+        // ----------------------------------------------------------------------
+        using CreateSystemFunc              = std::function<LocalExecution::Engine::SystemPtr (Components::Score, Components::Index)>;
+        // ----------------------------------------------------------------------
+
+        size_t                              toGenerate(std::min(std::min(ChildrenPerIteration, ChildrenToGenerate -_childIndex), maxNumChildren));
+
+        assert(toGenerate);
+
+        bool const                          isFinal(GetIndex().Depth() + 1 == Condition->Indexes.size());
+        CreateSystemFunc const              createSystemFunc(
+            [this, isFinal](void) -> CreateSystemFunc {
+                if(isFinal) {
+                    return
+                        [](Components::Score score, Components::Index index) -> LocalExecution::Engine::SystemPtr {
+                            return std::make_shared<MyCalculatedResultSystem>(std::move(score), std::move(index));
+                        };
+                }
+
+                return
+                    [this](Components::Score score, Components::Index index) -> LocalExecution::Engine::SystemPtr {
+                        return std::make_shared<MyWorkingSystem>(
+                            ChildrenPerIteration,
+                            Condition,
+                            std::move(score).Commit(),
+                            std::move(index).Commit()
+                        );
+                    };
+            }()
+        );
+
+        SystemPtrs                          results;
+
+        while(toGenerate--) {
+            Components::Index               newIndex(GetIndex(), _childIndex);
+            Components::Score               newScore(GetScore(), Condition->Apply(newIndex), isFinal);
+
+            results.emplace_back(createSystemFunc(std::move(newScore), std::move(newIndex)));
+            ++_childIndex;
+        }
+
+        return results;
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(MyWorkingSystem);
+
+class Configuration : public LocalExecution::Configuration {
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data (used in public declarations)
+    size_t const                            _maxNumChildrenPerGeneration;
+
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    Configuration(
+        size_t maxNumChildrenPerGeneration,
+        bool isDeterministic,
+        boost::optional<size_t> numConcurrentTasks=boost::none
+    ) :
+        LocalExecution::Configuration(
+            false,
+            std::move(isDeterministic),
+            std::move(numConcurrentTasks)
+        ),
+        _maxNumChildrenPerGeneration(std::move(maxNumChildrenPerGeneration))
+    {}
+
+#define ARGS                                MEMBERS(_maxNumChildrenPerGeneration), BASES(LocalExecution::Configuration)
+
+    NON_COPYABLE(Configuration);
+    MOVE(Configuration, ARGS);
+    COMPARE(Configuration, ARGS);
+    SERIALIZATION(Configuration, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(LocalExecution::Configuration)));
+
+#undef ARGS
+
+    size_t GetMaxNumPendingSystems(void) const override {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    size_t GetMaxNumPendingSystems(WorkingSystem const &) const override {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    size_t GetMaxNumChildrenPerGeneration(WorkingSystem const &) const override {
+        return _maxNumChildrenPerGeneration;
+    }
+
+    size_t GetMaxNumIterationsPerRound(WorkingSystem const &) const override {
+        return std::numeric_limits<size_t>::max();
+    }
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Configuration);
+
+std::vector<Components::Index::value_type> GetIndexes(Components::ResultSystem const &resultParam) {
+    assert(dynamic_cast<MyResultSystem const *>(&resultParam));
+
+    MyResultSystem const &                  result(static_cast<MyResultSystem const &>(resultParam));
+    std::vector<Components::Index::value_type>                     indexes;
+
+    result.GetIndex().Enumerate(
+        [&indexes](Components::Index::value_type value) {
+            indexes.emplace_back(std::move(value));
+            return true;
+        }
+    );
+
+    return indexes;
+}
+
+using Indexes                               = std::vector<Components::Index::value_type>;
+
+// Results are sorted, as local tasks deliver them concurrently
+std::vector<Indexes> GetAllIndexes(LocalExecution::Engine::ResultSystemUniquePtrs const &results) {
+    std::vector<Indexes>                    allIndexes;
+
+    for(auto const &pResult : results)
+        allIndexes.emplace_back(GetIndexes(*pResult));
+
+    std::sort(allIndexes.begin(), allIndexes.end());
+    return allIndexes;
+}
+
+TEST_CASE("Transport") {
+    using SocketTransport                               = LocalExecution::ShardedEngine::SocketTransport;
+
+    SocketTransport::SocketTransportUniquePtr           pFirst;
+    SocketTransport::SocketTransportUniquePtr           pSecond;
+
+    std::tie(pFirst, pSecond) = SocketTransport::CreatePair();
+
+    pFirst->Send("one");
+    pFirst->Send("");
+    pFirst->Send(std::string(100000, 'x'));
+    pSecond->Send("two");
+
+    CHECK(pSecond->Receive() == std::optional<std::string>("one"));
+    CHECK(pSecond->Receive() == std::optional<std::string>(""));
+    CHECK(pSecond->Receive() == std::optional<std::string>(std::string(100000, 'x')));
+    CHECK(pFirst->Receive() == std::optional<std::string>("two"));
+
+    pFirst.reset();
+
+    CHECK(pSecond->Receive() == std::nullopt);
+    CHECK_THROWS(pSecond->Send("three"));
+}
+
+TEST_CASE("Local workers") {
+    MyWorkingSystem::MyConditionPtr const               pCondition(MyCondition::Create(MyCondition::IndexesType{5, 4}, false));
+
+    for(size_t numWorkers : { 1, 3 }) {
+        // The sharded search executes the same rounds as a local search that
+        // uses the same number of tasks.
+        Configuration                                   configuration(10, true, numWorkers);
+        LocalExecution::ShardedEngine::LocalWorkers     workers(configuration, numWorkers);
+        MyObserver                                      observer;
+
+        LocalExecution::Engine::ExecuteResultValue      localResult;
+        LocalExecution::Engine::ResultSystemUniquePtrs  localResults;
+
+        std::tie(localResult, localResults) = LocalExecution::Engine::Execute(
+            configuration,
+            observer,
+            MyWorkingSystem(2, pCondition),
+            1000
+        );
+
+        LocalExecution::Engine::ExecuteResultValue      shardedResult;
+        LocalExecution::Engine::ResultSystemUniquePtrs  shardedResults;
+
+        std::tie(shardedResult, shardedResults) = LocalExecution::ShardedEngine::Execute(
+            configuration,
+            observer,
+            workers.GetTransports(),
+            MyWorkingSystem(2, pCondition),
+            1000
+        );
+
+        CHECK(localResult == LocalExecution::Engine::ExecuteResultValue::Completed);
+        CHECK(shardedResult == localResult);
+        REQUIRE(localResults.size() == 100);
+        CHECK(GetAllIndexes(shardedResults) == GetAllIndexes(localResults));
+        CHECK(observer.errors.empty());
+    }
+}
+
+#if (defined __linux__)
+TEST_CASE("Local workers - Threads") {
+    Configuration                                       configuration(10, true);
+    std::promise<void>                                  release;
+    std::thread                                         thread([future = release.get_future()](void) mutable { future.wait(); });
+
+    FINALLY([&release, &thread](void) { release.set_value(); thread.join(); });
+
+    CHECK_THROWS_MATCHES(
+        LocalExecution::ShardedEngine::LocalWorkers(configuration, 1),
+        std::runtime_error,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("LocalWorkers must be created before any threads are started")
+    );
+}
+#endif
+
+TEST_CASE("Worker thread") {
+    // Workers can be hosted in any process (or thread) that has a transport
+    using SocketTransport                               = LocalExecution::ShardedEngine::SocketTransport;
+
+    Configuration                                       configuration(10, true);
+    SocketTransport::SocketTransportUniquePtr           pCoordinator;
+    SocketTransport::SocketTransportUniquePtr           pWorker;
+
+    std::tie(pCoordinator, pWorker) = SocketTransport::CreatePair();
+
+    std::thread                                         worker([&configuration, &pWorker](void) { LocalExecution::ShardedEngine::ExecuteWorker(configuration, *pWorker); });
+
+    FINALLY([&pCoordinator, &worker](void) { pCoordinator.reset(); worker.join(); });
+
+    MyObserver                                          observer;
+    LocalExecution::Engine::ExecuteResultValue          result;
+    LocalExecution::Engine::ResultSystemUniquePtrs      results;
+
+    std::tie(result, results) = LocalExecution::ShardedEngine::Execute(
+        configuration,
+        observer,
+        LocalExecution::ShardedEngine::Transports{ *pCoordinator },
+        MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0, 1}, true)),
+        1
+    );
+
+    CHECK(result == LocalExecution::Engine::ExecuteResultValue::Completed);
+    REQUIRE(results.size() == 1);
+    CHECK(GetIndexes(*results[0]) == Indexes{0, 1});
+}
+
+TEST_CASE("Errors") {
+    using SocketTransport                               = LocalExecution::ShardedEngine::SocketTransport;
+
+    Configuration                                       configuration(10, true);
+    MyObserver                                          observer;
+
+    CHECK_THROWS_MATCHES(
+        LocalExecution::ShardedEngine::Execute(configuration, observer, LocalExecution::ShardedEngine::Transports(), MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true)), 1),
+        std::invalid_argument,
+        Catch::Matchers::Exception::ExceptionMessageMatcher("workers")
+    );
+
+    SocketTransport::SocketTransportUniquePtr           pCoordinator;
+    SocketTransport::SocketTransportUniquePtr           pWorker;
+
+    std::tie(pCoordinator, pWorker) = SocketTransport::CreatePair();
+
+    pWorker.reset();
+
+    CHECK_THROWS(
+        LocalExecution::ShardedEngine::Execute(configuration, observer, LocalExecution::ShardedEngine::Transports{ *pCoordinator }, MyWorkingSystem(10, MyCondition::Create(MyCondition::IndexesType{0}, true)), 1)
+    );
+}
@@ -0,0 +1,204 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          TraceObserver_UnitTest.cpp
+///  \brief         Unit test for TraceObserver.h
+///
+///  \author        agent <agent@local>
+///  \date          2026-10-18 10:36:59
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2020-22
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../TraceObserver.h"
+#include <catch.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <map>
+#include <set>
+#include <thread>
+
+namespace LocalExecution                    = DecisionEngine::Core::LocalExecution;
+
+// ----------------------------------------------------------------------
+// |
+// |  Internal Types and Methods
+// |
+// ----------------------------------------------------------------------
+class MyObserver : public LocalExecution::Engine::ResultObserver {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    size_t                                  NumEvents;
+    bool                                    ShouldContinue;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyObserver(void) :
+        NumEvents(0),
+        ShouldContinue(true)
+    {}
+
+    ~MyObserver(void) override = default;
+
+    bool OnRoundBegin(size_t, SystemPtrs const &) override { ++NumEvents; return ShouldContinue; }
+    void OnRoundEnd(size_t, SystemPtrs const &) override { ++NumEvents; }
+
+    bool OnRoundMergingWork(size_t, SystemPtrsContainer const &) override { ++NumEvents; return ShouldContinue; }
+    void OnRoundMergedWork(size_t, SystemPtrs const &, SystemPtrsContainer) override { ++NumEvents; }
+
+    bool OnTaskBegin(size_t, size_t, size_t) override { ++NumEvents; return ShouldContinue; }
+    void OnTaskEnd(size_t, size_t, size_t) override { ++NumEvents; }
+
+    void OnTaskError(size_t, size_t, size_t, std::exception const &) override { ++NumEvents; }
+
+    bool OnIterationBegin(size_t, size_t, size_t, size_t, size_t) override { ++NumEvents; return ShouldContinue; }
+    void OnIterationEnd(size_t, size_t, size_t, size_t, size_t) override { ++NumEvents; }
+
+    bool OnIterationGeneratingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &) override { ++NumEvents; return ShouldContinue; }
+    void OnIterationGeneratedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &) override { ++NumEvents; }
+
+    bool OnIterationMergingWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrs const &) override { ++NumEvents; return ShouldContinue; }
+    void OnIterationMergedWork(size_t, size_t, size_t, size_t, size_t, WorkingSystem const &, SystemPtrs const &, SystemPtrsContainer) override { ++NumEvents; }
+
+    bool OnIterationFailedSystems(size_t, size_t, size_t, size_t, size_t, SystemPtrs::const_iterator, SystemPtrs::const_iterator) override { ++NumEvents; return ShouldContinue; }
+
+    bool OnIterationResultSystems(size_t, size_t, size_t, size_t, size_t, ResultSystemUniquePtrs) override { ++NumEvents; return ShouldContinue; }
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  TraceObserver
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("Standard") {
+    MyObserver                              observer;
+    LocalExecution::TraceObserver           traceObserver(observer);
+    std::filesystem::path const             filename(std::filesystem::temp_directory_path() / "TraceObserver_UnitTest.json");
+    LocalExecution::Engine::SystemPtrs const failed;
+
+    FINALLY([&filename](void) { std::error_code ec; std::filesystem::remove(filename, ec); });
+
+    auto const                              taskFunc(
+        [&traceObserver, &failed](size_t task) {
+            CHECK(traceObserver.OnTaskBegin(0, task, 2));
+            CHECK(traceObserver.OnIterationBegin(0, task, 2, 0, 10));
+            CHECK(traceObserver.OnIterationFailedSystems(0, task, 2, 0, 10, failed.cbegin(), failed.cend()));
+            traceObserver.OnIterationEnd(0, task, 2, 0, 10);
+            traceObserver.OnTaskError(0, task, 2, std::runtime_error("An \"error\""));
+            traceObserver.OnTaskEnd(0, task, 2);
+        }
+    );
+
+    CHECK(traceObserver.OnRoundBegin(0, LocalExecution::Engine::SystemPtrs()));
+
+    std::thread                             thread([&taskFunc](void) { taskFunc(1); });
+
+    taskFunc(0);
+    thread.join();
+
+    CHECK(traceObserver.OnRoundMergingWork(0, LocalExecution::Engine::SystemPtrsContainer()));
+    traceObserver.OnRoundMergedWork(0, LocalExecution::Engine::SystemPtrs(), LocalExecution::Engine::SystemPtrsContainer());
+    traceObserver.OnRoundEnd(0, LocalExecution::Engine::SystemPtrs());
+
+    CHECK(observer.NumEvents == 16);
+    CHECK(traceObserver.GetNumEvents() == 16);
+
+    traceObserver.Write(filename);
+
+    boost::property_tree::ptree             root;
+
+    boost::property_tree::read_json(filename.string(), root);
+
+    CHECK(root.get<std::string>("displayTimeUnit") == "ns");
+
+    boost::property_tree::ptree const &     events(root.get_child("traceEvents"));
+    std::map<std::string, size_t>           counts;
+    std::set<std::string>                   threads;
+
+    for(auto const &kvp : events) {
+        ++counts[kvp.second.get<std::string>("ph")];
+        threads.insert(kvp.second.get<std::string>("tid"));
+    }
+
+    CHECK(counts["M"] == 2);                // Thread names
+    CHECK(counts["B"] == 6);
+    CHECK(counts["E"] == 6);
+    CHECK(counts["i"] == 4);
+    CHECK(threads.size() == 2);
+}
+
+TEST_CASE("Event flags") {
+    using EventFlagValue                    = LocalExecution::Engine::EventFlagValue;
+
+    MyObserver                              observer;
+    LocalExecution::TraceObserver           traceObserver(observer, EventFlagValue::Round | EventFlagValue::TaskError);
+
+    CHECK(traceObserver.EventFlags == (EventFlagValue::Round | EventFlagValue::TaskError));
+
+    // Events requested by the wrapped observer are also requested
+    CHECK(traceObserver.GetEventFlags() == EventFlagValue::All);
+
+    CHECK(traceObserver.OnRoundBegin(0, LocalExecution::Engine::SystemPtrs()));
+    CHECK(traceObserver.OnTaskBegin(0, 0, 1));
+    CHECK(traceObserver.OnIterationBegin(0, 0, 1, 0, 10));
+    traceObserver.OnIterationEnd(0, 0, 1, 0, 10);
+    traceObserver.OnTaskError(0, 0, 1, std::runtime_error("Error"));
+    traceObserver.OnTaskEnd(0, 0, 1);
+    CHECK(traceObserver.OnIterationResultSystems(0, 0, 1, 0, 10, LocalExecution::Engine::ResultSystemUniquePtrs()));
+    traceObserver.OnRoundEnd(0, LocalExecution::Engine::SystemPtrs());
+
+    // Only round, task error, and result events are recorded
+    CHECK(observer.NumEvents == 8);
+    CHECK(traceObserver.GetNumEvents() == 4);
+}
+
+TEST_CASE("Event flags - Wrapped observer") {
+    using EventFlagValue                    = LocalExecution::Engine::EventFlagValue;
+
+    // ----------------------------------------------------------------------
+    class MyFilteredObserver : public MyObserver {
+    public:
+        EventFlagValue GetEventFlags(void) const override { return EventFlagValue::Task; }
+    };
+    // ----------------------------------------------------------------------
+
+    MyFilteredObserver                      observer;
+
+    CHECK(LocalExecution::TraceObserver(observer, EventFlagValue::Round).GetEventFlags() == (EventFlagValue::Round | EventFlagValue::Task));
+    CHECK(LocalExecution::TraceObserver(observer, EventFlagValue::None).GetEventFlags() == EventFlagValue::Task);
+}
+
+TEST_CASE("Not recorded when cancelled") {
+    MyObserver                              observer;
+    LocalExecution::TraceObserver           traceObserver(observer);
+
+    observer.ShouldContinue = false;
+
+    CHECK(traceObserver.OnRoundBegin(0, LocalExecution::Engine::SystemPtrs()) == false);
+    CHECK(traceObserver.OnTaskBegin(0, 0, 1) == false);
+    CHECK(traceObserver.OnIterationBegin(0, 0, 1, 0, 10) == false);
+
+    CHECK(observer.NumEvents == 3);
+    CHECK(traceObserver.GetNumEvents() == 0);
+}
+
+TEST_CASE("Write - Errors") {
+    MyObserver                              observer;
+    LocalExecution::TraceObserver           traceObserver(observer);
+
+    CHECK_THROWS_MATCHES(traceObserver.Write(std::filesystem::temp_directory_path() / "__does_not_exist__" / "Trace.json"), std::runtime_error, Catch::Matchers::Exception::ExceptionMessageMatcher("Invalid trace file"));
+}
@@ -18,6 +18,8 @@ function(Impl)
             DecisionEngineCoreLocalExecution
 
         FILES
+            ${_this_path}/../AnytimeObserver.cpp
+            ${_this_path}/../AnytimeObserver.h
             ${_this_path}/../Configuration.cpp
             ${_this_path}/../Configuration.h
             ${_this_path}/../Engine.cpp
@@ -25,6 +27,12 @@ function(Impl)
             ${_this_path}/../FingerprinterFactory.cpp
             ${_this_path}/../FingerprinterFactory.h
             ${_this_path}/../LocalExecution.h
+            ${_this_path}/../NumaTopology.cpp
+            ${_this_path}/../NumaTopology.h
+            ${_this_path}/../ShardedEngine.cpp
+            ${_this_path}/../ShardedEngine.h
+            ${_this_path}/../TraceObserver.cpp
+            ${_this_path}/../TraceObserver.h
 
         PRECOMPILED_HEADERS
             ${_this_path}/../LocalExecution.h